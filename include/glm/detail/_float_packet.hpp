@@ -0,0 +1,24 @@
+#pragma once
+
+#include "setup.hpp"
+#include "_simd_dispatch.hpp"
+
+namespace glm{
+namespace detail
+{
+#	define GLM_KERNEL_ARCH GLM_ARCH
+#	include "_float_packet_simd.inl"
+#	undef GLM_KERNEL_ARCH
+
+#	if GLM_SIMD_DISPATCH_AVX2
+	GLM_SIMD_TARGET_AVX2_BEGIN
+	namespace avx2
+	{
+#	define GLM_KERNEL_ARCH GLM_ARCH_AVX2
+#	include "_float_packet_simd.inl"
+#	undef GLM_KERNEL_ARCH
+	}//namespace avx2
+	GLM_SIMD_TARGET_END
+#	endif//GLM_SIMD_DISPATCH_AVX2
+}//namespace detail
+}//namespace glm
@@ -0,0 +1,114 @@
+/// Included once per kernel tier, inside that tier's namespace, with GLM_KERNEL_ARCH naming its instruction sets
+
+	// Lane wise float operations for an L wide SIMD register, simd is false when the tier has no register of that width.
+	// shuffle and the strided load and store work on blocks of 4 lanes, the second block Stride floats after the first.
+	// The two pointer load gathers the blocks from unrelated addresses, the second pointer is unused with 4 lanes
+	template<length_t L>
+	struct float_packet
+	{
+		static bool const simd = false;
+	};
+
+#	if GLM_KERNEL_ARCH & GLM_ARCH_SSE2_BIT
+	template<>
+	struct float_packet<4>
+	{
+		static bool const simd = true;
+		typedef __m128 type;
+
+		GLM_FUNC_QUALIFIER static type load(float const* p) { return _mm_loadu_ps(p); }
+		GLM_FUNC_QUALIFIER static type load(float const* p, std::size_t) { return _mm_loadu_ps(p); }
+		GLM_FUNC_QUALIFIER static type load(float const* p, float const*) { return _mm_loadu_ps(p); }
+		GLM_FUNC_QUALIFIER static void store(float* p, type v) { _mm_storeu_ps(p, v); }
+		GLM_FUNC_QUALIFIER static void store(float* p, std::size_t, type v) { _mm_storeu_ps(p, v); }
+		GLM_FUNC_QUALIFIER static type set1(float s) { return _mm_set1_ps(s); }
+		GLM_FUNC_QUALIFIER static type add(type a, type b) { return _mm_add_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type sub(type a, type b) { return _mm_sub_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type mul(type a, type b) { return _mm_mul_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type div(type a, type b) { return _mm_div_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type min(type a, type b) { return _mm_min_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type max(type a, type b) { return _mm_max_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type abs(type a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+		GLM_FUNC_QUALIFIER static type sqrt(type a) { return _mm_sqrt_ps(a); }
+		GLM_FUNC_QUALIFIER static type rsqrt(type a) { return _mm_rsqrt_ps(a); }
+#		if GLM_KERNEL_ARCH & GLM_ARCH_SSE41_BIT
+		GLM_FUNC_QUALIFIER static type floor(type a) { return _mm_floor_ps(a); }
+#		else
+		// Truncate, then step down where truncation rounded up; valid while |a| < 2^31
+		GLM_FUNC_QUALIFIER static type floor(type a)
+		{
+			type const Trunc = _mm_cvtepi32_ps(_mm_cvttps_epi32(a));
+			return _mm_sub_ps(Trunc, _mm_and_ps(_mm_cmpgt_ps(Trunc, a), _mm_set1_ps(1.0f)));
+		}
+#		endif
+		GLM_FUNC_QUALIFIER static type cmp_lt(type a, type b) { return _mm_cmplt_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type cmp_le(type a, type b) { return _mm_cmple_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type cmp_gt(type a, type b) { return _mm_cmpgt_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type cmp_ge(type a, type b) { return _mm_cmpge_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type cmp_nlt(type a, type b) { return _mm_cmpnlt_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type and_(type a, type b) { return _mm_and_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type or_(type a, type b) { return _mm_or_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type xor_(type a, type b) { return _mm_xor_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type select(type m, type a, type b) { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+		GLM_FUNC_QUALIFIER static int movemask(type m) { return _mm_movemask_ps(m); }
+		template<int S>
+		GLM_FUNC_QUALIFIER static type shuffle(type a, type b) { return _mm_shuffle_ps(a, b, S); }
+	};
+#	endif//GLM_KERNEL_ARCH & GLM_ARCH_SSE2_BIT
+
+#	if GLM_KERNEL_ARCH & GLM_ARCH_AVX_BIT
+	template<>
+	struct float_packet<8>
+	{
+		static bool const simd = true;
+		typedef __m256 type;
+
+		GLM_FUNC_QUALIFIER static type load(float const* p) { return _mm256_loadu_ps(p); }
+		GLM_FUNC_QUALIFIER static type load(float const* p, std::size_t Stride)
+		{
+			return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p)), _mm_loadu_ps(p + Stride), 1);
+		}
+		GLM_FUNC_QUALIFIER static type load(float const* p, float const* q)
+		{
+			return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p)), _mm_loadu_ps(q), 1);
+		}
+		GLM_FUNC_QUALIFIER static void store(float* p, type v) { _mm256_storeu_ps(p, v); }
+		GLM_FUNC_QUALIFIER static void store(float* p, std::size_t Stride, type v)
+		{
+			_mm_storeu_ps(p, _mm256_castps256_ps128(v));
+			_mm_storeu_ps(p + Stride, _mm256_extractf128_ps(v, 1));
+		}
+		GLM_FUNC_QUALIFIER static type set1(float s) { return _mm256_set1_ps(s); }
+		GLM_FUNC_QUALIFIER static type add(type a, type b) { return _mm256_add_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type sub(type a, type b) { return _mm256_sub_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type mul(type a, type b) { return _mm256_mul_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type div(type a, type b) { return _mm256_div_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type min(type a, type b) { return _mm256_min_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type max(type a, type b) { return _mm256_max_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type abs(type a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+		GLM_FUNC_QUALIFIER static type sqrt(type a) { return _mm256_sqrt_ps(a); }
+		GLM_FUNC_QUALIFIER static type rsqrt(type a) { return _mm256_rsqrt_ps(a); }
+		GLM_FUNC_QUALIFIER static type floor(type a) { return _mm256_floor_ps(a); }
+		GLM_FUNC_QUALIFIER static type cmp_lt(type a, type b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+		GLM_FUNC_QUALIFIER static type cmp_le(type a, type b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+		GLM_FUNC_QUALIFIER static type cmp_gt(type a, type b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+		GLM_FUNC_QUALIFIER static type cmp_ge(type a, type b) { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+		GLM_FUNC_QUALIFIER static type cmp_nlt(type a, type b) { return _mm256_cmp_ps(a, b, _CMP_NLT_UQ); }
+		GLM_FUNC_QUALIFIER static type and_(type a, type b) { return _mm256_and_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type or_(type a, type b) { return _mm256_or_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type xor_(type a, type b) { return _mm256_xor_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type select(type m, type a, type b) { return _mm256_blendv_ps(b, a, m); }
+		GLM_FUNC_QUALIFIER static int movemask(type m) { return _mm256_movemask_ps(m); }
+		template<int S>
+		GLM_FUNC_QUALIFIER static type shuffle(type a, type b) { return _mm256_shuffle_ps(a, b, S); }
+	};
+#	endif//GLM_KERNEL_ARCH & GLM_ARCH_AVX_BIT
+
+	// Widest float_packet of the tier, 1 when there is none
+#	if GLM_KERNEL_ARCH & GLM_ARCH_AVX_BIT
+	static length_t const float_packet_width = 8;
+#	elif GLM_KERNEL_ARCH & GLM_ARCH_SSE2_BIT
+	static length_t const float_packet_width = 4;
+#	else
+	static length_t const float_packet_width = 1;
+#	endif
@@ -0,0 +1,141 @@
+#pragma once
+
+#include "setup.hpp"
+
+#if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+#	if GLM_COMPILER & GLM_COMPILER_VC
+#		include <intrin.h>
+#	else
+#		include <cpuid.h>
+#	endif
+#	include <immintrin.h>
+#endif
+
+// Kernel tiers compiled next to the GLM_ARCH code, only those wider than GLM_ARCH
+#define GLM_SIMD_DISPATCH_AVX2 ((GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE) && !(GLM_ARCH & GLM_ARCH_AVX2_BIT))
+#define GLM_SIMD_DISPATCH_AVX512 (GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE)
+
+// Code between BEGIN and END is compiled for the tier's instruction set whatever the compiler flags are.
+// Visual C++ accepts any intrinsic in any function, GCC and Clang need the target of each function raised
+#if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE && (GLM_COMPILER & GLM_COMPILER_GCC)
+#	define GLM_SIMD_TARGET_AVX2_BEGIN _Pragma("GCC push_options") _Pragma("GCC target(\"avx2,fma\")")
+#	define GLM_SIMD_TARGET_AVX512_BEGIN _Pragma("GCC push_options") _Pragma("GCC target(\"avx512f,avx2,fma\")")
+#	define GLM_SIMD_TARGET_END _Pragma("GCC pop_options")
+#elif GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE && (GLM_COMPILER & GLM_COMPILER_CLANG)
+#	define GLM_SIMD_TARGET_AVX2_BEGIN _Pragma("clang attribute push(__attribute__((target(\"avx2,fma\"))), apply_to = function)")
+#	define GLM_SIMD_TARGET_AVX512_BEGIN _Pragma("clang attribute push(__attribute__((target(\"avx512f,avx2,fma\"))), apply_to = function)")
+#	define GLM_SIMD_TARGET_END _Pragma("clang attribute pop")
+#else
+#	define GLM_SIMD_TARGET_AVX2_BEGIN
+#	define GLM_SIMD_TARGET_AVX512_BEGIN
+#	define GLM_SIMD_TARGET_END
+#endif
+
+namespace glm
+{
+	/// Instruction sets both the CPU and the operating system support, all false when GLM can not query them.
+	struct cpu_features
+	{
+		bool sse41;
+		bool avx;
+		bool avx2;
+		bool fma;
+		bool avx512f;
+	};
+
+	/// Kernels the bulk SIMD functions run: those GLM_ARCH compiles, AVX2 with FMA, or AVX-512F.
+	/// A tier without its own kernels, because GLM_ARCH already covers it or it is not compiled, runs the next lower one.
+	enum simd_dispatch
+	{
+		simd_dispatch_arch,
+		simd_dispatch_avx2,
+		simd_dispatch_avx512
+	};
+
+namespace detail
+{
+	GLM_FUNC_QUALIFIER cpu_features cpu_features_detect()
+	{
+		cpu_features Features = {false, false, false, false, false};
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+		// eax ebx ecx edx of leaves 1 and 7
+		unsigned int Leaf1[4] = {0, 0, 0, 0};
+		unsigned int Leaf7[4] = {0, 0, 0, 0};
+#			if GLM_COMPILER & GLM_COMPILER_VC
+		int Info[4];
+		__cpuid(Info, 0);
+		int const MaxLeaf = Info[0];
+		if(MaxLeaf >= 1)
+		{
+			__cpuidex(Info, 1, 0);
+			for(int i = 0; i < 4; ++i)
+				Leaf1[i] = static_cast<unsigned int>(Info[i]);
+		}
+		if(MaxLeaf >= 7)
+		{
+			__cpuidex(Info, 7, 0);
+			for(int i = 0; i < 4; ++i)
+				Leaf7[i] = static_cast<unsigned int>(Info[i]);
+		}
+#			else
+		unsigned int const MaxLeaf = __get_cpuid_max(0, 0);
+		if(MaxLeaf >= 1)
+			__cpuid(1, Leaf1[0], Leaf1[1], Leaf1[2], Leaf1[3]);
+		if(MaxLeaf >= 7)
+			__cpuid_count(7, 0, Leaf7[0], Leaf7[1], Leaf7[2], Leaf7[3]);
+#			endif
+
+		// XCR0 tells which register state the operating system saves on a context switch, readable once OSXSAVE is set
+		unsigned long long Xcr0 = 0;
+		if(Leaf1[2] & (1u << 27))
+		{
+#			if GLM_COMPILER & GLM_COMPILER_VC
+			Xcr0 = _xgetbv(0);
+#			else
+			unsigned int Low, High;
+			__asm__ __volatile__("xgetbv" : "=a"(Low), "=d"(High) : "c"(0));
+			Xcr0 = (static_cast<unsigned long long>(High) << 32) | Low;
+#			endif
+		}
+		bool const Ymm = (Xcr0 & 0x06) == 0x06;
+		bool const Zmm = (Xcr0 & 0xE6) == 0xE6;
+
+		Features.sse41 = (Leaf1[2] & (1u << 19)) != 0;
+		Features.avx = Ymm && (Leaf1[2] & (1u << 28)) != 0;
+		Features.fma = Features.avx && (Leaf1[2] & (1u << 12)) != 0;
+		Features.avx2 = Features.avx && (Leaf7[1] & (1u << 5)) != 0;
+		Features.avx512f = Zmm && Features.avx2 && (Leaf7[1] & (1u << 16)) != 0;
+#		endif
+		return Features;
+	}
+
+	// cpuid runs once, on the first call
+	GLM_FUNC_QUALIFIER cpu_features const& cpu_features_get()
+	{
+		static cpu_features const Features = cpu_features_detect();
+		return Features;
+	}
+
+	GLM_FUNC_QUALIFIER simd_dispatch simd_dispatch_detect()
+	{
+		cpu_features const& Features = cpu_features_get();
+		if(!Features.avx2 || !Features.fma)
+			return simd_dispatch_arch;
+		return Features.avx512f ? simd_dispatch_avx512 : simd_dispatch_avx2;
+	}
+
+	// Highest tier the bulk functions may use, lowered by simdDispatchLimit
+	GLM_FUNC_QUALIFIER simd_dispatch& simd_dispatch_limit()
+	{
+		static simd_dispatch Limit = simd_dispatch_avx512;
+		return Limit;
+	}
+
+	GLM_FUNC_QUALIFIER simd_dispatch simd_dispatch_current()
+	{
+		static simd_dispatch const Detected = simd_dispatch_detect();
+		simd_dispatch const Limit = simd_dispatch_limit();
+		return Detected < Limit ? Detected : Limit;
+	}
+}//namespace detail
+}//namespace glm
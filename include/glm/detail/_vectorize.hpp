@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstring>
+
 namespace glm{
 namespace detail
 {
@@ -158,5 +160,29 @@ namespace detail
 			return vec<4, int, Q>(Func(a.x, b.x), Func(a.y, b.y), Func(a.z, b.z), Func(a.w, b.w));
 		}
 	};
+
+	// Runs Func, a vec<L, T, Q> function, over Count scalars L at a time, the last ones padded with Pad
+	template<length_t L, typename T, qualifier Q, typename Func>
+	struct functor1_array
+	{
+		GLM_FUNC_QUALIFIER static void call(T const* In, T* Out, std::size_t Count, T Pad)
+		{
+			std::size_t i = 0;
+			for(; i + L <= Count; i += L)
+			{
+				vec<L, T, Q> v;
+				std::memcpy(&v[0], In + i, sizeof(T) * L);
+				v = Func::call(v);
+				std::memcpy(Out + i, &v[0], sizeof(T) * L);
+			}
+			if(i < Count)
+			{
+				vec<L, T, Q> v(Pad);
+				std::memcpy(&v[0], In + i, sizeof(T) * (Count - i));
+				v = Func::call(v);
+				std::memcpy(Out + i, &v[0], sizeof(T) * (Count - i));
+			}
+		}
+	};
 }//namespace detail
 }//namespace glm
@@ -26,6 +26,8 @@ namespace detail
 	};
 #	endif
 
+	// Transpose and inverse keep the SSE2 kernels at every tier: the AVX2 and AVX-512 ones in simd/matrix.h only pay
+	// off for the product, they are no faster here
 	template<qualifier Q>
 	struct compute_transpose<4, 4, float, Q, true>
 	{
@@ -56,6 +58,19 @@ namespace detail
 			return Result;
 		}
 	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	template<qualifier Q>
+	struct compute_transpose<4, 4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, double, Q> call(mat<4, 4, double, Q> const& m)
+		{
+			mat<4, 4, double, Q> Result;
+			glm_dmat4_transpose(&m[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
 }//namespace detail
 
 #	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
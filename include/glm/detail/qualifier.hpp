@@ -81,6 +81,33 @@ namespace detail
 		};
 #	endif
 
+	// Aligned qualifier of the same precision, P itself when the aligned types are disabled
+	template<glm::qualifier P>
+	struct to_aligned
+	{
+		static const glm::qualifier value = P;
+	};
+
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		template<>
+		struct to_aligned<glm::packed_lowp>
+		{
+			static const glm::qualifier value = glm::aligned_lowp;
+		};
+
+		template<>
+		struct to_aligned<glm::packed_mediump>
+		{
+			static const glm::qualifier value = glm::aligned_mediump;
+		};
+
+		template<>
+		struct to_aligned<glm::packed_highp>
+		{
+			static const glm::qualifier value = glm::aligned_highp;
+		};
+#	endif
+
 	template<length_t L, typename T, bool is_aligned>
 	struct storage
 	{
@@ -807,6 +807,19 @@ namespace detail
 #	define GLM_CONFIG_SIMD GLM_DISABLE
 #endif
 
+///////////////////////////////////////////////////////////////////////////////////
+// Runtime dispatch of the bulk SIMD functions to instruction sets wider than GLM_ARCH
+// User defines: GLM_FORCE_NO_SIMD_DISPATCH
+
+#if (GLM_CONFIG_SIMD == GLM_ENABLE) && (GLM_ARCH & GLM_ARCH_SSE2_BIT) && !(GLM_ARCH & GLM_ARCH_AVX512_BIT) && !defined(GLM_FORCE_NO_SIMD_DISPATCH) && (\
+	((GLM_COMPILER & GLM_COMPILER_GCC) && (GLM_COMPILER >= GLM_COMPILER_GCC49)) || \
+	((GLM_COMPILER & GLM_COMPILER_CLANG) && !defined(_MSC_VER) && (__clang_major__ >= 9)) || \
+	((GLM_COMPILER & GLM_COMPILER_VC) && (GLM_COMPILER >= GLM_COMPILER_VC15)))
+#	define GLM_CONFIG_SIMD_DISPATCH GLM_ENABLE
+#else
+#	define GLM_CONFIG_SIMD_DISPATCH GLM_DISABLE
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////////
 // Configure the use of defaulted function
 
@@ -977,7 +990,12 @@ namespace detail
 #	endif
 
 	// Report build target
-#	if (GLM_ARCH & GLM_ARCH_AVX2_BIT) && (GLM_MODEL == GLM_MODEL_64)
+#	if (GLM_ARCH & GLM_ARCH_AVX512_BIT) && (GLM_MODEL == GLM_MODEL_64)
+#		pragma message("GLM: x86 64 bits with AVX-512 instruction set build target")
+#	elif (GLM_ARCH & GLM_ARCH_AVX512_BIT) && (GLM_MODEL == GLM_MODEL_32)
+#		pragma message("GLM: x86 32 bits with AVX-512 instruction set build target")
+
+#	elif (GLM_ARCH & GLM_ARCH_AVX2_BIT) && (GLM_MODEL == GLM_MODEL_64)
 #		pragma message("GLM: x86 64 bits with AVX2 instruction set build target")
 #	elif (GLM_ARCH & GLM_ARCH_AVX2_BIT) && (GLM_MODEL == GLM_MODEL_32)
 #		pragma message("GLM: x86 32 bits with AVX2 instruction set build target")
@@ -1102,6 +1120,10 @@ namespace detail
 #		pragma message("GLM: GLM_FORCE_SINGLE_ONLY is defined. Using only single precision floating-point types.")
 #	endif
 
+#	if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+#		pragma message("GLM: Bulk SIMD functions dispatch to AVX2 and AVX-512 at runtime. Define GLM_FORCE_NO_SIMD_DISPATCH to only use GLM_ARCH.")
+#	endif
+
 #	if defined(GLM_FORCE_ALIGNED_GENTYPES) && (GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE)
 #		undef GLM_FORCE_ALIGNED_GENTYPES
 #		pragma message("GLM: GLM_FORCE_ALIGNED_GENTYPES is defined, allowing aligned types. This prevents the use of C++ constexpr.")
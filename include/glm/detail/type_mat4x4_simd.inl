@@ -1,6 +1,43 @@
 /// @ref core
 
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include "../simd/matrix.h"
+
 namespace glm
 {
+#	if GLM_LANG & GLM_LANG_CXX11_FLAG
+	// Aligned mat4 products on the widest kernel GLM_ARCH provides: one register per matrix with AVX-512, two with
+	// AVX2 and FMA, four with SSE2
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER
+	typename std::enable_if<detail::is_aligned<Q>::value, mat<4, 4, float, Q> >::type
+	operator*(mat<4, 4, float, Q> const& m1, mat<4, 4, float, Q> const& m2)
+	{
+		mat<4, 4, float, Q> Result;
+#		if GLM_ARCH & GLM_ARCH_AVX512_BIT
+			glm_mat4_mul_avx512(&m1[0].data, &m2[0].data, &Result[0].data);
+#		elif GLM_ARCH & GLM_ARCH_AVX2_BIT
+			glm_mat4_mul_avx2(&m1[0].data, &m2[0].data, &Result[0].data);
+#		else
+			glm_mat4_mul(&m1[0].data, &m2[0].data, &Result[0].data);
+#		endif
+		return Result;
+	}
 
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+	// Aligned dmat4 products, one column per register
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER
+	typename std::enable_if<detail::is_aligned<Q>::value, mat<4, 4, double, Q> >::type
+	operator*(mat<4, 4, double, Q> const& m1, mat<4, 4, double, Q> const& m2)
+	{
+		mat<4, 4, double, Q> Result;
+		glm_dmat4_mul(&m1[0].data, &m2[0].data, &Result[0].data);
+		return Result;
+	}
+#		endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+#	endif//GLM_LANG & GLM_LANG_CXX11_FLAG
 }//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
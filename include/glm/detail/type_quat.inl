@@ -40,6 +40,19 @@ namespace detail
 		}
 	};
 
+	template<typename T, qualifier Q, bool Aligned>
+	struct compute_quat_mul
+	{
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static qua<T, Q> call(qua<T, Q> const& p, qua<T, Q> const& q)
+		{
+			return qua<T, Q>(
+				p.w * q.w - p.x * q.x - p.y * q.y - p.z * q.z,
+				p.w * q.x + p.x * q.w + p.y * q.z - p.z * q.y,
+				p.w * q.y + p.y * q.w + p.z * q.x - p.x * q.z,
+				p.w * q.z + p.z * q.w + p.x * q.y - p.y * q.x);
+		}
+	};
+
 	template<typename T, qualifier Q, bool Aligned>
 	struct compute_quat_mul_scalar
 	{
@@ -281,14 +294,7 @@ namespace detail
 	template<typename U>
 	GLM_FUNC_QUALIFIER GLM_CONSTEXPR qua<T, Q> & qua<T, Q>::operator*=(qua<U, Q> const& r)
 	{
-		qua<T, Q> const p(*this);
-		qua<T, Q> const q(r);
-
-		this->w = p.w * q.w - p.x * q.x - p.y * q.y - p.z * q.z;
-		this->x = p.w * q.x + p.x * q.w + p.y * q.z - p.z * q.y;
-		this->y = p.w * q.y + p.y * q.w + p.z * q.x - p.x * q.z;
-		this->z = p.w * q.z + p.z * q.w + p.x * q.y - p.y * q.x;
-		return *this;
+		return (*this = detail::compute_quat_mul<T, Q, detail::is_aligned<Q>::value>::call(*this, qua<T, Q>(r)));
 	}
 
 	template<typename T, qualifier Q>
@@ -60,6 +60,36 @@ namespace detail
 	};
 */
 
+#	if (GLM_ARCH & GLM_ARCH_AVX2_BIT) && !defined(GLM_FORCE_QUAT_DATA_WXYZ)
+	template<qualifier Q>
+	struct compute_quat_mul<double, Q, true>
+	{
+		static qua<double, Q> call(qua<double, Q> const& p, qua<double, Q> const& q)
+		{
+			// lanes x y z w:
+			//   p.w * (q.x, q.y, q.z, q.w)
+			// + (p.x, p.y, p.z, -p.x) * (q.w, q.w, q.w, q.x)
+			// + (p.y, p.z, p.x, -p.y) * (q.z, q.x, q.y, q.y)
+			// - (p.z, p.x, p.y, p.z) * (q.y, q.z, q.x, q.z)
+			__m256d const NegW = _mm256_setr_pd(0.0, 0.0, 0.0, -0.0);
+			__m256d const p_wwww = _mm256_permute4x64_pd(p.data, _MM_SHUFFLE(3, 3, 3, 3));
+			__m256d const p_xyzx = _mm256_xor_pd(NegW, _mm256_permute4x64_pd(p.data, _MM_SHUFFLE(0, 2, 1, 0)));
+			__m256d const p_yzxy = _mm256_xor_pd(NegW, _mm256_permute4x64_pd(p.data, _MM_SHUFFLE(1, 0, 2, 1)));
+			__m256d const p_zxyz = _mm256_permute4x64_pd(p.data, _MM_SHUFFLE(2, 1, 0, 2));
+			__m256d const q_wwwx = _mm256_permute4x64_pd(q.data, _MM_SHUFFLE(0, 3, 3, 3));
+			__m256d const q_zxyy = _mm256_permute4x64_pd(q.data, _MM_SHUFFLE(1, 1, 0, 2));
+			__m256d const q_yzxz = _mm256_permute4x64_pd(q.data, _MM_SHUFFLE(2, 0, 2, 1));
+
+			__m256d const mul0 = _mm256_fmsub_pd(p_yzxy, q_zxyy, _mm256_mul_pd(p_zxyz, q_yzxz));
+			__m256d const mad0 = _mm256_fmadd_pd(p_xyzx, q_wwwx, mul0);
+
+			qua<double, Q> Result;
+			Result.data = _mm256_fmadd_pd(p_wwww, q.data, mad0);
+			return Result;
+		}
+	};
+#	endif
+
 	template<qualifier Q>
 	struct compute_quat_add<float, Q, true>
 	{
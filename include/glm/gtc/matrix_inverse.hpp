@@ -36,6 +36,15 @@ namespace glm
 	template<typename genType>
 	GLM_FUNC_DECL genType affineInverse(genType const& m);
 
+	/// Fast matrix inverse for rigid transforms, a rotation followed by a translation: the rotation is transposed
+	/// instead of inverted. Wrong for matrices with scale or shear, use affineInverse for those.
+	///
+	/// @param m Input matrix to invert.
+	/// @tparam genType Squared floating-point matrix: half, float or double.
+	/// @see gtc_matrix_inverse
+	template<typename genType>
+	GLM_FUNC_DECL genType rigidInverse(genType const& m);
+
 	/// Compute the inverse transpose of a matrix.
 	///
 	/// @param m Input matrix to invert transpose.
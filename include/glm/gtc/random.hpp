@@ -10,6 +10,10 @@
 /// Include <glm/gtc/random.hpp> to use the features of this extension.
 ///
 /// Generate random number from various distribution methods.
+///
+/// Random bits come from a xoshiro128** engine with one state per thread, see randEngine() and randSeed().
+/// Besides the functions returning one value, there are bulk versions filling arrays, which run one engine per
+/// SIMD lane: 8 with AVX2, 4 with SSE2.
 
 #pragma once
 
@@ -17,6 +21,7 @@
 #include "../ext/scalar_int_sized.hpp"
 #include "../ext/scalar_uint_sized.hpp"
 #include "../detail/qualifier.hpp"
+#include <cstddef>
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTC_random extension included")
@@ -27,6 +32,64 @@ namespace glm
 	/// @addtogroup gtc_random
 	/// @{
 
+	/// xoshiro128** 1.1 by Blackman and Vigna: 128 bits of state, 32 bit outputs, period 2^128 - 1.
+	/// The engine behind every function of this extension. Meets the standard UniformRandomBitGenerator
+	/// requirements, so it also drives the <random> distributions.
+	///
+	/// @see gtc_random
+	struct xoshiro128
+	{
+		typedef uint32 result_type;
+
+		GLM_FUNC_DECL explicit xoshiro128(uint64 Seed = 0);
+
+		/// Expands Seed into a full state with splitmix64, any value is a good seed
+		GLM_FUNC_DECL void seed(uint64 Seed);
+
+		/// Advances the state as far as 2^64 calls would, copies jumped 0, 1, 2... times give non overlapping streams
+		GLM_FUNC_DECL void jump();
+
+		GLM_FUNC_DECL uint32 operator()();
+
+		GLM_FUNC_DECL static GLM_CONSTEXPR uint32 min() { return 0; }
+		GLM_FUNC_DECL static GLM_CONSTEXPR uint32 max() { return 0xffffffffu; }
+
+		uint32 State[4];
+	};
+
+	/// PCG32 (XSH RR) by O'Neill: a 64 bit LCG with a permuted output, 32 bit outputs, period 2^64.
+	/// Stream selects one of 2^63 independent sequences for the same seed.
+	///
+	/// @see gtc_random
+	struct pcg32
+	{
+		typedef uint32 result_type;
+
+		GLM_FUNC_DECL explicit pcg32(uint64 Seed = 0, uint64 Stream = 0);
+
+		GLM_FUNC_DECL void seed(uint64 Seed, uint64 Stream = 0);
+
+		GLM_FUNC_DECL uint32 operator()();
+
+		GLM_FUNC_DECL static GLM_CONSTEXPR uint32 min() { return 0; }
+		GLM_FUNC_DECL static GLM_CONSTEXPR uint32 max() { return 0xffffffffu; }
+
+		uint64 State;
+		uint64 Increment;
+	};
+
+	/// The calling thread's engine, used by every function of this extension.
+	/// Threads that never call randSeed() are seeded from a process wide counter the first time they draw a number.
+	///
+	/// @see gtc_random
+	GLM_FUNC_DECL xoshiro128& randEngine();
+
+	/// Reseed the calling thread's engine, including the lanes of the bulk functions.
+	/// For reproducible runs every thread drawing numbers seeds itself, for example with a base seed plus its worker index.
+	///
+	/// @see gtc_random
+	GLM_FUNC_DECL void randSeed(uint64 Seed);
+
 	/// Generate random numbers in the interval [Min, Max], according a linear distribution
 	///
 	/// @param Min Minimum value included in the sampling
@@ -76,6 +139,37 @@ namespace glm
 	template<typename T>
 	GLM_FUNC_DECL vec<3, T, defaultp> ballRand(T Radius);
 
+	/// Fill Out with Count numbers in the interval [Min, Max), according a linear distribution
+	///
+	/// @see gtc_random
+	GLM_FUNC_DECL void linearRand(float Min, float Max, float* Out, std::size_t Count);
+
+	/// Fill Out with Count numbers according a gaussian distribution, Deviation is the standard deviation
+	/// (the scalar gaussRand(Mean, Deviation) spreads its numbers by Deviation * Deviation instead)
+	///
+	/// @see gtc_random
+	GLM_FUNC_DECL void gaussRand(float Mean, float Deviation, float* Out, std::size_t Count);
+
+	/// Fill Out with Count 2D vectors regulary distributed on a circle of a given radius
+	///
+	/// @see gtc_random
+	GLM_FUNC_DECL void circularRand(float Radius, vec<2, float, defaultp>* Out, std::size_t Count);
+
+	/// Fill Out with Count 3D vectors regulary distributed on a sphere of a given radius
+	///
+	/// @see gtc_random
+	GLM_FUNC_DECL void sphericalRand(float Radius, vec<3, float, defaultp>* Out, std::size_t Count);
+
+	/// Fill Out with Count 2D vectors regulary distributed within the area of a disk of a given radius
+	///
+	/// @see gtc_random
+	GLM_FUNC_DECL void diskRand(float Radius, vec<2, float, defaultp>* Out, std::size_t Count);
+
+	/// Fill Out with Count 3D vectors regulary distributed within the volume of a ball of a given radius
+	///
+	/// @see gtc_random
+	GLM_FUNC_DECL void ballRand(float Radius, vec<3, float, defaultp>* Out, std::size_t Count);
+
 	/// @}
 }//namespace glm
 
@@ -2,63 +2,84 @@
 #include "../exponential.hpp"
 #include "../trigonometric.hpp"
 #include "../detail/type_vec1.hpp"
-#include <cstdlib>
-#include <ctime>
 #include <cassert>
 #include <cmath>
+#if GLM_LANG & GLM_LANG_CXX11_FLAG
+#	include <atomic>
+#endif
 
 namespace glm{
 namespace detail
 {
-	template <length_t L, typename T, qualifier Q>
-	struct compute_rand
+	GLM_FUNC_QUALIFIER uint64 splitmix64(uint64& State)
 	{
-		GLM_FUNC_QUALIFIER static vec<L, T, Q> call();
-	};
+		uint64 z = (State += 0x9e3779b97f4a7c15ull);
+		z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+		z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+		return z ^ (z >> 31);
+	}
 
-	template <qualifier P>
-	struct compute_rand<1, uint8, P>
+	GLM_FUNC_QUALIFIER uint32 rotl(uint32 x, int k)
 	{
-		GLM_FUNC_QUALIFIER static vec<1, uint8, P> call()
-		{
-			return vec<1, uint8, P>(
-				std::rand() % std::numeric_limits<uint8>::max());
-		}
-	};
+		return (x << k) | (x >> (32 - k));
+	}
 
-	template <qualifier P>
-	struct compute_rand<2, uint8, P>
+	// Number of engines the bulk functions run side by side, one per SIMD lane
+#	if GLM_CONFIG_SIMD == GLM_ENABLE && (GLM_ARCH & GLM_ARCH_AVX2_BIT)
+	static length_t const random_lane_count = 8;
+#	elif GLM_CONFIG_SIMD == GLM_ENABLE && (GLM_ARCH & GLM_ARCH_SSE2_BIT)
+	static length_t const random_lane_count = 4;
+#	else
+	static length_t const random_lane_count = 1;
+#	endif
+
+	// Per thread engines: the scalar one and, seeded from it on first use, the bulk functions' lanes stored word by word
+	struct random_thread_state
 	{
-		GLM_FUNC_QUALIFIER static vec<2, uint8, P> call()
-		{
-			return vec<2, uint8, P>(
-				std::rand() % std::numeric_limits<uint8>::max(),
-				std::rand() % std::numeric_limits<uint8>::max());
-		}
+		xoshiro128 Engine;
+		uint32 Lanes[4][random_lane_count];
+		bool LanesSeeded;
 	};
 
-	template <qualifier P>
-	struct compute_rand<3, uint8, P>
+	GLM_FUNC_QUALIFIER uint64 nextThreadSeed()
 	{
-		GLM_FUNC_QUALIFIER static vec<3, uint8, P> call()
-		{
-			return vec<3, uint8, P>(
-				std::rand() % std::numeric_limits<uint8>::max(),
-				std::rand() % std::numeric_limits<uint8>::max(),
-				std::rand() % std::numeric_limits<uint8>::max());
-		}
+#		if GLM_LANG & GLM_LANG_CXX11_FLAG
+			static std::atomic<uint64> Counter(0);
+			uint64 Index = Counter.fetch_add(1);
+#		else
+			static uint64 Counter = 0;
+			uint64 Index = Counter++;
+#		endif
+		return splitmix64(Index);
+	}
+
+	GLM_FUNC_QUALIFIER random_thread_state& randomThreadState()
+	{
+#		if GLM_LANG & GLM_LANG_CXX11_FLAG
+			static thread_local random_thread_state State = {xoshiro128(nextThreadSeed()), {{0}}, false};
+#		else
+			static random_thread_state State = {xoshiro128(nextThreadSeed()), {{0}}, false};
+#		endif
+		return State;
+	}
+
+	template <length_t L, typename T, qualifier Q>
+	struct compute_rand
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call();
 	};
 
-	template <qualifier P>
-	struct compute_rand<4, uint8, P>
+	// uint8, uint16 and uint32 take the high bits of one engine output per component
+	template <length_t L, qualifier Q>
+	struct compute_rand<L, uint8, Q>
 	{
-		GLM_FUNC_QUALIFIER static vec<4, uint8, P> call()
+		GLM_FUNC_QUALIFIER static vec<L, uint8, Q> call()
 		{
-			return vec<4, uint8, P>(
-				std::rand() % std::numeric_limits<uint8>::max(),
-				std::rand() % std::numeric_limits<uint8>::max(),
-				std::rand() % std::numeric_limits<uint8>::max(),
-				std::rand() % std::numeric_limits<uint8>::max());
+			xoshiro128& Engine = randEngine();
+			vec<L, uint8, Q> Result;
+			for(length_t i = 0; i < L; ++i)
+				Result[i] = static_cast<uint8>(Engine() >> 24);
+			return Result;
 		}
 	};
 
@@ -67,9 +88,11 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static vec<L, uint16, Q> call()
 		{
-			return
-				(vec<L, uint16, Q>(compute_rand<L, uint8, Q>::call()) << static_cast<uint16>(8)) |
-				(vec<L, uint16, Q>(compute_rand<L, uint8, Q>::call()) << static_cast<uint16>(0));
+			xoshiro128& Engine = randEngine();
+			vec<L, uint16, Q> Result;
+			for(length_t i = 0; i < L; ++i)
+				Result[i] = static_cast<uint16>(Engine() >> 16);
+			return Result;
 		}
 	};
 
@@ -78,9 +101,11 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static vec<L, uint32, Q> call()
 		{
-			return
-				(vec<L, uint32, Q>(compute_rand<L, uint16, Q>::call()) << static_cast<uint32>(16)) |
-				(vec<L, uint32, Q>(compute_rand<L, uint16, Q>::call()) << static_cast<uint32>(0));
+			xoshiro128& Engine = randEngine();
+			vec<L, uint32, Q> Result;
+			for(length_t i = 0; i < L; ++i)
+				Result[i] = Engine();
+			return Result;
 		}
 	};
 
@@ -199,7 +224,176 @@ namespace detail
 			return vec<L, long double, Q>(compute_rand<L, uint64, Q>::call()) / static_cast<long double>(std::numeric_limits<uint64>::max()) * (Max - Min) + Min;
 		}
 	};
+	// [0, 1) from the high 24 bits of an engine output, every value exactly representable
+	GLM_FUNC_QUALIFIER float unitRand(uint32 Bits)
+	{
+		return static_cast<float>(Bits >> 8) * (1.0f / 16777216.0f);
+	}
+
+	// Lanes of the bulk functions, simd is false when they run as one scalar engine
+	template<length_t L>
+	struct random_packet
+	{
+		static bool const simd = false;
+	};
+
+	// Bulk fills with the thread's scalar engine
+	template<length_t L, bool Simd = random_packet<L>::simd>
+	struct compute_random_fill
+	{
+		GLM_FUNC_QUALIFIER static void linear(float Min, float Max, float* Out, std::size_t Count)
+		{
+			xoshiro128& Engine = randEngine();
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = Min + unitRand(Engine()) * (Max - Min);
+		}
+
+		// Box-Muller, both outputs of a pair are used
+		GLM_FUNC_QUALIFIER static void gauss(float Mean, float Deviation, float* Out, std::size_t Count)
+		{
+			xoshiro128& Engine = randEngine();
+			for(std::size_t i = 0; i < Count; i += 2)
+			{
+				float const Radius = std::sqrt(-2.0f * std::log(1.0f - unitRand(Engine())));
+				float const Angle = 6.283185307179586476925286766559f * unitRand(Engine());
+				Out[i] = Mean + Deviation * Radius * std::cos(Angle);
+				if(i + 1 < Count)
+					Out[i + 1] = Mean + Deviation * Radius * std::sin(Angle);
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void circular(float Radius, vec<2, float, defaultp>* Out, std::size_t Count)
+		{
+			xoshiro128& Engine = randEngine();
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				float const Angle = 6.283185307179586476925286766559f * unitRand(Engine());
+				Out[i] = vec<2, float, defaultp>(std::cos(Angle), std::sin(Angle)) * Radius;
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void spherical(float Radius, vec<3, float, defaultp>* Out, std::size_t Count)
+		{
+			xoshiro128& Engine = randEngine();
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				float const z = 2.0f * unitRand(Engine()) - 1.0f;
+				float const r = std::sqrt(1.0f - z * z);
+				float const Angle = 6.283185307179586476925286766559f * unitRand(Engine());
+				Out[i] = vec<3, float, defaultp>(r * std::cos(Angle), r * std::sin(Angle), z) * Radius;
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void disk(float Radius, vec<2, float, defaultp>* Out, std::size_t Count)
+		{
+			xoshiro128& Engine = randEngine();
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				float const r = Radius * std::sqrt(unitRand(Engine()));
+				float const Angle = 6.283185307179586476925286766559f * unitRand(Engine());
+				Out[i] = vec<2, float, defaultp>(r * std::cos(Angle), r * std::sin(Angle));
+			}
+		}
+
+		// Rejection from the enclosing cube, about 52% of the candidates are kept
+		GLM_FUNC_QUALIFIER static void ball(float Radius, vec<3, float, defaultp>* Out, std::size_t Count)
+		{
+			xoshiro128& Engine = randEngine();
+			for(std::size_t i = 0; i < Count;)
+			{
+				vec<3, float, defaultp> const p(2.0f * unitRand(Engine()) - 1.0f, 2.0f * unitRand(Engine()) - 1.0f, 2.0f * unitRand(Engine()) - 1.0f);
+				if(dot(p, p) <= 1.0f)
+					Out[i++] = p * Radius;
+			}
+		}
+	};
 }//namespace detail
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "random_simd.inl"
+#endif
+
+namespace glm
+{
+	GLM_FUNC_QUALIFIER xoshiro128::xoshiro128(uint64 Seed)
+	{
+		seed(Seed);
+	}
+
+	GLM_FUNC_QUALIFIER void xoshiro128::seed(uint64 Seed)
+	{
+		uint64 const a = detail::splitmix64(Seed);
+		uint64 const b = detail::splitmix64(Seed);
+		State[0] = static_cast<uint32>(a);
+		State[1] = static_cast<uint32>(a >> 32);
+		State[2] = static_cast<uint32>(b);
+		State[3] = static_cast<uint32>(b >> 32);
+	}
+
+	GLM_FUNC_QUALIFIER uint32 xoshiro128::operator()()
+	{
+		uint32 const Result = detail::rotl(State[1] * 5, 7) * 9;
+		uint32 const t = State[1] << 9;
+		State[2] ^= State[0];
+		State[3] ^= State[1];
+		State[1] ^= State[2];
+		State[0] ^= State[3];
+		State[2] ^= t;
+		State[3] = detail::rotl(State[3], 11);
+		return Result;
+	}
+
+	GLM_FUNC_QUALIFIER void xoshiro128::jump()
+	{
+		static uint32 const Jump[] = {0x8764000b, 0xf542d2d3, 0x6fa035c3, 0x77f2db5b};
+		uint32 s[4] = {0, 0, 0, 0};
+		for(int i = 0; i < 4; ++i)
+			for(int b = 0; b < 32; ++b)
+			{
+				if(Jump[i] & (1u << b))
+					for(int j = 0; j < 4; ++j)
+						s[j] ^= State[j];
+				(*this)();
+			}
+		for(int j = 0; j < 4; ++j)
+			State[j] = s[j];
+	}
+
+	GLM_FUNC_QUALIFIER pcg32::pcg32(uint64 Seed, uint64 Stream)
+	{
+		seed(Seed, Stream);
+	}
+
+	GLM_FUNC_QUALIFIER void pcg32::seed(uint64 Seed, uint64 Stream)
+	{
+		State = 0;
+		Increment = (Stream << 1) | 1;
+		(*this)();
+		State += Seed;
+		(*this)();
+	}
+
+	GLM_FUNC_QUALIFIER uint32 pcg32::operator()()
+	{
+		uint64 const Old = State;
+		State = Old * 6364136223846793005ull + Increment;
+		uint32 const XorShifted = static_cast<uint32>(((Old >> 18) ^ Old) >> 27);
+		uint32 const Rot = static_cast<uint32>(Old >> 59);
+		return (XorShifted >> Rot) | (XorShifted << ((32 - Rot) & 31));
+	}
+
+	GLM_FUNC_QUALIFIER xoshiro128& randEngine()
+	{
+		return detail::randomThreadState().Engine;
+	}
+
+	GLM_FUNC_QUALIFIER void randSeed(uint64 Seed)
+	{
+		detail::random_thread_state& State = detail::randomThreadState();
+		State.Engine.seed(Seed);
+		State.LanesSeeded = false;
+	}
 
 	template<typename genType>
 	GLM_FUNC_QUALIFIER genType linearRand(genType Min, genType Max)
@@ -300,4 +494,33 @@ namespace detail
 
 		return vec<3, T, defaultp>(x, y, z) * Radius;
 	}
+	GLM_FUNC_QUALIFIER void linearRand(float Min, float Max, float* Out, std::size_t Count)
+	{
+		detail::compute_random_fill<detail::random_lane_count>::linear(Min, Max, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void gaussRand(float Mean, float Deviation, float* Out, std::size_t Count)
+	{
+		detail::compute_random_fill<detail::random_lane_count>::gauss(Mean, Deviation, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void circularRand(float Radius, vec<2, float, defaultp>* Out, std::size_t Count)
+	{
+		detail::compute_random_fill<detail::random_lane_count>::circular(Radius, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void sphericalRand(float Radius, vec<3, float, defaultp>* Out, std::size_t Count)
+	{
+		detail::compute_random_fill<detail::random_lane_count>::spherical(Radius, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void diskRand(float Radius, vec<2, float, defaultp>* Out, std::size_t Count)
+	{
+		detail::compute_random_fill<detail::random_lane_count>::disk(Radius, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void ballRand(float Radius, vec<3, float, defaultp>* Out, std::size_t Count)
+	{
+		detail::compute_random_fill<detail::random_lane_count>::ball(Radius, Out, Count);
+	}
 }//namespace glm
@@ -0,0 +1,328 @@
+/// @ref gtc_random
+/// @file glm/gtc/random_simd.inl
+
+#include "../detail/_float_packet.hpp"
+
+namespace glm{
+namespace detail
+{
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template<>
+	struct random_packet<4> : public float_packet<4>
+	{
+		typedef __m128i bits;
+
+		GLM_FUNC_QUALIFIER static bits load_bits(uint32 const* p) { return _mm_loadu_si128(reinterpret_cast<__m128i const*>(p)); }
+		GLM_FUNC_QUALIFIER static void store_bits(uint32* p, bits v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+		GLM_FUNC_QUALIFIER static bits set1_bits(uint32 s) { return _mm_set1_epi32(static_cast<int>(s)); }
+		GLM_FUNC_QUALIFIER static bits add_bits(bits a, bits b) { return _mm_add_epi32(a, b); }
+		GLM_FUNC_QUALIFIER static bits sub_bits(bits a, bits b) { return _mm_sub_epi32(a, b); }
+		GLM_FUNC_QUALIFIER static bits and_bits(bits a, bits b) { return _mm_and_si128(a, b); }
+		GLM_FUNC_QUALIFIER static bits or_bits(bits a, bits b) { return _mm_or_si128(a, b); }
+		GLM_FUNC_QUALIFIER static bits xor_bits(bits a, bits b) { return _mm_xor_si128(a, b); }
+		template<int N>
+		GLM_FUNC_QUALIFIER static bits shl(bits a) { return _mm_slli_epi32(a, N); }
+		template<int N>
+		GLM_FUNC_QUALIFIER static bits shr(bits a) { return _mm_srli_epi32(a, N); }
+		// Exact for values below 2^24
+		GLM_FUNC_QUALIFIER static type to_float(bits a) { return _mm_cvtepi32_ps(a); }
+		GLM_FUNC_QUALIFIER static bits as_bits(type a) { return _mm_castps_si128(a); }
+		GLM_FUNC_QUALIFIER static type as_float(bits a) { return _mm_castsi128_ps(a); }
+	};
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	template<>
+	struct random_packet<8> : public float_packet<8>
+	{
+		typedef __m256i bits;
+
+		GLM_FUNC_QUALIFIER static bits load_bits(uint32 const* p) { return _mm256_loadu_si256(reinterpret_cast<__m256i const*>(p)); }
+		GLM_FUNC_QUALIFIER static void store_bits(uint32* p, bits v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+		GLM_FUNC_QUALIFIER static bits set1_bits(uint32 s) { return _mm256_set1_epi32(static_cast<int>(s)); }
+		GLM_FUNC_QUALIFIER static bits add_bits(bits a, bits b) { return _mm256_add_epi32(a, b); }
+		GLM_FUNC_QUALIFIER static bits sub_bits(bits a, bits b) { return _mm256_sub_epi32(a, b); }
+		GLM_FUNC_QUALIFIER static bits and_bits(bits a, bits b) { return _mm256_and_si256(a, b); }
+		GLM_FUNC_QUALIFIER static bits or_bits(bits a, bits b) { return _mm256_or_si256(a, b); }
+		GLM_FUNC_QUALIFIER static bits xor_bits(bits a, bits b) { return _mm256_xor_si256(a, b); }
+		template<int N>
+		GLM_FUNC_QUALIFIER static bits shl(bits a) { return _mm256_slli_epi32(a, N); }
+		template<int N>
+		GLM_FUNC_QUALIFIER static bits shr(bits a) { return _mm256_srli_epi32(a, N); }
+		GLM_FUNC_QUALIFIER static type to_float(bits a) { return _mm256_cvtepi32_ps(a); }
+		GLM_FUNC_QUALIFIER static bits as_bits(type a) { return _mm256_castps_si256(a); }
+		GLM_FUNC_QUALIFIER static type as_float(bits a) { return _mm256_castsi256_ps(a); }
+	};
+#	endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+	// Bulk fills with one xoshiro128** engine per lane, the lane states live in the thread's random_thread_state
+	template<length_t L>
+	struct compute_random_fill<L, true>
+	{
+		typedef random_packet<L> P;
+		typedef typename P::type V;
+		typedef typename P::bits B;
+
+		struct lanes
+		{
+			B s0, s1, s2, s3;
+		};
+
+		// Loads the calling thread's lanes, seeding them from its scalar engine the first time
+		GLM_FUNC_QUALIFIER static lanes begin()
+		{
+			random_thread_state& State = randomThreadState();
+			if(!State.LanesSeeded)
+			{
+				for(length_t i = 0; i < L; ++i)
+				{
+					uint64 const High = State.Engine();
+					uint64 const Seed = (High << 32) | State.Engine();
+					xoshiro128 const Lane(Seed);
+					for(int j = 0; j < 4; ++j)
+						State.Lanes[j][i] = Lane.State[j];
+				}
+				State.LanesSeeded = true;
+			}
+			lanes Lanes;
+			Lanes.s0 = P::load_bits(State.Lanes[0]);
+			Lanes.s1 = P::load_bits(State.Lanes[1]);
+			Lanes.s2 = P::load_bits(State.Lanes[2]);
+			Lanes.s3 = P::load_bits(State.Lanes[3]);
+			return Lanes;
+		}
+
+		GLM_FUNC_QUALIFIER static void end(lanes const& Lanes)
+		{
+			random_thread_state& State = randomThreadState();
+			P::store_bits(State.Lanes[0], Lanes.s0);
+			P::store_bits(State.Lanes[1], Lanes.s1);
+			P::store_bits(State.Lanes[2], Lanes.s2);
+			P::store_bits(State.Lanes[3], Lanes.s3);
+		}
+
+		template<int K>
+		GLM_FUNC_QUALIFIER static B rotl(B x)
+		{
+			return P::or_bits(P::template shl<K>(x), P::template shr<32 - K>(x));
+		}
+
+		// xoshiro128** step, the multiplications by 5 and 9 done as shift and add
+		GLM_FUNC_QUALIFIER static B next(lanes& S)
+		{
+			B const Scaled = P::add_bits(P::template shl<2>(S.s1), S.s1);
+			B const Rotated = rotl<7>(Scaled);
+			B const Result = P::add_bits(P::template shl<3>(Rotated), Rotated);
+			B const t = P::template shl<9>(S.s1);
+			S.s2 = P::xor_bits(S.s2, S.s0);
+			S.s3 = P::xor_bits(S.s3, S.s1);
+			S.s1 = P::xor_bits(S.s1, S.s2);
+			S.s0 = P::xor_bits(S.s0, S.s3);
+			S.s2 = P::xor_bits(S.s2, t);
+			S.s3 = rotl<11>(S.s3);
+			return Result;
+		}
+
+		// [0, 1), same mapping as unitRand
+		GLM_FUNC_QUALIFIER static V unit(B Bits)
+		{
+			return P::mul(P::to_float(P::template shr<8>(Bits)), P::set1(1.0f / 16777216.0f));
+		}
+
+		// A point uniformly distributed on the unit circle. The high 24 bits give an angle within one quadrant,
+		// in [-pi/4, pi/4) so the cephes sinf/cosf polynomials apply directly, the low 2 bits rotate it into
+		// one of the four quadrants.
+		GLM_FUNC_QUALIFIER static void circle(B Bits, V& c, V& s)
+		{
+			V const a = P::mul(P::sub(unit(Bits), P::set1(0.5f)), P::set1(1.5707963267948966f));
+			V const z = P::mul(a, a);
+			V const Sin = P::add(P::mul(P::mul(P::sub(P::mul(P::add(P::mul(P::set1(-1.9515295891e-4f), z), P::set1(8.3321608736e-3f)), z), P::set1(1.6666654611e-1f)), z), a), a);
+			V const Cos = P::add(P::sub(P::set1(1.0f), P::mul(P::set1(0.5f), z)),
+				P::mul(P::mul(z, z), P::add(P::mul(P::sub(P::mul(P::set1(2.443315711809948e-5f), z), P::set1(1.388731625493765e-3f)), z), P::set1(4.166664568298827e-2f))));
+
+			// quadrant 1 is (-sin, cos), 2 negates quadrant 0, 3 negates quadrant 1
+			B const One = P::set1_bits(1);
+			V const Odd = P::as_float(P::sub_bits(P::set1_bits(0), P::and_bits(Bits, One)));
+			V const Negate = P::as_float(P::template shl<31>(P::template shr<1>(Bits)));
+			c = P::xor_(P::select(Odd, P::xor_(Sin, P::set1(-0.0f)), Cos), Negate);
+			s = P::xor_(P::select(Odd, Cos, Sin), Negate);
+		}
+
+		// Natural logarithm of positive normal floats, cephes logf: split off the exponent, then a polynomial on
+		// the mantissa in [sqrt(1/2) - 1, sqrt(2) - 1]. Within 1 ulp of the exact result on (0, 1], the range Box-Muller uses.
+		GLM_FUNC_QUALIFIER static V log(V x)
+		{
+			B const Bits = P::as_bits(x);
+			V e = P::to_float(P::sub_bits(P::template shr<23>(Bits), P::set1_bits(126)));
+			V m = P::as_float(P::or_bits(P::and_bits(Bits, P::set1_bits(0x007fffff)), P::set1_bits(0x3f000000)));
+
+			V const One = P::set1(1.0f);
+			V const Small = P::cmp_lt(m, P::set1(0.707106781186547524f));
+			e = P::sub(e, P::and_(Small, One));
+			m = P::add(P::sub(m, One), P::and_(Small, m));
+
+			V const z = P::mul(m, m);
+			V y = P::set1(7.0376836292e-2f);
+			y = P::add(P::mul(y, m), P::set1(-1.1514610310e-1f));
+			y = P::add(P::mul(y, m), P::set1(1.1676998740e-1f));
+			y = P::add(P::mul(y, m), P::set1(-1.2420140846e-1f));
+			y = P::add(P::mul(y, m), P::set1(1.4249322787e-1f));
+			y = P::add(P::mul(y, m), P::set1(-1.6668057665e-1f));
+			y = P::add(P::mul(y, m), P::set1(2.0000714765e-1f));
+			y = P::add(P::mul(y, m), P::set1(-2.4999993993e-1f));
+			y = P::add(P::mul(y, m), P::set1(3.3333331174e-1f));
+			y = P::mul(P::mul(y, m), z);
+			y = P::add(y, P::mul(e, P::set1(-2.12194440e-4f)));
+			y = P::sub(y, P::mul(P::set1(0.5f), z));
+			return P::add(P::add(m, y), P::mul(e, P::set1(0.693359375f)));
+		}
+
+		// Writes the first Count lanes of x, y (and z) as vectors
+		GLM_FUNC_QUALIFIER static void store(vec<2, float, defaultp>* Out, std::size_t Count, V x, V y)
+		{
+			float X[L], Y[L];
+			P::store(X, x);
+			P::store(Y, y);
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = vec<2, float, defaultp>(X[i], Y[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void store(vec<3, float, defaultp>* Out, std::size_t Count, V x, V y, V z)
+		{
+			float X[L], Y[L], Z[L];
+			P::store(X, x);
+			P::store(Y, y);
+			P::store(Z, z);
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = vec<3, float, defaultp>(X[i], Y[i], Z[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void store(float* Out, std::size_t Count, V x)
+		{
+			if(Count == L)
+			{
+				P::store(Out, x);
+				return;
+			}
+			float X[L];
+			P::store(X, x);
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = X[i];
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t remaining(std::size_t i, std::size_t Count)
+		{
+			return Count - i < L ? Count - i : L;
+		}
+
+		GLM_FUNC_QUALIFIER static void linear(float Min, float Max, float* Out, std::size_t Count)
+		{
+			lanes Lanes = begin();
+			V const Base = P::set1(Min);
+			V const Range = P::set1(Max - Min);
+			for(std::size_t i = 0; i < Count; i += L)
+				store(Out + i, remaining(i, Count), P::add(Base, P::mul(unit(next(Lanes)), Range)));
+			end(Lanes);
+		}
+
+		// Box-Muller, each step writes L cosine outputs followed by L sine outputs
+		GLM_FUNC_QUALIFIER static void gauss(float Mean, float Deviation, float* Out, std::size_t Count)
+		{
+			lanes Lanes = begin();
+			V const Center = P::set1(Mean);
+			V const Scale = P::set1(Deviation);
+			for(std::size_t i = 0; i < Count; i += 2 * L)
+			{
+				V const u = P::sub(P::set1(1.0f), unit(next(Lanes)));
+				V const r = P::mul(Scale, P::sqrt(P::mul(P::set1(-2.0f), log(u))));
+				V c, s;
+				circle(next(Lanes), c, s);
+				store(Out + i, remaining(i, Count), P::add(Center, P::mul(r, c)));
+				if(i + L < Count)
+					store(Out + i + L, remaining(i + L, Count), P::add(Center, P::mul(r, s)));
+			}
+			end(Lanes);
+		}
+
+		GLM_FUNC_QUALIFIER static void circular(float Radius, vec<2, float, defaultp>* Out, std::size_t Count)
+		{
+			lanes Lanes = begin();
+			V const r = P::set1(Radius);
+			for(std::size_t i = 0; i < Count; i += L)
+			{
+				V c, s;
+				circle(next(Lanes), c, s);
+				store(Out + i, remaining(i, Count), P::mul(c, r), P::mul(s, r));
+			}
+			end(Lanes);
+		}
+
+		// z uniform in [-1, 1) with a uniform angle around it covers the sphere uniformly (Archimedes)
+		GLM_FUNC_QUALIFIER static void spherical(float Radius, vec<3, float, defaultp>* Out, std::size_t Count)
+		{
+			lanes Lanes = begin();
+			V const One = P::set1(1.0f);
+			V const Scale = P::set1(Radius);
+			for(std::size_t i = 0; i < Count; i += L)
+			{
+				V const z = P::sub(P::mul(P::set1(2.0f), unit(next(Lanes))), One);
+				V const r = P::mul(Scale, P::sqrt(P::max(P::sub(One, P::mul(z, z)), P::set1(0.0f))));
+				V c, s;
+				circle(next(Lanes), c, s);
+				store(Out + i, remaining(i, Count), P::mul(r, c), P::mul(r, s), P::mul(Scale, z));
+			}
+			end(Lanes);
+		}
+
+		GLM_FUNC_QUALIFIER static void disk(float Radius, vec<2, float, defaultp>* Out, std::size_t Count)
+		{
+			lanes Lanes = begin();
+			V const Scale = P::set1(Radius);
+			for(std::size_t i = 0; i < Count; i += L)
+			{
+				V const r = P::mul(Scale, P::sqrt(unit(next(Lanes))));
+				V c, s;
+				circle(next(Lanes), c, s);
+				store(Out + i, remaining(i, Count), P::mul(r, c), P::mul(r, s));
+			}
+			end(Lanes);
+		}
+
+		// Rejection from the enclosing cube, lanes outside the ball are dropped when storing
+		GLM_FUNC_QUALIFIER static void ball(float Radius, vec<3, float, defaultp>* Out, std::size_t Count)
+		{
+			lanes Lanes = begin();
+			V const One = P::set1(1.0f);
+			V const Two = P::set1(2.0f);
+			float X[L], Y[L], Z[L];
+			std::size_t i = 0;
+			while(i < Count)
+			{
+				V const x = P::sub(P::mul(Two, unit(next(Lanes))), One);
+				V const y = P::sub(P::mul(Two, unit(next(Lanes))), One);
+				V const z = P::sub(P::mul(Two, unit(next(Lanes))), One);
+				int Inside = P::movemask(P::cmp_le(P::add(P::add(P::mul(x, x), P::mul(y, y)), P::mul(z, z)), One));
+				P::store(X, x);
+				P::store(Y, y);
+				P::store(Z, z);
+				if(i + L <= Count)
+				{
+					// Branchless: every lane is written, only the ones inside advance the output
+					for(length_t l = 0; l < L; ++l)
+					{
+						Out[i] = vec<3, float, defaultp>(X[l], Y[l], Z[l]) * Radius;
+						i += (Inside >> l) & 1;
+					}
+				}
+				else
+				{
+					for(length_t l = 0; l < L && i < Count; ++l)
+						if(Inside & (1 << l))
+							Out[i++] = vec<3, float, defaultp>(X[l], Y[l], Z[l]) * Radius;
+				}
+			}
+			end(Lanes);
+		}
+	};
+}//namespace detail
+}//namespace glm
@@ -0,0 +1,76 @@
+/// @ref gtx_easing_array
+/// @file glm/gtx/easing_array.hpp
+///
+/// @see core (dependence)
+/// @see gtx_easing (dependence)
+/// @see gtx_spline_array
+///
+/// @defgroup gtx_easing_array GLM_GTX_easing_array
+/// @ingroup gtx
+///
+/// Include <glm/gtx/easing_array.hpp> to use the features of this extension.
+///
+/// One GLM_GTX_easing function applied to a whole array of parameters in [0, 1], as the interpolation factors of
+/// animation tracks before their curves are evaluated. The SIMD paths handle 8 parameters per AVX register and 4 per
+/// SSE2 register; the last few, and every parameter without SIMD, go through the GLM_GTX_easing functions.
+/// The polynomial, circular and back easings round like those up to the order of the operations, the sine easings
+/// evaluate sin with a polynomial within 1e-7. The exponential, elastic and bounce easings have no kernel.
+/// With GLM_CONFIG_SIMD_DISPATCH a build for a narrower GLM_ARCH still runs the AVX2 kernels on CPUs that have AVX2,
+/// see GLM_GTX_simd_dispatch.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtx/easing.hpp"
+#include "../detail/_float_packet.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_easing_array is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	else
+#		pragma message("GLM: GLM_GTX_easing_array extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_easing_array
+	/// @{
+
+	/// The GLM_GTX_easing functions easeArray applies.
+	enum easing_function
+	{
+		easing_linear,				///< linearInterpolation
+		easing_quadratic_in,		///< quadraticEaseIn
+		easing_quadratic_out,		///< quadraticEaseOut
+		easing_quadratic_in_out,	///< quadraticEaseInOut
+		easing_cubic_in,			///< cubicEaseIn
+		easing_cubic_out,			///< cubicEaseOut
+		easing_cubic_in_out,		///< cubicEaseInOut
+		easing_quartic_in,			///< quarticEaseIn
+		easing_quartic_out,			///< quarticEaseOut
+		easing_quartic_in_out,		///< quarticEaseInOut
+		easing_quintic_in,			///< quinticEaseIn
+		easing_quintic_out,			///< quinticEaseOut
+		easing_quintic_in_out,		///< quinticEaseInOut
+		easing_sine_in,				///< sineEaseIn
+		easing_sine_out,			///< sineEaseOut
+		easing_sine_in_out,			///< sineEaseInOut
+		easing_circular_in,			///< circularEaseIn
+		easing_circular_out,		///< circularEaseOut
+		easing_circular_in_out,		///< circularEaseInOut
+		easing_back_in,				///< backEaseIn
+		easing_back_out,			///< backEaseOut
+		easing_back_in_out			///< backEaseInOut
+	};
+
+	/// out[i] = function(a[i]) for count parameters in [0, 1]. out may be a.
+	/// From GLM_GTX_easing_array extension.
+	GLM_FUNC_DECL void easeArray(easing_function function, float const* a, float* out, std::size_t count);
+
+	/// @}
+}//namespace glm
+
+#include "easing_array.inl"
@@ -0,0 +1,78 @@
+/// @ref gtx_easing_array
+
+namespace glm{
+namespace detail
+{
+#	include "easing_array_simd.inl"
+
+#	if GLM_SIMD_DISPATCH_AVX2
+	GLM_SIMD_TARGET_AVX2_BEGIN
+	namespace avx2
+	{
+#	include "easing_array_simd.inl"
+	}//namespace avx2
+	GLM_SIMD_TARGET_END
+#	endif//GLM_SIMD_DISPATCH_AVX2
+
+	typedef compute_easing_array<float_packet_width> easing_array;
+
+	// One entry per simd_dispatch tier. There is no 16 lane float_packet, AVX-512 CPUs run the AVX2 kernels
+	struct easing_array_kernels
+	{
+		std::size_t (*ease)(std::size_t, int, float const*, float*);
+	};
+
+	GLM_FUNC_QUALIFIER easing_array_kernels const& easing_array_dispatch()
+	{
+#		if GLM_SIMD_DISPATCH_AVX2
+		typedef avx2::compute_easing_array<avx2::float_packet_width> easing_array_avx2;
+#		else
+		typedef easing_array easing_array_avx2;
+#		endif
+		static easing_array_kernels const Tiers[] =
+		{
+			{&easing_array::ease},
+			{&easing_array_avx2::ease},
+			{&easing_array_avx2::ease}
+		};
+		return Tiers[simd_dispatch_current()];
+	}
+
+	GLM_FUNC_QUALIFIER float ease(easing_function function, float a)
+	{
+		switch(function)
+		{
+		default:
+		case easing_linear: return linearInterpolation(a);
+		case easing_quadratic_in: return quadraticEaseIn(a);
+		case easing_quadratic_out: return quadraticEaseOut(a);
+		case easing_quadratic_in_out: return quadraticEaseInOut(a);
+		case easing_cubic_in: return cubicEaseIn(a);
+		case easing_cubic_out: return cubicEaseOut(a);
+		case easing_cubic_in_out: return cubicEaseInOut(a);
+		case easing_quartic_in: return quarticEaseIn(a);
+		case easing_quartic_out: return quarticEaseOut(a);
+		case easing_quartic_in_out: return quarticEaseInOut(a);
+		case easing_quintic_in: return quinticEaseIn(a);
+		case easing_quintic_out: return quinticEaseOut(a);
+		case easing_quintic_in_out: return quinticEaseInOut(a);
+		case easing_sine_in: return sineEaseIn(a);
+		case easing_sine_out: return sineEaseOut(a);
+		case easing_sine_in_out: return sineEaseInOut(a);
+		case easing_circular_in: return circularEaseIn(a);
+		case easing_circular_out: return circularEaseOut(a);
+		case easing_circular_in_out: return circularEaseInOut(a);
+		case easing_back_in: return backEaseIn(a);
+		case easing_back_out: return backEaseOut(a);
+		case easing_back_in_out: return backEaseInOut(a);
+		}
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void easeArray(easing_function function, float const* a, float* out, std::size_t count)
+	{
+		std::size_t i = detail::easing_array_dispatch().ease(count, function, a, out);
+		for(; i < count; ++i)
+			out[i] = detail::ease(function, a[i]);
+	}
+}//namespace glm
@@ -0,0 +1,153 @@
+/// @ref gtx_easing_array
+/// Included once per kernel tier, inside that tier's namespace
+
+	// Scalar fallback, the caller runs every parameter through the GLM_GTX_easing functions. ease handles a prefix of
+	// the array and returns its length, function is an easing_function
+	template<length_t L, bool Simd = float_packet<L>::simd>
+	struct compute_easing_array
+	{
+		GLM_FUNC_QUALIFIER static std::size_t ease(std::size_t, int, float const*, float*) { return 0; }
+	};
+
+#	if GLM_CONFIG_SIMD == GLM_ENABLE
+	template<length_t L>
+	struct compute_easing_array<L, true>
+	{
+		typedef float_packet<L> P;
+		typedef typename P::type V;
+
+		// sin(x) for x in [0, pi / 2], Taylor series to x^11, within 6e-8
+		GLM_FUNC_QUALIFIER static V sin_quarter(V x)
+		{
+			V const x2 = P::mul(x, x);
+			V Poly = P::set1(-2.5052108e-8f);
+			Poly = P::add(P::mul(Poly, x2), P::set1(2.7557319e-6f));
+			Poly = P::add(P::mul(Poly, x2), P::set1(-1.9841270e-4f));
+			Poly = P::add(P::mul(Poly, x2), P::set1(8.3333333e-3f));
+			Poly = P::add(P::mul(Poly, x2), P::set1(-1.6666667e-1f));
+			return P::add(x, P::mul(P::mul(x, x2), Poly));
+		}
+
+		// The in out easings run the in half below 0.5 and the out half above
+		GLM_FUNC_QUALIFIER static V halves(V a, V In, V Out)
+		{
+			return P::select(P::cmp_lt(a, P::set1(0.5f)), In, Out);
+		}
+
+		template<int Function>
+		GLM_FUNC_QUALIFIER static V apply(V a)
+		{
+			V const One = P::set1(1.0f);
+			V const Two = P::set1(2.0f);
+			V const Half = P::set1(0.5f);
+			V const Back = P::set1(1.70158f);
+			V const a2 = P::mul(a, a);
+			V const f = P::sub(a, One);
+			V const g = P::sub(P::mul(Two, a), Two);
+			switch(Function)
+			{
+			default:
+			case easing_linear:
+				return a;
+			case easing_quadratic_in:
+				return a2;
+			case easing_quadratic_out:
+				return P::mul(a, P::sub(Two, a));
+			case easing_quadratic_in_out:
+				return halves(a, P::mul(Two, a2), P::sub(P::sub(P::mul(P::set1(4.0f), a), P::mul(Two, a2)), One));
+			case easing_cubic_in:
+				return P::mul(a2, a);
+			case easing_cubic_out:
+				return P::add(P::mul(P::mul(f, f), f), One);
+			case easing_cubic_in_out:
+				return halves(a, P::mul(P::set1(4.0f), P::mul(a2, a)), P::add(P::mul(Half, P::mul(P::mul(g, g), g)), One));
+			case easing_quartic_in:
+				return P::mul(a2, a2);
+			case easing_quartic_out:
+				return P::add(P::mul(P::mul(P::mul(f, f), f), P::sub(One, a)), One);
+			case easing_quartic_in_out:
+				return halves(a, P::mul(P::set1(8.0f), P::mul(a2, a2)), P::sub(One, P::mul(P::set1(8.0f), P::mul(P::mul(f, f), P::mul(f, f)))));
+			case easing_quintic_in:
+				return P::mul(P::mul(a2, a2), a);
+			case easing_quintic_out:
+				return P::add(P::mul(P::mul(P::mul(f, f), P::mul(f, f)), f), One);
+			case easing_quintic_in_out:
+				return halves(a, P::mul(P::set1(16.0f), P::mul(P::mul(a2, a2), a)), P::add(P::mul(Half, P::mul(P::mul(P::mul(g, g), P::mul(g, g)), g)), One));
+			case easing_sine_in:
+				return P::sub(One, sin_quarter(P::mul(P::sub(One, a), P::set1(half_pi<float>()))));
+			case easing_sine_out:
+				return sin_quarter(P::mul(a, P::set1(half_pi<float>())));
+			case easing_sine_in_out:
+			{
+				// (1 - cos(a pi)) / 2 = sin(a pi / 2)^2
+				V const s = sin_quarter(P::mul(a, P::set1(half_pi<float>())));
+				return P::mul(s, s);
+			}
+			case easing_circular_in:
+				return P::sub(One, P::sqrt(P::sub(One, a2)));
+			case easing_circular_out:
+				return P::sqrt(P::mul(P::sub(Two, a), a));
+			case easing_circular_in_out:
+			{
+				// The half that is not kept takes the square root of a negative number
+				V const a2b = P::mul(Two, a);
+				V const In = P::mul(Half, P::sub(One, P::sqrt(P::sub(One, P::mul(P::set1(4.0f), a2)))));
+				V const Out = P::mul(Half, P::add(P::sqrt(P::mul(P::sub(P::set1(3.0f), a2b), P::sub(a2b, One))), One));
+				return halves(a, In, Out);
+			}
+			case easing_back_in:
+				return P::mul(a2, P::sub(P::mul(P::add(Back, One), a), Back));
+			case easing_back_out:
+				return P::add(P::mul(P::mul(f, f), P::add(P::mul(P::add(Back, One), f), Back)), One);
+			case easing_back_in_out:
+			{
+				V const s = P::mul(Back, P::set1(1.525f));
+				V const n = P::mul(Two, a);
+				V const m = P::sub(n, Two);
+				V const In = P::mul(P::mul(n, n), P::sub(P::mul(P::add(s, One), n), s));
+				V const Out = P::add(P::mul(P::mul(m, m), P::add(P::mul(P::add(s, One), m), s)), Two);
+				return P::mul(Half, halves(a, In, Out));
+			}
+			}
+		}
+
+		template<int Function>
+		GLM_FUNC_QUALIFIER static std::size_t run(std::size_t count, float const* a, float* out)
+		{
+			std::size_t i = 0;
+			for(; i + L <= count; i += L)
+				P::store(out + i, apply<Function>(P::load(a + i)));
+			return i;
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t ease(std::size_t count, int function, float const* a, float* out)
+		{
+			switch(function)
+			{
+			case easing_linear: return run<easing_linear>(count, a, out);
+			case easing_quadratic_in: return run<easing_quadratic_in>(count, a, out);
+			case easing_quadratic_out: return run<easing_quadratic_out>(count, a, out);
+			case easing_quadratic_in_out: return run<easing_quadratic_in_out>(count, a, out);
+			case easing_cubic_in: return run<easing_cubic_in>(count, a, out);
+			case easing_cubic_out: return run<easing_cubic_out>(count, a, out);
+			case easing_cubic_in_out: return run<easing_cubic_in_out>(count, a, out);
+			case easing_quartic_in: return run<easing_quartic_in>(count, a, out);
+			case easing_quartic_out: return run<easing_quartic_out>(count, a, out);
+			case easing_quartic_in_out: return run<easing_quartic_in_out>(count, a, out);
+			case easing_quintic_in: return run<easing_quintic_in>(count, a, out);
+			case easing_quintic_out: return run<easing_quintic_out>(count, a, out);
+			case easing_quintic_in_out: return run<easing_quintic_in_out>(count, a, out);
+			case easing_sine_in: return run<easing_sine_in>(count, a, out);
+			case easing_sine_out: return run<easing_sine_out>(count, a, out);
+			case easing_sine_in_out: return run<easing_sine_in_out>(count, a, out);
+			case easing_circular_in: return run<easing_circular_in>(count, a, out);
+			case easing_circular_out: return run<easing_circular_out>(count, a, out);
+			case easing_circular_in_out: return run<easing_circular_in_out>(count, a, out);
+			case easing_back_in: return run<easing_back_in>(count, a, out);
+			case easing_back_out: return run<easing_back_out>(count, a, out);
+			case easing_back_in_out: return run<easing_back_in_out>(count, a, out);
+			default: return 0;
+			}
+		}
+	};
+#	endif//GLM_CONFIG_SIMD == GLM_ENABLE
@@ -11,6 +11,12 @@
 /// Fast but less accurate implementations of square root based functions.
 /// - Sqrt optimisation based on Newton's method,
 /// www.gamedev.net/community/forums/topic.asp?topic id=139956
+///
+/// On SSE2, the qualifier of an aligned float vec4 picks the accuracy of fastSqrt and fastInverseSqrt:
+/// - aligned_lowp: rsqrtps alone, relative error below 4e-4
+/// - aligned_mediump: rsqrtps and a Newton step, relative error below 3e-7
+/// - aligned_highp: sqrtps, correctly rounded, and a division for fastInverseSqrt
+/// The *Array functions run the vec4 code of the aligned qualifier of the same precision over arrays of floats.
 
 #pragma once
 
@@ -44,6 +50,13 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_DECL vec<L, T, Q> fastSqrt(vec<L, T, Q> const& x);
 
+	/// fastSqrt of count floats with the accuracy of qualifier Q, for example fastSqrtArray<lowp>(in, out, count).
+	/// in and out may be the same array.
+	///
+	/// @see gtx_fast_square_root extension.
+	template<qualifier Q>
+	GLM_FUNC_DECL void fastSqrtArray(float const* in, float* out, std::size_t count);
+
 	/// Faster than the common inversesqrt function but less accurate.
 	///
 	/// @see gtx_fast_square_root extension.
@@ -56,6 +69,12 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_DECL vec<L, T, Q> fastInverseSqrt(vec<L, T, Q> const& x);
 
+	/// fastInverseSqrt of count floats with the accuracy of qualifier Q. in and out may be the same array.
+	///
+	/// @see gtx_fast_square_root extension.
+	template<qualifier Q>
+	GLM_FUNC_DECL void fastInverseSqrtArray(float const* in, float* out, std::size_t count);
+
 	/// Faster than the common length function but less accurate.
 	///
 	/// @see gtx_fast_square_root extension.
@@ -1,7 +1,27 @@
 /// @ref gtx_fast_square_root
 
-namespace glm
+namespace glm{
+namespace detail
 {
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_fast_sqrt
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(fastSqrt, x);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_fast_inversesqrt
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x)
+		{
+			return compute_inversesqrt<L, T, Q, Aligned>::call(x);
+		}
+	};
+}//namespace detail
+
 	// fastSqrt
 	template<typename genType>
 	GLM_FUNC_QUALIFIER genType fastSqrt(genType x)
@@ -14,7 +34,14 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> fastSqrt(vec<L, T, Q> const& x)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(fastSqrt, x);
+		return detail::compute_fast_sqrt<L, T, Q, detail::is_aligned<Q>::value>::call(x);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void fastSqrtArray(float const* in, float* out, std::size_t count)
+	{
+		typedef detail::compute_fast_sqrt<4, float, detail::to_aligned<Q>::value, detail::is_aligned<detail::to_aligned<Q>::value>::value> func;
+		detail::functor1_array<4, float, detail::to_aligned<Q>::value, func>::call(in, out, count, 1.0f);
 	}
 
 	// fastInversesqrt
@@ -27,7 +54,14 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> fastInverseSqrt(vec<L, T, Q> const& x)
 	{
-		return detail::compute_inversesqrt<L, T, Q, detail::is_aligned<Q>::value>::call(x);
+		return detail::compute_fast_inversesqrt<L, T, Q, detail::is_aligned<Q>::value>::call(x);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void fastInverseSqrtArray(float const* in, float* out, std::size_t count)
+	{
+		typedef detail::compute_fast_inversesqrt<4, float, detail::to_aligned<Q>::value, detail::is_aligned<detail::to_aligned<Q>::value>::value> func;
+		detail::functor1_array<4, float, detail::to_aligned<Q>::value, func>::call(in, out, count, 1.0f);
 	}
 
 	// fastLength
@@ -73,3 +107,7 @@ namespace glm
 		return x * fastInverseSqrt(dot(x, x));
 	}
 }//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "fast_square_root_simd.inl"
+#endif
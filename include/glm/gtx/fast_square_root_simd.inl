@@ -0,0 +1,67 @@
+/// @ref gtx_fast_square_root
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+	template<>
+	struct compute_fast_sqrt<4, float, aligned_lowp, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, aligned_lowp> call(vec<4, float, aligned_lowp> const& v)
+		{
+			vec<4, float, aligned_lowp> Result;
+			Result.data = glm_vec4_sqrt_lowp(v.data);
+			return Result;
+		}
+	};
+
+	template<>
+	struct compute_fast_sqrt<4, float, aligned_mediump, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, aligned_mediump> call(vec<4, float, aligned_mediump> const& v)
+		{
+			vec<4, float, aligned_mediump> Result;
+			Result.data = glm_vec4_sqrt_mediump(v.data);
+			return Result;
+		}
+	};
+
+	template<>
+	struct compute_fast_sqrt<4, float, aligned_highp, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, aligned_highp> call(vec<4, float, aligned_highp> const& v)
+		{
+			vec<4, float, aligned_highp> Result;
+			Result.data = _mm_sqrt_ps(v.data);
+			return Result;
+		}
+	};
+
+	template<>
+	struct compute_fast_inversesqrt<4, float, aligned_lowp, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, aligned_lowp> call(vec<4, float, aligned_lowp> const& v)
+		{
+			vec<4, float, aligned_lowp> Result;
+			Result.data = glm_vec4_inversesqrt_lowp(v.data);
+			return Result;
+		}
+	};
+
+	template<>
+	struct compute_fast_inversesqrt<4, float, aligned_mediump, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, aligned_mediump> call(vec<4, float, aligned_mediump> const& v)
+		{
+			vec<4, float, aligned_mediump> Result;
+			Result.data = glm_vec4_inversesqrt_mediump(v.data);
+			return Result;
+		}
+	};
+#	endif//GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
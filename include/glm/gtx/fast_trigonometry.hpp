@@ -9,6 +9,13 @@
 /// Include <glm/gtx/fast_trigonometry.hpp> to use the features of this extension.
 ///
 /// Fast but less accurate implementations of trigonometric functions.
+///
+/// On SSE2, the qualifier of an aligned float vec4 picks the accuracy of fastSin and fastCos, for |angle| <= 1e5:
+/// - aligned_lowp: degree 3 and 4 polynomials, absolute error below 2e-4
+/// - aligned_mediump: degree 5 and 6 polynomials, absolute error below 2e-6
+/// - aligned_highp: the core sin and cos, within 2 ulp over the whole float range
+/// Other types keep the scalar approximations. The *Array functions run the vec4 code of the aligned qualifier of the
+/// same precision over arrays of floats.
 
 #pragma once
 
@@ -43,6 +50,17 @@ namespace glm
 	template<typename T>
 	GLM_FUNC_DECL T fastCos(T angle);
 
+	/// fastSin of count floats with the accuracy of qualifier Q, for example fastSinArray<mediump>(in, out, count).
+	/// in and out may be the same array.
+	/// From GLM_GTX_fast_trigonometry extension.
+	template<qualifier Q>
+	GLM_FUNC_DECL void fastSinArray(float const* in, float* out, std::size_t count);
+
+	/// fastCos of count floats with the accuracy of qualifier Q. in and out may be the same array.
+	/// From GLM_GTX_fast_trigonometry extension.
+	template<qualifier Q>
+	GLM_FUNC_DECL void fastCosArray(float const* in, float* out, std::size_t count);
+
 	/// Faster than the common tan function but less accurate.
 	/// Defined between -2pi and 2pi.
 	/// From GLM_GTX_fast_trigonometry extension.
@@ -25,6 +25,24 @@ namespace detail
 	{
 		return detail::functor1<vec, L, T, T, Q>::call(cos_52s, x);
 	}
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_fast_sin
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(fastSin, x);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_fast_cos
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(fastCos, x);
+		}
+	};
 }//namespace detail
 
 	// wrapAngle
@@ -59,7 +77,14 @@ namespace detail
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> fastCos(vec<L, T, Q> const& x)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(fastCos, x);
+		return detail::compute_fast_cos<L, T, Q, detail::is_aligned<Q>::value>::call(x);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void fastCosArray(float const* in, float* out, std::size_t count)
+	{
+		typedef detail::compute_fast_cos<4, float, detail::to_aligned<Q>::value, detail::is_aligned<detail::to_aligned<Q>::value>::value> func;
+		detail::functor1_array<4, float, detail::to_aligned<Q>::value, func>::call(in, out, count, 0.0f);
 	}
 
 	// sin
@@ -72,7 +97,14 @@ namespace detail
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> fastSin(vec<L, T, Q> const& x)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(fastSin, x);
+		return detail::compute_fast_sin<L, T, Q, detail::is_aligned<Q>::value>::call(x);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void fastSinArray(float const* in, float* out, std::size_t count)
+	{
+		typedef detail::compute_fast_sin<4, float, detail::to_aligned<Q>::value, detail::is_aligned<detail::to_aligned<Q>::value>::value> func;
+		detail::functor1_array<4, float, detail::to_aligned<Q>::value, func>::call(in, out, count, 0.0f);
 	}
 
 	// tan
@@ -140,3 +172,7 @@ namespace detail
 		return detail::functor1<vec, L, T, T, Q>::call(fastAtan, x);
 	}
 }//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "fast_trigonometry_simd.inl"
+#endif
@@ -0,0 +1,82 @@
+/// @ref gtx_fast_trigonometry
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+	template<>
+	struct compute_fast_sin<4, float, aligned_lowp, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, aligned_lowp> call(vec<4, float, aligned_lowp> const& v)
+		{
+			vec<4, float, aligned_lowp> Result;
+			glm_vec4 CosX;
+			glm_vec4_sincos_lowp(v.data, &Result.data, &CosX);
+			return Result;
+		}
+	};
+
+	template<>
+	struct compute_fast_sin<4, float, aligned_mediump, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, aligned_mediump> call(vec<4, float, aligned_mediump> const& v)
+		{
+			vec<4, float, aligned_mediump> Result;
+			glm_vec4 CosX;
+			glm_vec4_sincos_mediump(v.data, &Result.data, &CosX);
+			return Result;
+		}
+	};
+
+	template<>
+	struct compute_fast_sin<4, float, aligned_highp, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, aligned_highp> call(vec<4, float, aligned_highp> const& v)
+		{
+			vec<4, float, aligned_highp> Result;
+			Result.data = glm_vec4_sin(v.data);
+			return Result;
+		}
+	};
+
+	template<>
+	struct compute_fast_cos<4, float, aligned_lowp, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, aligned_lowp> call(vec<4, float, aligned_lowp> const& v)
+		{
+			vec<4, float, aligned_lowp> Result;
+			glm_vec4 SinX;
+			glm_vec4_sincos_lowp(v.data, &SinX, &Result.data);
+			return Result;
+		}
+	};
+
+	template<>
+	struct compute_fast_cos<4, float, aligned_mediump, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, aligned_mediump> call(vec<4, float, aligned_mediump> const& v)
+		{
+			vec<4, float, aligned_mediump> Result;
+			glm_vec4 SinX;
+			glm_vec4_sincos_mediump(v.data, &SinX, &Result.data);
+			return Result;
+		}
+	};
+
+	template<>
+	struct compute_fast_cos<4, float, aligned_highp, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, aligned_highp> call(vec<4, float, aligned_highp> const& v)
+		{
+			vec<4, float, aligned_highp> Result;
+			Result.data = glm_vec4_cos(v.data);
+			return Result;
+		}
+	};
+#	endif//GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -0,0 +1,117 @@
+/// @ref gtx_geometric_array
+/// @file glm/gtx/geometric_array.hpp
+///
+/// @see core (dependence)
+/// @see gtx_norm (dependence)
+///
+/// @defgroup gtx_geometric_array GLM_GTX_geometric_array
+/// @ingroup gtx
+///
+/// Include <glm/gtx/geometric_array.hpp> to use the features of this extension.
+///
+/// normalize, length, distance2, dot and cross over whole arrays of vec3 or vec4, given either as arrays of vectors
+/// or as one array per component. The SIMD paths handle 8 vectors per AVX register and 4 per SSE2 register, one vector
+/// per lane: arrays of vectors are transposed to one component per register on the fly, 4 vectors at a time.
+/// The last few vectors, and every vector without SIMD, go through the core functions.
+/// normalize multiplies by rsqrt refined with one Newton step, within 3e-7 of the core normalize; the other functions
+/// round like the core ones, up to the order of the additions. Zero vectors normalize to NaN as with normalize.
+/// With GLM_CONFIG_SIMD_DISPATCH a build for a narrower GLM_ARCH still runs the AVX2 kernels on CPUs that have AVX2,
+/// see GLM_GTX_simd_dispatch.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtx/norm.hpp"
+#include "../detail/_float_packet.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_geometric_array is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	else
+#		pragma message("GLM: GLM_GTX_geometric_array extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_geometric_array
+	/// @{
+
+	/// out[i] = normalize(in[i]) for count vectors. in and out may be the same array.
+	/// From GLM_GTX_geometric_array extension.
+	GLM_FUNC_DECL void normalizeArray(vec3 const* in, vec3* out, std::size_t count);
+
+	/// out[i] = normalize(in[i]) for count vectors. in and out may be the same array.
+	/// From GLM_GTX_geometric_array extension.
+	GLM_FUNC_DECL void normalizeArray(vec4 const* in, vec4* out, std::size_t count);
+
+	/// out[i] = length(in[i]) for count vectors.
+	/// From GLM_GTX_geometric_array extension.
+	GLM_FUNC_DECL void lengthArray(vec3 const* in, float* out, std::size_t count);
+
+	/// out[i] = length(in[i]) for count vectors.
+	/// From GLM_GTX_geometric_array extension.
+	GLM_FUNC_DECL void lengthArray(vec4 const* in, float* out, std::size_t count);
+
+	/// out[i] = distance2(a[i], b[i]) for count pairs of points.
+	/// From GLM_GTX_geometric_array extension.
+	GLM_FUNC_DECL void distance2Array(vec3 const* a, vec3 const* b, float* out, std::size_t count);
+
+	/// out[i] = distance2(a[i], b[i]) for count pairs of points.
+	/// From GLM_GTX_geometric_array extension.
+	GLM_FUNC_DECL void distance2Array(vec4 const* a, vec4 const* b, float* out, std::size_t count);
+
+	/// out[i] = dot(a[i], b[i]) for count pairs of vectors.
+	/// From GLM_GTX_geometric_array extension.
+	GLM_FUNC_DECL void dotArray(vec3 const* a, vec3 const* b, float* out, std::size_t count);
+
+	/// out[i] = dot(a[i], b[i]) for count pairs of vectors.
+	/// From GLM_GTX_geometric_array extension.
+	GLM_FUNC_DECL void dotArray(vec4 const* a, vec4 const* b, float* out, std::size_t count);
+
+	/// out[i] = cross(a[i], b[i]) for count pairs of vectors. out may be a or b.
+	/// From GLM_GTX_geometric_array extension.
+	GLM_FUNC_DECL void crossArray(vec3 const* a, vec3 const* b, vec3* out, std::size_t count);
+
+	/// normalize of count vectors given in structure of arrays form. The outputs may be the inputs.
+	/// From GLM_GTX_geometric_array extension.
+	GLM_FUNC_DECL void normalizeSoA(std::size_t count, float const* x, float const* y, float const* z, float* outX, float* outY, float* outZ);
+
+	/// normalize of count vectors given in structure of arrays form. The outputs may be the inputs.
+	/// From GLM_GTX_geometric_array extension.
+	GLM_FUNC_DECL void normalizeSoA(std::size_t count, float const* x, float const* y, float const* z, float const* w, float* outX, float* outY, float* outZ, float* outW);
+
+	/// out[i] = length(vec3(x[i], y[i], z[i])) for count vectors.
+	/// From GLM_GTX_geometric_array extension.
+	GLM_FUNC_DECL void lengthSoA(std::size_t count, float const* x, float const* y, float const* z, float* out);
+
+	/// out[i] = length(vec4(x[i], y[i], z[i], w[i])) for count vectors.
+	/// From GLM_GTX_geometric_array extension.
+	GLM_FUNC_DECL void lengthSoA(std::size_t count, float const* x, float const* y, float const* z, float const* w, float* out);
+
+	/// out[i] = distance2(vec3(ax[i], ay[i], az[i]), vec3(bx[i], by[i], bz[i])) for count pairs of points.
+	/// From GLM_GTX_geometric_array extension.
+	GLM_FUNC_DECL void distance2SoA(std::size_t count, float const* ax, float const* ay, float const* az, float const* bx, float const* by, float const* bz, float* out);
+
+	/// distance2 of count pairs of 4 component points given in structure of arrays form.
+	/// From GLM_GTX_geometric_array extension.
+	GLM_FUNC_DECL void distance2SoA(std::size_t count, float const* ax, float const* ay, float const* az, float const* aw, float const* bx, float const* by, float const* bz, float const* bw, float* out);
+
+	/// out[i] = dot(vec3(ax[i], ay[i], az[i]), vec3(bx[i], by[i], bz[i])) for count pairs of vectors.
+	/// From GLM_GTX_geometric_array extension.
+	GLM_FUNC_DECL void dotSoA(std::size_t count, float const* ax, float const* ay, float const* az, float const* bx, float const* by, float const* bz, float* out);
+
+	/// dot of count pairs of 4 component vectors given in structure of arrays form.
+	/// From GLM_GTX_geometric_array extension.
+	GLM_FUNC_DECL void dotSoA(std::size_t count, float const* ax, float const* ay, float const* az, float const* aw, float const* bx, float const* by, float const* bz, float const* bw, float* out);
+
+	/// cross of count pairs of vectors given in structure of arrays form. The outputs may be the inputs.
+	/// From GLM_GTX_geometric_array extension.
+	GLM_FUNC_DECL void crossSoA(std::size_t count, float const* ax, float const* ay, float const* az, float const* bx, float const* by, float const* bz, float* outX, float* outY, float* outZ);
+
+	/// @}
+}//namespace glm
+
+#include "geometric_array.inl"
@@ -0,0 +1,218 @@
+/// @ref gtx_geometric_array
+
+namespace glm{
+namespace detail
+{
+#	include "geometric_array_simd.inl"
+
+#	if GLM_SIMD_DISPATCH_AVX2
+	GLM_SIMD_TARGET_AVX2_BEGIN
+	namespace avx2
+	{
+#	include "geometric_array_simd.inl"
+	}//namespace avx2
+	GLM_SIMD_TARGET_END
+#	endif//GLM_SIMD_DISPATCH_AVX2
+
+	typedef compute_geometric_array<float_packet_width> geometric_array;
+
+	// One entry per simd_dispatch tier. There is no 16 lane float_packet, AVX-512 CPUs run the AVX2 kernels
+	struct geometric_array_kernels
+	{
+		std::size_t (*aos_normalize)(std::size_t, length_t, float const*, float*);
+		std::size_t (*aos_length)(std::size_t, length_t, float const*, float*);
+		std::size_t (*aos_distance2)(std::size_t, length_t, float const*, float const*, float*);
+		std::size_t (*aos_dot)(std::size_t, length_t, float const*, float const*, float*);
+		std::size_t (*aos_cross)(std::size_t, float const*, float const*, float*);
+		std::size_t (*soa_normalize)(std::size_t, length_t, float const* const*, float* const*);
+		std::size_t (*soa_length)(std::size_t, length_t, float const* const*, float*);
+		std::size_t (*soa_distance2)(std::size_t, length_t, float const* const*, float const* const*, float*);
+		std::size_t (*soa_dot)(std::size_t, length_t, float const* const*, float const* const*, float*);
+		std::size_t (*soa_cross)(std::size_t, float const* const*, float const* const*, float* const*);
+	};
+
+	GLM_FUNC_QUALIFIER geometric_array_kernels const& geometric_array_dispatch()
+	{
+#		if GLM_SIMD_DISPATCH_AVX2
+		typedef avx2::compute_geometric_array<avx2::float_packet_width> geometric_array_avx2;
+#		else
+		typedef geometric_array geometric_array_avx2;
+#		endif
+		static geometric_array_kernels const Tiers[] =
+		{
+			{
+				&geometric_array::aos_normalize, &geometric_array::aos_length, &geometric_array::aos_distance2, &geometric_array::aos_dot, &geometric_array::aos_cross,
+				&geometric_array::soa_normalize, &geometric_array::soa_length, &geometric_array::soa_distance2, &geometric_array::soa_dot, &geometric_array::soa_cross
+			},
+			{
+				&geometric_array_avx2::aos_normalize, &geometric_array_avx2::aos_length, &geometric_array_avx2::aos_distance2, &geometric_array_avx2::aos_dot, &geometric_array_avx2::aos_cross,
+				&geometric_array_avx2::soa_normalize, &geometric_array_avx2::soa_length, &geometric_array_avx2::soa_distance2, &geometric_array_avx2::soa_dot, &geometric_array_avx2::soa_cross
+			},
+			{
+				&geometric_array_avx2::aos_normalize, &geometric_array_avx2::aos_length, &geometric_array_avx2::aos_distance2, &geometric_array_avx2::aos_dot, &geometric_array_avx2::aos_cross,
+				&geometric_array_avx2::soa_normalize, &geometric_array_avx2::soa_length, &geometric_array_avx2::soa_distance2, &geometric_array_avx2::soa_dot, &geometric_array_avx2::soa_cross
+			}
+		};
+		return Tiers[simd_dispatch_current()];
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void normalizeArray(vec3 const* in, vec3* out, std::size_t count)
+	{
+		std::size_t i = detail::geometric_array_dispatch().aos_normalize(count, 3, reinterpret_cast<float const*>(in), reinterpret_cast<float*>(out));
+		for(; i < count; ++i)
+			out[i] = normalize(in[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void normalizeArray(vec4 const* in, vec4* out, std::size_t count)
+	{
+		std::size_t i = detail::geometric_array_dispatch().aos_normalize(count, 4, reinterpret_cast<float const*>(in), reinterpret_cast<float*>(out));
+		for(; i < count; ++i)
+			out[i] = normalize(in[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void lengthArray(vec3 const* in, float* out, std::size_t count)
+	{
+		std::size_t i = detail::geometric_array_dispatch().aos_length(count, 3, reinterpret_cast<float const*>(in), out);
+		for(; i < count; ++i)
+			out[i] = length(in[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void lengthArray(vec4 const* in, float* out, std::size_t count)
+	{
+		std::size_t i = detail::geometric_array_dispatch().aos_length(count, 4, reinterpret_cast<float const*>(in), out);
+		for(; i < count; ++i)
+			out[i] = length(in[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void distance2Array(vec3 const* a, vec3 const* b, float* out, std::size_t count)
+	{
+		std::size_t i = detail::geometric_array_dispatch().aos_distance2(count, 3, reinterpret_cast<float const*>(a), reinterpret_cast<float const*>(b), out);
+		for(; i < count; ++i)
+			out[i] = distance2(a[i], b[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void distance2Array(vec4 const* a, vec4 const* b, float* out, std::size_t count)
+	{
+		std::size_t i = detail::geometric_array_dispatch().aos_distance2(count, 4, reinterpret_cast<float const*>(a), reinterpret_cast<float const*>(b), out);
+		for(; i < count; ++i)
+			out[i] = distance2(a[i], b[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void dotArray(vec3 const* a, vec3 const* b, float* out, std::size_t count)
+	{
+		std::size_t i = detail::geometric_array_dispatch().aos_dot(count, 3, reinterpret_cast<float const*>(a), reinterpret_cast<float const*>(b), out);
+		for(; i < count; ++i)
+			out[i] = dot(a[i], b[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void dotArray(vec4 const* a, vec4 const* b, float* out, std::size_t count)
+	{
+		std::size_t i = detail::geometric_array_dispatch().aos_dot(count, 4, reinterpret_cast<float const*>(a), reinterpret_cast<float const*>(b), out);
+		for(; i < count; ++i)
+			out[i] = dot(a[i], b[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void crossArray(vec3 const* a, vec3 const* b, vec3* out, std::size_t count)
+	{
+		std::size_t i = detail::geometric_array_dispatch().aos_cross(count, reinterpret_cast<float const*>(a), reinterpret_cast<float const*>(b), reinterpret_cast<float*>(out));
+		for(; i < count; ++i)
+			out[i] = cross(a[i], b[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void normalizeSoA(std::size_t count, float const* x, float const* y, float const* z, float* outX, float* outY, float* outZ)
+	{
+		float const* const In[] = {x, y, z};
+		float* const Out[] = {outX, outY, outZ};
+		std::size_t i = detail::geometric_array_dispatch().soa_normalize(count, 3, In, Out);
+		for(; i < count; ++i)
+		{
+			vec3 const v = normalize(vec3(x[i], y[i], z[i]));
+			outX[i] = v.x;
+			outY[i] = v.y;
+			outZ[i] = v.z;
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void normalizeSoA(std::size_t count, float const* x, float const* y, float const* z, float const* w, float* outX, float* outY, float* outZ, float* outW)
+	{
+		float const* const In[] = {x, y, z, w};
+		float* const Out[] = {outX, outY, outZ, outW};
+		std::size_t i = detail::geometric_array_dispatch().soa_normalize(count, 4, In, Out);
+		for(; i < count; ++i)
+		{
+			vec4 const v = normalize(vec4(x[i], y[i], z[i], w[i]));
+			outX[i] = v.x;
+			outY[i] = v.y;
+			outZ[i] = v.z;
+			outW[i] = v.w;
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void lengthSoA(std::size_t count, float const* x, float const* y, float const* z, float* out)
+	{
+		float const* const In[] = {x, y, z};
+		std::size_t i = detail::geometric_array_dispatch().soa_length(count, 3, In, out);
+		for(; i < count; ++i)
+			out[i] = length(vec3(x[i], y[i], z[i]));
+	}
+
+	GLM_FUNC_QUALIFIER void lengthSoA(std::size_t count, float const* x, float const* y, float const* z, float const* w, float* out)
+	{
+		float const* const In[] = {x, y, z, w};
+		std::size_t i = detail::geometric_array_dispatch().soa_length(count, 4, In, out);
+		for(; i < count; ++i)
+			out[i] = length(vec4(x[i], y[i], z[i], w[i]));
+	}
+
+	GLM_FUNC_QUALIFIER void distance2SoA(std::size_t count, float const* ax, float const* ay, float const* az, float const* bx, float const* by, float const* bz, float* out)
+	{
+		float const* const A[] = {ax, ay, az};
+		float const* const B[] = {bx, by, bz};
+		std::size_t i = detail::geometric_array_dispatch().soa_distance2(count, 3, A, B, out);
+		for(; i < count; ++i)
+			out[i] = distance2(vec3(ax[i], ay[i], az[i]), vec3(bx[i], by[i], bz[i]));
+	}
+
+	GLM_FUNC_QUALIFIER void distance2SoA(std::size_t count, float const* ax, float const* ay, float const* az, float const* aw, float const* bx, float const* by, float const* bz, float const* bw, float* out)
+	{
+		float const* const A[] = {ax, ay, az, aw};
+		float const* const B[] = {bx, by, bz, bw};
+		std::size_t i = detail::geometric_array_dispatch().soa_distance2(count, 4, A, B, out);
+		for(; i < count; ++i)
+			out[i] = distance2(vec4(ax[i], ay[i], az[i], aw[i]), vec4(bx[i], by[i], bz[i], bw[i]));
+	}
+
+	GLM_FUNC_QUALIFIER void dotSoA(std::size_t count, float const* ax, float const* ay, float const* az, float const* bx, float const* by, float const* bz, float* out)
+	{
+		float const* const A[] = {ax, ay, az};
+		float const* const B[] = {bx, by, bz};
+		std::size_t i = detail::geometric_array_dispatch().soa_dot(count, 3, A, B, out);
+		for(; i < count; ++i)
+			out[i] = dot(vec3(ax[i], ay[i], az[i]), vec3(bx[i], by[i], bz[i]));
+	}
+
+	GLM_FUNC_QUALIFIER void dotSoA(std::size_t count, float const* ax, float const* ay, float const* az, float const* aw, float const* bx, float const* by, float const* bz, float const* bw, float* out)
+	{
+		float const* const A[] = {ax, ay, az, aw};
+		float const* const B[] = {bx, by, bz, bw};
+		std::size_t i = detail::geometric_array_dispatch().soa_dot(count, 4, A, B, out);
+		for(; i < count; ++i)
+			out[i] = dot(vec4(ax[i], ay[i], az[i], aw[i]), vec4(bx[i], by[i], bz[i], bw[i]));
+	}
+
+	GLM_FUNC_QUALIFIER void crossSoA(std::size_t count, float const* ax, float const* ay, float const* az, float const* bx, float const* by, float const* bz, float* outX, float* outY, float* outZ)
+	{
+		float const* const A[] = {ax, ay, az};
+		float const* const B[] = {bx, by, bz};
+		float* const Out[] = {outX, outY, outZ};
+		std::size_t i = detail::geometric_array_dispatch().soa_cross(count, A, B, Out);
+		for(; i < count; ++i)
+		{
+			vec3 const v = cross(vec3(ax[i], ay[i], az[i]), vec3(bx[i], by[i], bz[i]));
+			outX[i] = v.x;
+			outY[i] = v.y;
+			outZ[i] = v.z;
+		}
+	}
+}//namespace glm
@@ -0,0 +1,254 @@
+/// @ref gtx_geometric_array
+/// Included once per kernel tier, inside that tier's namespace
+
+	// Scalar fallback, the caller runs every vector through the core functions. Each function handles a prefix of the
+	// arrays and returns its length, C is the number of components, 3 or 4
+	template<length_t L, bool Simd = float_packet<L>::simd>
+	struct compute_geometric_array
+	{
+		GLM_FUNC_QUALIFIER static std::size_t aos_normalize(std::size_t, length_t, float const*, float*) { return 0; }
+		GLM_FUNC_QUALIFIER static std::size_t aos_length(std::size_t, length_t, float const*, float*) { return 0; }
+		GLM_FUNC_QUALIFIER static std::size_t aos_distance2(std::size_t, length_t, float const*, float const*, float*) { return 0; }
+		GLM_FUNC_QUALIFIER static std::size_t aos_dot(std::size_t, length_t, float const*, float const*, float*) { return 0; }
+		GLM_FUNC_QUALIFIER static std::size_t aos_cross(std::size_t, float const*, float const*, float*) { return 0; }
+		GLM_FUNC_QUALIFIER static std::size_t soa_normalize(std::size_t, length_t, float const* const*, float* const*) { return 0; }
+		GLM_FUNC_QUALIFIER static std::size_t soa_length(std::size_t, length_t, float const* const*, float*) { return 0; }
+		GLM_FUNC_QUALIFIER static std::size_t soa_distance2(std::size_t, length_t, float const* const*, float const* const*, float*) { return 0; }
+		GLM_FUNC_QUALIFIER static std::size_t soa_dot(std::size_t, length_t, float const* const*, float const* const*, float*) { return 0; }
+		GLM_FUNC_QUALIFIER static std::size_t soa_cross(std::size_t, float const* const*, float const* const*, float* const*) { return 0; }
+	};
+
+#	if GLM_CONFIG_SIMD == GLM_ENABLE
+	template<length_t L>
+	struct compute_geometric_array<L, true>
+	{
+		typedef float_packet<L> P;
+		typedef typename P::type V;
+
+		// Floats between two vec3 of an array, 4 when the vec3 are aligned and padded
+		static length_t const vec3_stride = static_cast<length_t>(sizeof(vec3) / sizeof(float));
+
+		// Arrays of vectors Stride floats apart, with C components read and written. Each block of 4 lanes holds
+		// 4 consecutive vectors, transposed to or from one component per register
+		template<length_t C, length_t Stride>
+		struct aos
+		{
+			GLM_FUNC_QUALIFIER static void load(float const* p, std::size_t i, V* v)
+			{
+				p += i * Stride;
+				if(Stride == 3)
+				{
+					// x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3
+					V const a = P::load(p, 12);
+					V const b = P::load(p + 4, 12);
+					V const c = P::load(p + 8, 12);
+					V const xy = P::template shuffle<_MM_SHUFFLE(2, 1, 3, 2)>(b, c);
+					V const yz = P::template shuffle<_MM_SHUFFLE(1, 0, 2, 1)>(a, b);
+					v[0] = P::template shuffle<_MM_SHUFFLE(2, 0, 3, 0)>(a, xy);
+					v[1] = P::template shuffle<_MM_SHUFFLE(3, 1, 2, 0)>(yz, xy);
+					v[2] = P::template shuffle<_MM_SHUFFLE(3, 0, 3, 1)>(yz, c);
+				}
+				else
+				{
+					V const a = P::load(p, 16);
+					V const b = P::load(p + 4, 16);
+					V const c = P::load(p + 8, 16);
+					V const d = P::load(p + 12, 16);
+					V const xy01 = P::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(a, b);
+					V const zw01 = P::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(a, b);
+					V const xy23 = P::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(c, d);
+					V const zw23 = P::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(c, d);
+					v[0] = P::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(xy01, xy23);
+					v[1] = P::template shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(xy01, xy23);
+					v[2] = P::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(zw01, zw23);
+					if(C == 4)
+						v[3] = P::template shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(zw01, zw23);
+				}
+			}
+
+			// The padding of aligned vec3 is written as 0
+			GLM_FUNC_QUALIFIER static void store(float* p, std::size_t i, V const* v)
+			{
+				p += i * Stride;
+				if(Stride == 3)
+				{
+					V const xxyy = P::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(v[0], v[1]);
+					V const zzxx = P::template shuffle<_MM_SHUFFLE(3, 1, 2, 0)>(v[2], v[0]);
+					V const yyzz = P::template shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(v[1], v[2]);
+					P::store(p, 12, P::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(xxyy, zzxx));
+					P::store(p + 4, 12, P::template shuffle<_MM_SHUFFLE(3, 1, 2, 0)>(yyzz, xxyy));
+					P::store(p + 8, 12, P::template shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(zzxx, yyzz));
+				}
+				else
+				{
+					V const w = C == 4 ? v[3] : P::set1(0.0f);
+					V const xxyy01 = P::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(v[0], v[1]);
+					V const xxyy23 = P::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(v[0], v[1]);
+					V const zzww01 = P::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(v[2], w);
+					V const zzww23 = P::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(v[2], w);
+					P::store(p, 16, P::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(xxyy01, zzww01));
+					P::store(p + 4, 16, P::template shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(xxyy01, zzww01));
+					P::store(p + 8, 16, P::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(xxyy23, zzww23));
+					P::store(p + 12, 16, P::template shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(xxyy23, zzww23));
+				}
+			}
+		};
+
+		// One array per component
+		template<length_t C>
+		struct soa
+		{
+			GLM_FUNC_QUALIFIER static void load(float const* const* p, std::size_t i, V* v)
+			{
+				for(length_t c = 0; c < C; ++c)
+					v[c] = P::load(p[c] + i);
+			}
+
+			GLM_FUNC_QUALIFIER static void store(float* const* p, std::size_t i, V const* v)
+			{
+				for(length_t c = 0; c < C; ++c)
+					P::store(p[c] + i, v[c]);
+			}
+		};
+
+		template<length_t C>
+		GLM_FUNC_QUALIFIER static V dot_lanes(V const* a, V const* b)
+		{
+			V Result = P::mul(a[0], b[0]);
+			for(length_t c = 1; c < C; ++c)
+				Result = P::add(Result, P::mul(a[c], b[c]));
+			return Result;
+		}
+
+		template<length_t C, typename Access, typename In, typename Out>
+		GLM_FUNC_QUALIFIER static std::size_t normalize(std::size_t count, In in, Out out)
+		{
+			V const Half = P::set1(0.5f);
+			V const ThreeHalfs = P::set1(1.5f);
+			std::size_t i = 0;
+			for(; i + L <= count; i += L)
+			{
+				V v[4];
+				Access::load(in, i, v);
+				// rsqrt is good to 12 bits, the Newton step y (1.5 - 0.5 d y^2) to about 22
+				V const d = dot_lanes<C>(v, v);
+				V y = P::rsqrt(d);
+				y = P::mul(y, P::sub(ThreeHalfs, P::mul(P::mul(P::mul(d, Half), y), y)));
+				for(length_t c = 0; c < C; ++c)
+					v[c] = P::mul(v[c], y);
+				Access::store(out, i, v);
+			}
+			return i;
+		}
+
+		template<length_t C, typename Access, typename In>
+		GLM_FUNC_QUALIFIER static std::size_t length(std::size_t count, In in, float* out)
+		{
+			std::size_t i = 0;
+			for(; i + L <= count; i += L)
+			{
+				V v[4];
+				Access::load(in, i, v);
+				P::store(out + i, P::sqrt(dot_lanes<C>(v, v)));
+			}
+			return i;
+		}
+
+		template<length_t C, typename Access, typename In>
+		GLM_FUNC_QUALIFIER static std::size_t distance2(std::size_t count, In a, In b, float* out)
+		{
+			std::size_t i = 0;
+			for(; i + L <= count; i += L)
+			{
+				V va[4], vb[4];
+				Access::load(a, i, va);
+				Access::load(b, i, vb);
+				for(length_t c = 0; c < C; ++c)
+					va[c] = P::sub(vb[c], va[c]);
+				P::store(out + i, dot_lanes<C>(va, va));
+			}
+			return i;
+		}
+
+		template<length_t C, typename Access, typename In>
+		GLM_FUNC_QUALIFIER static std::size_t dot(std::size_t count, In a, In b, float* out)
+		{
+			std::size_t i = 0;
+			for(; i + L <= count; i += L)
+			{
+				V va[4], vb[4];
+				Access::load(a, i, va);
+				Access::load(b, i, vb);
+				P::store(out + i, dot_lanes<C>(va, vb));
+			}
+			return i;
+		}
+
+		template<typename Access, typename In, typename Out>
+		GLM_FUNC_QUALIFIER static std::size_t cross(std::size_t count, In a, In b, Out out)
+		{
+			std::size_t i = 0;
+			for(; i + L <= count; i += L)
+			{
+				V va[4], vb[4], v[4];
+				Access::load(a, i, va);
+				Access::load(b, i, vb);
+				v[0] = P::sub(P::mul(va[1], vb[2]), P::mul(vb[1], va[2]));
+				v[1] = P::sub(P::mul(va[2], vb[0]), P::mul(vb[2], va[0]));
+				v[2] = P::sub(P::mul(va[0], vb[1]), P::mul(vb[0], va[1]));
+				Access::store(out, i, v);
+			}
+			return i;
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t aos_normalize(std::size_t count, length_t C, float const* in, float* out)
+		{
+			return C == 4 ? normalize<4, aos<4, 4> >(count, in, out) : normalize<3, aos<3, vec3_stride> >(count, in, out);
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t aos_length(std::size_t count, length_t C, float const* in, float* out)
+		{
+			return C == 4 ? length<4, aos<4, 4> >(count, in, out) : length<3, aos<3, vec3_stride> >(count, in, out);
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t aos_distance2(std::size_t count, length_t C, float const* a, float const* b, float* out)
+		{
+			return C == 4 ? distance2<4, aos<4, 4> >(count, a, b, out) : distance2<3, aos<3, vec3_stride> >(count, a, b, out);
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t aos_dot(std::size_t count, length_t C, float const* a, float const* b, float* out)
+		{
+			return C == 4 ? dot<4, aos<4, 4> >(count, a, b, out) : dot<3, aos<3, vec3_stride> >(count, a, b, out);
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t aos_cross(std::size_t count, float const* a, float const* b, float* out)
+		{
+			return cross<aos<3, vec3_stride> >(count, a, b, out);
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t soa_normalize(std::size_t count, length_t C, float const* const* in, float* const* out)
+		{
+			return C == 4 ? normalize<4, soa<4> >(count, in, out) : normalize<3, soa<3> >(count, in, out);
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t soa_length(std::size_t count, length_t C, float const* const* in, float* out)
+		{
+			return C == 4 ? length<4, soa<4> >(count, in, out) : length<3, soa<3> >(count, in, out);
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t soa_distance2(std::size_t count, length_t C, float const* const* a, float const* const* b, float* out)
+		{
+			return C == 4 ? distance2<4, soa<4> >(count, a, b, out) : distance2<3, soa<3> >(count, a, b, out);
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t soa_dot(std::size_t count, length_t C, float const* const* a, float const* const* b, float* out)
+		{
+			return C == 4 ? dot<4, soa<4> >(count, a, b, out) : dot<3, soa<3> >(count, a, b, out);
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t soa_cross(std::size_t count, float const* const* a, float const* const* b, float* const* out)
+		{
+			return cross<soa<3> >(count, a, b, out);
+		}
+	};
+#	endif//GLM_CONFIG_SIMD == GLM_ENABLE
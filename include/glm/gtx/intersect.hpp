@@ -77,6 +77,15 @@ namespace glm
 		genType const& sphereCenter, const typename genType::value_type sphereRadius,
 		genType & intersectionPosition, genType & intersectionNormal);
 
+	//! Compute the entry distance of a ray and an axis aligned bounding box with the slab test.
+	//! Takes the componentwise inverse of the ray direction. A ray starting inside the box reports a distance of 0.
+	//! From GLM_GTX_intersect extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool intersectRayAABB(
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& dirInv,
+		vec<3, T, Q> const& boxMin, vec<3, T, Q> const& boxMax,
+		T & intersectionDistance);
+
 	//! Compute the intersection of a line and a sphere.
 	//! From GLM_GTX_intersect extension
 	template<typename genType>
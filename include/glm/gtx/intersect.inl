@@ -170,6 +170,28 @@ namespace glm
 		return false;
 	}
 
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersectRayAABB
+	(
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& dirInv,
+		vec<3, T, Q> const& boxMin, vec<3, T, Q> const& boxMax,
+		T & intersectionDistance
+	)
+	{
+		vec<3, T, Q> const t0 = (boxMin - orig) * dirInv;
+		vec<3, T, Q> const t1 = (boxMax - orig) * dirInv;
+		vec<3, T, Q> const tNear = min(t0, t1);
+		vec<3, T, Q> const tFar = max(t0, t1);
+
+		T const enter = max(max(max(tNear.x, tNear.y), tNear.z), static_cast<T>(0));
+		T const exit = min(min(tFar.x, tFar.y), tFar.z);
+		if(exit < enter)
+			return false;
+
+		intersectionDistance = enter;
+		return true;
+	}
+
 	template<typename genType>
 	GLM_FUNC_QUALIFIER bool intersectLineSphere
 	(
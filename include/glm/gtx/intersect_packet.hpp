@@ -0,0 +1,105 @@
+/// @ref gtx_intersect_packet
+/// @file glm/gtx/intersect_packet.hpp
+///
+/// @see core (dependence)
+/// @see gtx_intersect (dependence)
+///
+/// @defgroup gtx_intersect_packet GLM_GTX_intersect_packet
+/// @ingroup gtx
+///
+/// Include <glm/gtx/intersect_packet.hpp> to use the features of this extension.
+///
+/// Intersection functions working on 4 or 8 rays or primitives at once, stored in structure of arrays form.
+/// 4 lanes use SSE2 and 8 lanes use AVX when GLM_ARCH allows it, otherwise every lane goes through the scalar
+/// GLM_GTX_intersect function. Both paths evaluate the same expressions in the same order so the SIMD results
+/// match the scalar ones up to floating point contraction.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtx/intersect.hpp"
+#include "../detail/_float_packet.hpp"
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_intersect_packet is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	else
+#		pragma message("GLM: GLM_GTX_intersect_packet extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_intersect_packet
+	/// @{
+
+	/// L three component vectors in structure of arrays form, one lane per ray or primitive.
+	/// From GLM_GTX_intersect_packet extension.
+	template<length_t L>
+	struct vec3_packet
+	{
+		float x[L];
+		float y[L];
+		float z[L];
+
+		GLM_FUNC_DECL vec3 get(length_t i) const;
+		GLM_FUNC_DECL void set(length_t i, vec3 const& v);
+	};
+
+	/// Per lane ray/triangle intersection results, with the same meaning as the outputs of intersectRayTriangle.
+	/// Lanes that miss keep their previous values.
+	/// From GLM_GTX_intersect_packet extension.
+	template<length_t L>
+	struct triangle_hit_packet
+	{
+		float distance[L];
+		float baryX[L];
+		float baryY[L];
+	};
+
+	typedef vec3_packet<4> vec3_packet4;
+	typedef vec3_packet<8> vec3_packet8;
+	typedef triangle_hit_packet<4> triangle_hit_packet4;
+	typedef triangle_hit_packet<8> triangle_hit_packet8;
+
+	//! Intersect L rays against one triangle.
+	//! Returns a bit mask with bit i set when ray i hits.
+	//! From GLM_GTX_intersect_packet extension.
+	template<length_t L>
+	GLM_FUNC_DECL int intersectRayTriangle(
+		vec3_packet<L> const& orig, vec3_packet<L> const& dir,
+		vec3 const& vert0, vec3 const& vert1, vec3 const& vert2,
+		triangle_hit_packet<L>& hit);
+
+	//! Intersect one ray against L triangles.
+	//! Returns a bit mask with bit i set when triangle i is hit.
+	//! From GLM_GTX_intersect_packet extension.
+	template<length_t L>
+	GLM_FUNC_DECL int intersectRayTriangle(
+		vec3 const& orig, vec3 const& dir,
+		vec3_packet<L> const& vert0, vec3_packet<L> const& vert1, vec3_packet<L> const& vert2,
+		triangle_hit_packet<L>& hit);
+
+	//! Slab test of L rays against one axis aligned bounding box, see intersectRayAABB.
+	//! Returns a bit mask with bit i set when ray i hits, intersectionDistance receives the entry distance of every lane.
+	//! From GLM_GTX_intersect_packet extension.
+	template<length_t L>
+	GLM_FUNC_DECL int intersectRayAABB(
+		vec3_packet<L> const& orig, vec3_packet<L> const& dirInv,
+		vec3 const& boxMin, vec3 const& boxMax,
+		float (&intersectionDistance)[L]);
+
+	//! Slab test of one ray against L axis aligned bounding boxes, see intersectRayAABB.
+	//! Returns a bit mask with bit i set when box i is hit, intersectionDistance receives the entry distance of every lane.
+	//! From GLM_GTX_intersect_packet extension.
+	template<length_t L>
+	GLM_FUNC_DECL int intersectRayAABB(
+		vec3 const& orig, vec3 const& dirInv,
+		vec3_packet<L> const& boxMin, vec3_packet<L> const& boxMax,
+		float (&intersectionDistance)[L]);
+
+	/// @}
+}//namespace glm
+
+#include "intersect_packet.inl"
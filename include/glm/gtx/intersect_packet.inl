@@ -0,0 +1,250 @@
+/// @ref gtx_intersect_packet
+
+namespace glm{
+namespace detail
+{
+	template<length_t L, bool Simd = float_packet<L>::simd>
+	struct compute_intersect_packet
+	{
+		GLM_FUNC_QUALIFIER static int rayTriangle(vec3_packet<L> const& orig, vec3_packet<L> const& dir, vec3 const& vert0, vec3 const& vert1, vec3 const& vert2, triangle_hit_packet<L>& hit)
+		{
+			int Mask = 0;
+			for(length_t i = 0; i < L; ++i)
+			{
+				vec2 Bary;
+				float Distance;
+				if(intersectRayTriangle(orig.get(i), dir.get(i), vert0, vert1, vert2, Bary, Distance))
+				{
+					hit.distance[i] = Distance;
+					hit.baryX[i] = Bary.x;
+					hit.baryY[i] = Bary.y;
+					Mask |= 1 << i;
+				}
+			}
+			return Mask;
+		}
+
+		GLM_FUNC_QUALIFIER static int rayTriangle(vec3 const& orig, vec3 const& dir, vec3_packet<L> const& vert0, vec3_packet<L> const& vert1, vec3_packet<L> const& vert2, triangle_hit_packet<L>& hit)
+		{
+			int Mask = 0;
+			for(length_t i = 0; i < L; ++i)
+			{
+				vec2 Bary;
+				float Distance;
+				if(intersectRayTriangle(orig, dir, vert0.get(i), vert1.get(i), vert2.get(i), Bary, Distance))
+				{
+					hit.distance[i] = Distance;
+					hit.baryX[i] = Bary.x;
+					hit.baryY[i] = Bary.y;
+					Mask |= 1 << i;
+				}
+			}
+			return Mask;
+		}
+
+		// Same slab test as intersectRayAABB, but the entry distance is written on a miss too, like the SIMD box() does
+		GLM_FUNC_QUALIFIER static bool box(vec3 const& orig, vec3 const& dirInv, vec3 const& boxMin, vec3 const& boxMax, float& distance)
+		{
+			vec3 const t0 = (boxMin - orig) * dirInv;
+			vec3 const t1 = (boxMax - orig) * dirInv;
+			vec3 const tNear = min(t0, t1);
+			vec3 const tFar = max(t0, t1);
+
+			distance = max(max(max(tNear.x, tNear.y), tNear.z), 0.0f);
+			return !(min(min(tFar.x, tFar.y), tFar.z) < distance);
+		}
+
+		GLM_FUNC_QUALIFIER static int rayAABB(vec3_packet<L> const& orig, vec3_packet<L> const& dirInv, vec3 const& boxMin, vec3 const& boxMax, float (&distance)[L])
+		{
+			int Mask = 0;
+			for(length_t i = 0; i < L; ++i)
+				if(box(orig.get(i), dirInv.get(i), boxMin, boxMax, distance[i]))
+					Mask |= 1 << i;
+			return Mask;
+		}
+
+		GLM_FUNC_QUALIFIER static int rayAABB(vec3 const& orig, vec3 const& dirInv, vec3_packet<L> const& boxMin, vec3_packet<L> const& boxMax, float (&distance)[L])
+		{
+			int Mask = 0;
+			for(length_t i = 0; i < L; ++i)
+				if(box(orig, dirInv, boxMin.get(i), boxMax.get(i), distance[i]))
+					Mask |= 1 << i;
+			return Mask;
+		}
+	};
+
+	template<length_t L>
+	struct compute_intersect_packet<L, true>
+	{
+		typedef float_packet<L> P;
+		typedef typename P::type V;
+
+		GLM_FUNC_QUALIFIER static V dot(V ax, V ay, V az, V bx, V by, V bz)
+		{
+			return P::add(P::add(P::mul(ax, bx), P::mul(ay, by)), P::mul(az, bz));
+		}
+
+		// Same steps as the scalar intersectRayTriangle, with both sides of the determinant test evaluated as masks
+		GLM_FUNC_QUALIFIER static int triangle(
+			V ox, V oy, V oz, V dx, V dy, V dz,
+			V v0x, V v0y, V v0z, V v1x, V v1y, V v1z, V v2x, V v2y, V v2z,
+			triangle_hit_packet<L>& hit)
+		{
+			V const e1x = P::sub(v1x, v0x);
+			V const e1y = P::sub(v1y, v0y);
+			V const e1z = P::sub(v1z, v0z);
+			V const e2x = P::sub(v2x, v0x);
+			V const e2y = P::sub(v2y, v0y);
+			V const e2z = P::sub(v2z, v0z);
+
+			// p = cross(dir, edge2)
+			V const px = P::sub(P::mul(dy, e2z), P::mul(e2y, dz));
+			V const py = P::sub(P::mul(dz, e2x), P::mul(e2z, dx));
+			V const pz = P::sub(P::mul(dx, e2y), P::mul(e2x, dy));
+			V const det = dot(e1x, e1y, e1z, px, py, pz);
+
+			V const sx = P::sub(ox, v0x);
+			V const sy = P::sub(oy, v0y);
+			V const sz = P::sub(oz, v0z);
+			V const u = dot(sx, sy, sz, px, py, pz);
+
+			// q = cross(dist, edge1)
+			V const qx = P::sub(P::mul(sy, e1z), P::mul(e1y, sz));
+			V const qy = P::sub(P::mul(sz, e1x), P::mul(e1z, sx));
+			V const qz = P::sub(P::mul(sx, e1y), P::mul(e1x, sy));
+			V const v = dot(dx, dy, dz, qx, qy, qz);
+			V const uv = P::add(u, v);
+
+			V const Zero = P::set1(0.0f);
+			V const Epsilon = P::set1(std::numeric_limits<float>::epsilon());
+			V const Front = P::and_(P::and_(P::cmp_gt(det, Epsilon), P::and_(P::cmp_ge(u, Zero), P::cmp_le(u, det))),
+				P::and_(P::cmp_ge(v, Zero), P::cmp_le(uv, det)));
+			V const Back = P::and_(P::and_(P::cmp_lt(det, P::set1(-std::numeric_limits<float>::epsilon())), P::and_(P::cmp_le(u, Zero), P::cmp_ge(u, det))),
+				P::and_(P::cmp_le(v, Zero), P::cmp_ge(uv, det)));
+			V const Hit = P::or_(Front, Back);
+
+			int const Mask = P::movemask(Hit);
+			if(Mask == 0)
+				return 0;
+
+			V const InvDet = P::div(P::set1(1.0f), det);
+			P::store(hit.distance, P::select(Hit, P::mul(dot(e2x, e2y, e2z, qx, qy, qz), InvDet), P::load(hit.distance)));
+			P::store(hit.baryX, P::select(Hit, P::mul(u, InvDet), P::load(hit.baryX)));
+			P::store(hit.baryY, P::select(Hit, P::mul(v, InvDet), P::load(hit.baryY)));
+			return Mask;
+		}
+
+		GLM_FUNC_QUALIFIER static int box(
+			V ox, V oy, V oz, V ix, V iy, V iz,
+			V minx, V miny, V minz, V maxx, V maxy, V maxz,
+			float (&distance)[L])
+		{
+			V const t0x = P::mul(P::sub(minx, ox), ix);
+			V const t0y = P::mul(P::sub(miny, oy), iy);
+			V const t0z = P::mul(P::sub(minz, oz), iz);
+			V const t1x = P::mul(P::sub(maxx, ox), ix);
+			V const t1y = P::mul(P::sub(maxy, oy), iy);
+			V const t1z = P::mul(P::sub(maxz, oz), iz);
+
+			V const Enter = P::max(P::max(P::max(P::min(t0x, t1x), P::min(t0y, t1y)), P::min(t0z, t1z)), P::set1(0.0f));
+			V const Exit = P::min(P::min(P::max(t0x, t1x), P::max(t0y, t1y)), P::max(t0z, t1z));
+			V const Hit = P::cmp_nlt(Exit, Enter);
+
+			P::store(distance, Enter);
+			return P::movemask(Hit);
+		}
+
+		GLM_FUNC_QUALIFIER static int rayTriangle(vec3_packet<L> const& orig, vec3_packet<L> const& dir, vec3 const& vert0, vec3 const& vert1, vec3 const& vert2, triangle_hit_packet<L>& hit)
+		{
+			return triangle(
+				P::load(orig.x), P::load(orig.y), P::load(orig.z), P::load(dir.x), P::load(dir.y), P::load(dir.z),
+				P::set1(vert0.x), P::set1(vert0.y), P::set1(vert0.z),
+				P::set1(vert1.x), P::set1(vert1.y), P::set1(vert1.z),
+				P::set1(vert2.x), P::set1(vert2.y), P::set1(vert2.z), hit);
+		}
+
+		GLM_FUNC_QUALIFIER static int rayTriangle(vec3 const& orig, vec3 const& dir, vec3_packet<L> const& vert0, vec3_packet<L> const& vert1, vec3_packet<L> const& vert2, triangle_hit_packet<L>& hit)
+		{
+			return triangle(
+				P::set1(orig.x), P::set1(orig.y), P::set1(orig.z), P::set1(dir.x), P::set1(dir.y), P::set1(dir.z),
+				P::load(vert0.x), P::load(vert0.y), P::load(vert0.z),
+				P::load(vert1.x), P::load(vert1.y), P::load(vert1.z),
+				P::load(vert2.x), P::load(vert2.y), P::load(vert2.z), hit);
+		}
+
+		GLM_FUNC_QUALIFIER static int rayAABB(vec3_packet<L> const& orig, vec3_packet<L> const& dirInv, vec3 const& boxMin, vec3 const& boxMax, float (&distance)[L])
+		{
+			return box(
+				P::load(orig.x), P::load(orig.y), P::load(orig.z), P::load(dirInv.x), P::load(dirInv.y), P::load(dirInv.z),
+				P::set1(boxMin.x), P::set1(boxMin.y), P::set1(boxMin.z),
+				P::set1(boxMax.x), P::set1(boxMax.y), P::set1(boxMax.z), distance);
+		}
+
+		GLM_FUNC_QUALIFIER static int rayAABB(vec3 const& orig, vec3 const& dirInv, vec3_packet<L> const& boxMin, vec3_packet<L> const& boxMax, float (&distance)[L])
+		{
+			return box(
+				P::set1(orig.x), P::set1(orig.y), P::set1(orig.z), P::set1(dirInv.x), P::set1(dirInv.y), P::set1(dirInv.z),
+				P::load(boxMin.x), P::load(boxMin.y), P::load(boxMin.z),
+				P::load(boxMax.x), P::load(boxMax.y), P::load(boxMax.z), distance);
+		}
+	};
+}//namespace detail
+
+	template<length_t L>
+	GLM_FUNC_QUALIFIER vec3 vec3_packet<L>::get(length_t i) const
+	{
+		return vec3(x[i], y[i], z[i]);
+	}
+
+	template<length_t L>
+	GLM_FUNC_QUALIFIER void vec3_packet<L>::set(length_t i, vec3 const& v)
+	{
+		x[i] = v.x;
+		y[i] = v.y;
+		z[i] = v.z;
+	}
+
+	template<length_t L>
+	GLM_FUNC_QUALIFIER int intersectRayTriangle
+	(
+		vec3_packet<L> const& orig, vec3_packet<L> const& dir,
+		vec3 const& vert0, vec3 const& vert1, vec3 const& vert2,
+		triangle_hit_packet<L>& hit
+	)
+	{
+		return detail::compute_intersect_packet<L>::rayTriangle(orig, dir, vert0, vert1, vert2, hit);
+	}
+
+	template<length_t L>
+	GLM_FUNC_QUALIFIER int intersectRayTriangle
+	(
+		vec3 const& orig, vec3 const& dir,
+		vec3_packet<L> const& vert0, vec3_packet<L> const& vert1, vec3_packet<L> const& vert2,
+		triangle_hit_packet<L>& hit
+	)
+	{
+		return detail::compute_intersect_packet<L>::rayTriangle(orig, dir, vert0, vert1, vert2, hit);
+	}
+
+	template<length_t L>
+	GLM_FUNC_QUALIFIER int intersectRayAABB
+	(
+		vec3_packet<L> const& orig, vec3_packet<L> const& dirInv,
+		vec3 const& boxMin, vec3 const& boxMax,
+		float (&intersectionDistance)[L]
+	)
+	{
+		return detail::compute_intersect_packet<L>::rayAABB(orig, dirInv, boxMin, boxMax, intersectionDistance);
+	}
+
+	template<length_t L>
+	GLM_FUNC_QUALIFIER int intersectRayAABB
+	(
+		vec3 const& orig, vec3 const& dirInv,
+		vec3_packet<L> const& boxMin, vec3_packet<L> const& boxMax,
+		float (&intersectionDistance)[L]
+	)
+	{
+		return detail::compute_intersect_packet<L>::rayAABB(orig, dirInv, boxMin, boxMax, intersectionDistance);
+	}
+}//namespace glm
@@ -0,0 +1,81 @@
+/// @ref gtx_matrix_affine
+/// @file glm/gtx/matrix_affine.hpp
+///
+/// @see core (dependence)
+/// @see gtx_dual_quaternion
+///
+/// @defgroup gtx_matrix_affine GLM_GTX_matrix_affine
+/// @ingroup gtx
+///
+/// Include <glm/gtx/matrix_affine.hpp> to use the features of this extension.
+///
+/// Affine transforms stored in a mat3x4: each column holds one row of the transform, the 3x3 linear part followed by
+/// the translation, and the fourth row (0, 0, 0, 1) is implicit. This is the layout mat3x4_cast of
+/// GLM_GTX_dual_quaternion already returns. It takes 48 bytes instead of the 64 of a mat4, and a row-major mat3x4
+/// uniform or buffer member in GLSL reads it as is.
+/// Aligned float matrices (aligned_mat3x4) use the simd/matrix.h functions when GLM_ARCH includes SSE2.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_matrix_affine is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	else
+#		pragma message("GLM: GLM_GTX_matrix_affine extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_matrix_affine
+	/// @{
+
+	/// Rows of the affine part of m, the last row of m is dropped.
+	/// Not the same as the mat3x4(m) constructor, which keeps the first three columns.
+	/// From GLM_GTX_matrix_affine extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<3, 4, T, Q> mat3x4_cast(mat<4, 4, T, Q> const& m);
+
+	/// The mat4 of an affine transform, for APIs that expect one.
+	/// From GLM_GTX_matrix_affine extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<4, 4, T, Q> mat4_cast(mat<3, 4, T, Q> const& m);
+
+	/// Composition of two affine transforms, a applied after b: the equivalent of mat4 a * b.
+	/// From GLM_GTX_matrix_affine extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<3, 4, T, Q> affineMul(mat<3, 4, T, Q> const& a, mat<3, 4, T, Q> const& b);
+
+	/// a * b for two mat4 whose last row is (0, 0, 0, 1), skipping the products with that row.
+	/// From GLM_GTX_matrix_affine extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<4, 4, T, Q> affineMul(mat<4, 4, T, Q> const& a, mat<4, 4, T, Q> const& b);
+
+	/// Inverse of an affine transform whose linear part is invertible.
+	/// From GLM_GTX_matrix_affine extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<3, 4, T, Q> affineInverse(mat<3, 4, T, Q> const& m);
+
+	/// Inverse of a rotation followed by a translation: the rotation transposed, and the translation rotated back and
+	/// negated. Wrong for transforms with scale or shear, use affineInverse for those.
+	/// From GLM_GTX_matrix_affine extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<3, 4, T, Q> rigidInverse(mat<3, 4, T, Q> const& m);
+
+	/// Transforms a point: linear part then translation.
+	/// From GLM_GTX_matrix_affine extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL vec<3, T, Q> transformPoint(mat<3, 4, T, Q> const& m, vec<3, T, Q> const& p);
+
+	/// Transforms a direction: linear part only.
+	/// From GLM_GTX_matrix_affine extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL vec<3, T, Q> transformVector(mat<3, 4, T, Q> const& m, vec<3, T, Q> const& v);
+
+	/// @}
+}//namespace glm
+
+#include "matrix_affine.inl"
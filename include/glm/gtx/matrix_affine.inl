@@ -0,0 +1,137 @@
+/// @ref gtx_matrix_affine
+
+namespace glm{
+namespace detail
+{
+	template<typename T, qualifier Q, bool Aligned>
+	struct compute_affine_mul
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 4, T, Q> call(mat<3, 4, T, Q> const& a, mat<3, 4, T, Q> const& b)
+		{
+			mat<3, 4, T, Q> Result;
+			for(length_t i = 0; i < 3; ++i)
+			{
+				Result[i] = b[0] * a[i].x + b[1] * a[i].y + b[2] * a[i].z;
+				Result[i].w += a[i].w;
+			}
+			return Result;
+		}
+	};
+
+	template<typename T, qualifier Q, bool Aligned>
+	struct compute_mat4_affine_mul
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, T, Q> call(mat<4, 4, T, Q> const& a, mat<4, 4, T, Q> const& b)
+		{
+			mat<4, 4, T, Q> Result;
+			for(length_t j = 0; j < 4; ++j)
+				Result[j] = a[0] * b[j].x + a[1] * b[j].y + a[2] * b[j].z;
+			Result[3] += a[3];
+			return Result;
+		}
+	};
+
+	template<typename T, qualifier Q, bool Aligned>
+	struct compute_affine_transform
+	{
+		// w is 1 for points, 0 for directions
+		GLM_FUNC_QUALIFIER static vec<3, T, Q> call(mat<3, 4, T, Q> const& m, vec<3, T, Q> const& v, T w)
+		{
+			vec<4, T, Q> const v4(v, w);
+			return vec<3, T, Q>(dot(m[0], v4), dot(m[1], v4), dot(m[2], v4));
+		}
+	};
+
+	template<typename T, qualifier Q, bool Aligned>
+	struct compute_affine_inverse
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 4, T, Q> call(mat<3, 4, T, Q> const& m)
+		{
+			vec<3, T, Q> const r0(m[0]);
+			vec<3, T, Q> const r1(m[1]);
+			vec<3, T, Q> const r2(m[2]);
+
+			// columns of the adjugate of the linear part
+			vec<3, T, Q> const c0(cross(r1, r2));
+			vec<3, T, Q> const c1(cross(r2, r0));
+			vec<3, T, Q> const c2(cross(r0, r1));
+			T const OneOverDeterminant = static_cast<T>(1) / dot(r0, c0);
+
+			vec<3, T, Q> const t(c0 * m[0].w + c1 * m[1].w + c2 * m[2].w);
+			return mat<3, 4, T, Q>(
+				vec<4, T, Q>(c0.x, c1.x, c2.x, -t.x) * OneOverDeterminant,
+				vec<4, T, Q>(c0.y, c1.y, c2.y, -t.y) * OneOverDeterminant,
+				vec<4, T, Q>(c0.z, c1.z, c2.z, -t.z) * OneOverDeterminant);
+		}
+	};
+
+	template<typename T, qualifier Q, bool Aligned>
+	struct compute_rigid_inverse
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 4, T, Q> call(mat<3, 4, T, Q> const& m)
+		{
+			vec<4, T, Q> const t(vec<4, T, Q>(m[0]) * m[0].w + vec<4, T, Q>(m[1]) * m[1].w + vec<4, T, Q>(m[2]) * m[2].w);
+			return mat<3, 4, T, Q>(
+				m[0].x, m[1].x, m[2].x, -t.x,
+				m[0].y, m[1].y, m[2].y, -t.y,
+				m[0].z, m[1].z, m[2].z, -t.z);
+		}
+	};
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 4, T, Q> mat3x4_cast(mat<4, 4, T, Q> const& m)
+	{
+		return mat<3, 4, T, Q>(transpose(m));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<4, 4, T, Q> mat4_cast(mat<3, 4, T, Q> const& m)
+	{
+		return transpose(mat<4, 4, T, Q>(m));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 4, T, Q> affineMul(mat<3, 4, T, Q> const& a, mat<3, 4, T, Q> const& b)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_GENTYPE, "'affineMul' only accept floating-point inputs");
+		return detail::compute_affine_mul<T, Q, detail::is_aligned<Q>::value>::call(a, b);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<4, 4, T, Q> affineMul(mat<4, 4, T, Q> const& a, mat<4, 4, T, Q> const& b)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_GENTYPE, "'affineMul' only accept floating-point inputs");
+		return detail::compute_mat4_affine_mul<T, Q, detail::is_aligned<Q>::value>::call(a, b);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 4, T, Q> affineInverse(mat<3, 4, T, Q> const& m)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_GENTYPE, "'affineInverse' only accept floating-point inputs");
+		return detail::compute_affine_inverse<T, Q, detail::is_aligned<Q>::value>::call(m);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 4, T, Q> rigidInverse(mat<3, 4, T, Q> const& m)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_GENTYPE, "'rigidInverse' only accept floating-point inputs");
+		return detail::compute_rigid_inverse<T, Q, detail::is_aligned<Q>::value>::call(m);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<3, T, Q> transformPoint(mat<3, 4, T, Q> const& m, vec<3, T, Q> const& p)
+	{
+		return detail::compute_affine_transform<T, Q, detail::is_aligned<Q>::value>::call(m, p, static_cast<T>(1));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<3, T, Q> transformVector(mat<3, 4, T, Q> const& m, vec<3, T, Q> const& v)
+	{
+		return detail::compute_affine_transform<T, Q, detail::is_aligned<Q>::value>::call(m, v, static_cast<T>(0));
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "matrix_affine_simd.inl"
+#endif
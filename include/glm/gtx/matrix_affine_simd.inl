@@ -0,0 +1,65 @@
+/// @ref gtx_matrix_affine
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct compute_affine_mul<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 4, float, Q> call(mat<3, 4, float, Q> const& a, mat<3, 4, float, Q> const& b)
+		{
+			mat<3, 4, float, Q> Result;
+			glm_affine_mul(&a[0].data, &b[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_mat4_affine_mul<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, float, Q> call(mat<4, 4, float, Q> const& a, mat<4, 4, float, Q> const& b)
+		{
+			mat<4, 4, float, Q> Result;
+			glm_mat4_affine_mul(&a[0].data, &b[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_affine_transform<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<3, float, Q> call(mat<3, 4, float, Q> const& m, vec<3, float, Q> const& v, float w)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_affine_mul_vec4(&m[0].data, _mm_set_ps(w, v.z, v.y, v.x));
+			return vec<3, float, Q>(Result);
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_affine_inverse<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 4, float, Q> call(mat<3, 4, float, Q> const& m)
+		{
+			mat<3, 4, float, Q> Result;
+			glm_affine_inverse(&m[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_rigid_inverse<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 4, float, Q> call(mat<3, 4, float, Q> const& m)
+		{
+			mat<3, 4, float, Q> Result;
+			glm_affine_rigid_inverse(&m[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -0,0 +1,88 @@
+/// @ref gtx_noise_batch
+/// @file glm/gtx/noise_batch.hpp
+///
+/// @see core (dependence)
+/// @see gtc_noise (dependence)
+///
+/// @defgroup gtx_noise_batch GLM_GTX_noise_batch
+/// @ingroup gtx
+///
+/// Include <glm/gtx/noise_batch.hpp> to use the features of this extension.
+///
+/// GLM_GTC_noise functions evaluated for many points per call, one point per SIMD lane: 8 lanes with AVX, 4 with
+/// SSE2, otherwise every point goes through the scalar GLM_GTC_noise function. The SIMD kernels follow the scalar
+/// code step by step so results match it up to floating point contraction.
+/// With GLM_CONFIG_SIMD_DISPATCH a build for a narrower GLM_ARCH still runs the AVX2 kernels on CPUs that have AVX2,
+/// see GLM_GTX_simd_dispatch.
+/// On top of that, fractal sums (fBm and ridged) over rows of evenly spaced points, for filling heightmaps and
+/// density volumes; with a period they are built from periodic perlin noise and tile.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/noise.hpp"
+#include "../detail/_float_packet.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_noise_batch is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	else
+#		pragma message("GLM: GLM_GTX_noise_batch extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_noise_batch
+	/// @{
+
+	/// Octaves of a fractal noise sum.
+	/// Octave i samples the noise at frequency * lacunarity^i with amplitude gain^i, the sum is divided by the
+	/// sum of the amplitudes.
+	/// fBm adds the noise itself and stays within about [-1, 1]. Ridged adds (1 - |noise|)^2 weighted by the
+	/// previous octave's value, which gives sharp crests, and stays within [0, 1].
+	/// A period > 0 makes the result repeat every period units along each axis, using periodic perlin noise instead
+	/// of simplex noise; frequency * period and lacunarity must then be whole numbers.
+	/// From GLM_GTX_noise_batch extension.
+	struct noise_fractal
+	{
+		GLM_FUNC_DECL noise_fractal(int octaves = 5, float frequency = 1.0f, float lacunarity = 2.0f, float gain = 0.5f);
+
+		int octaves;
+		float frequency;
+		float lacunarity;
+		float gain;
+		float period;
+		bool ridged;
+	};
+
+	/// 2D simplex noise of count points given in structure of arrays form, out[i] = simplex(vec2(x[i], y[i])).
+	/// From GLM_GTX_noise_batch extension.
+	GLM_FUNC_DECL void simplexBatch(std::size_t count, float const* x, float const* y, float* out);
+
+	/// 3D simplex noise of count points given in structure of arrays form, out[i] = simplex(vec3(x[i], y[i], z[i])).
+	/// From GLM_GTX_noise_batch extension.
+	GLM_FUNC_DECL void simplexBatch(std::size_t count, float const* x, float const* y, float const* z, float* out);
+
+	/// 2D periodic perlin noise of count points, out[i] = perlin(vec2(x[i], y[i]), rep).
+	/// From GLM_GTX_noise_batch extension.
+	GLM_FUNC_DECL void perlinBatch(std::size_t count, float const* x, float const* y, vec2 const& rep, float* out);
+
+	/// 3D periodic perlin noise of count points, out[i] = perlin(vec3(x[i], y[i], z[i]), rep).
+	/// From GLM_GTX_noise_batch extension.
+	GLM_FUNC_DECL void perlinBatch(std::size_t count, float const* x, float const* y, float const* z, vec3 const& rep, float* out);
+
+	/// Fractal noise at the count points origin + i * step, the building block of a heightmap row.
+	/// From GLM_GTX_noise_batch extension.
+	GLM_FUNC_DECL void fractalNoiseRow(noise_fractal const& fractal, vec2 const& origin, vec2 const& step, std::size_t count, float* out);
+
+	/// Fractal noise at the count points origin + i * step, the building block of a density volume row.
+	/// From GLM_GTX_noise_batch extension.
+	GLM_FUNC_DECL void fractalNoiseRow(noise_fractal const& fractal, vec3 const& origin, vec3 const& step, std::size_t count, float* out);
+
+	/// @}
+}//namespace glm
+
+#include "noise_batch.inl"
@@ -0,0 +1,174 @@
+/// @ref gtx_noise_batch
+
+namespace glm{
+namespace detail
+{
+#	include "noise_batch_simd.inl"
+
+#	if GLM_SIMD_DISPATCH_AVX2
+	GLM_SIMD_TARGET_AVX2_BEGIN
+	namespace avx2
+	{
+#	include "noise_batch_simd.inl"
+	}//namespace avx2
+	GLM_SIMD_TARGET_END
+#	endif//GLM_SIMD_DISPATCH_AVX2
+
+	typedef compute_noise_batch<float_packet_width> noise_batch;
+
+	// One entry per simd_dispatch tier. There is no 16 lane float_packet, AVX-512 CPUs run the AVX2 kernels
+	struct noise_batch_kernels
+	{
+		void (*noise2)(std::size_t, float const*, float const*, vec2 const&, bool, float*);
+		void (*noise3)(std::size_t, float const*, float const*, float const*, vec3 const&, bool, float*);
+	};
+
+	GLM_FUNC_QUALIFIER noise_batch_kernels const& noise_batch_dispatch()
+	{
+#		if GLM_SIMD_DISPATCH_AVX2
+		typedef avx2::compute_noise_batch<avx2::float_packet_width> noise_batch_avx2;
+#		else
+		typedef noise_batch noise_batch_avx2;
+#		endif
+		static noise_batch_kernels const Tiers[] =
+		{
+			{&noise_batch::noise2, &noise_batch::noise3},
+			{&noise_batch_avx2::noise2, &noise_batch_avx2::noise3},
+			{&noise_batch_avx2::noise2, &noise_batch_avx2::noise3}
+		};
+		return Tiers[simd_dispatch_current()];
+	}
+
+	// Points are evaluated in blocks small enough to keep every octave's coordinates on the stack
+	static std::size_t const noise_row_block = 64;
+
+	// Adds one octave's noise values to a block of the fractal sum; weight carries the previous ridged octave
+	GLM_FUNC_QUALIFIER void accumulateOctave(noise_fractal const& fractal, float amplitude, std::size_t count, float const* noise, float* weight, float* sum)
+	{
+		if(!fractal.ridged)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				sum[i] += amplitude * noise[i];
+			return;
+		}
+		for(std::size_t i = 0; i < count; ++i)
+		{
+			float Signal = 1.0f - (noise[i] < 0.0f ? -noise[i] : noise[i]);
+			Signal *= Signal * weight[i];
+			sum[i] += amplitude * Signal;
+			weight[i] = Signal;
+		}
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER noise_fractal::noise_fractal(int octaves, float frequency, float lacunarity, float gain)
+		: octaves(octaves)
+		, frequency(frequency)
+		, lacunarity(lacunarity)
+		, gain(gain)
+		, period(0.0f)
+		, ridged(false)
+	{}
+
+	GLM_FUNC_QUALIFIER void simplexBatch(std::size_t count, float const* x, float const* y, float* out)
+	{
+		detail::noise_batch_dispatch().noise2(count, x, y, vec2(0.0f), false, out);
+	}
+
+	GLM_FUNC_QUALIFIER void simplexBatch(std::size_t count, float const* x, float const* y, float const* z, float* out)
+	{
+		detail::noise_batch_dispatch().noise3(count, x, y, z, vec3(0.0f), false, out);
+	}
+
+	GLM_FUNC_QUALIFIER void perlinBatch(std::size_t count, float const* x, float const* y, vec2 const& rep, float* out)
+	{
+		detail::noise_batch_dispatch().noise2(count, x, y, rep, true, out);
+	}
+
+	GLM_FUNC_QUALIFIER void perlinBatch(std::size_t count, float const* x, float const* y, float const* z, vec3 const& rep, float* out)
+	{
+		detail::noise_batch_dispatch().noise3(count, x, y, z, rep, true, out);
+	}
+
+	GLM_FUNC_QUALIFIER void fractalNoiseRow(noise_fractal const& fractal, vec2 const& origin, vec2 const& step, std::size_t count, float* out)
+	{
+		detail::noise_batch_kernels const& Kernels = detail::noise_batch_dispatch();
+		std::size_t const Block = detail::noise_row_block;
+		float X[Block], Y[Block], Noise[Block], Weight[Block];
+		for(std::size_t Begin = 0; Begin < count; Begin += Block)
+		{
+			std::size_t const Count = count - Begin < Block ? count - Begin : Block;
+			float* Sum = out + Begin;
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				Sum[i] = 0.0f;
+				Weight[i] = 1.0f;
+			}
+
+			float Frequency = fractal.frequency;
+			float Amplitude = 1.0f;
+			float Total = 0.0f;
+			for(int Octave = 0; Octave < fractal.octaves; ++Octave)
+			{
+				// Shift every octave so they do not all share the lattice point at the origin
+				float const Shift = static_cast<float>(Octave) * 17.0f;
+				for(std::size_t i = 0; i < Count; ++i)
+				{
+					float const Offset = static_cast<float>(Begin + i);
+					X[i] = (origin.x + step.x * Offset) * Frequency + Shift;
+					Y[i] = (origin.y + step.y * Offset) * Frequency + Shift;
+				}
+				Kernels.noise2(Count, X, Y, vec2(fractal.period * Frequency), fractal.period > 0.0f, Noise);
+				detail::accumulateOctave(fractal, Amplitude, Count, Noise, Weight, Sum);
+				Total += Amplitude;
+				Frequency *= fractal.lacunarity;
+				Amplitude *= fractal.gain;
+			}
+
+			if(Total > 0.0f)
+				for(std::size_t i = 0; i < Count; ++i)
+					Sum[i] /= Total;
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void fractalNoiseRow(noise_fractal const& fractal, vec3 const& origin, vec3 const& step, std::size_t count, float* out)
+	{
+		detail::noise_batch_kernels const& Kernels = detail::noise_batch_dispatch();
+		std::size_t const Block = detail::noise_row_block;
+		float X[Block], Y[Block], Z[Block], Noise[Block], Weight[Block];
+		for(std::size_t Begin = 0; Begin < count; Begin += Block)
+		{
+			std::size_t const Count = count - Begin < Block ? count - Begin : Block;
+			float* Sum = out + Begin;
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				Sum[i] = 0.0f;
+				Weight[i] = 1.0f;
+			}
+
+			float Frequency = fractal.frequency;
+			float Amplitude = 1.0f;
+			float Total = 0.0f;
+			for(int Octave = 0; Octave < fractal.octaves; ++Octave)
+			{
+				float const Shift = static_cast<float>(Octave) * 17.0f;
+				for(std::size_t i = 0; i < Count; ++i)
+				{
+					float const Offset = static_cast<float>(Begin + i);
+					X[i] = (origin.x + step.x * Offset) * Frequency + Shift;
+					Y[i] = (origin.y + step.y * Offset) * Frequency + Shift;
+					Z[i] = (origin.z + step.z * Offset) * Frequency + Shift;
+				}
+				Kernels.noise3(Count, X, Y, Z, vec3(fractal.period * Frequency), fractal.period > 0.0f, Noise);
+				detail::accumulateOctave(fractal, Amplitude, Count, Noise, Weight, Sum);
+				Total += Amplitude;
+				Frequency *= fractal.lacunarity;
+				Amplitude *= fractal.gain;
+			}
+
+			if(Total > 0.0f)
+				for(std::size_t i = 0; i < Count; ++i)
+					Sum[i] /= Total;
+		}
+	}
+}//namespace glm
@@ -0,0 +1,384 @@
+/// @ref gtx_noise_batch
+/// Included once per kernel tier, inside that tier's namespace
+
+	// Scalar fallback, one GLM_GTC_noise call per point
+	template<length_t L, bool Simd = float_packet<L>::simd>
+	struct compute_noise_batch
+	{
+		GLM_FUNC_QUALIFIER static void noise2(std::size_t count, float const* x, float const* y, vec2 const& rep, bool periodic, float* out)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = periodic ? perlin(vec2(x[i], y[i]), rep) : simplex(vec2(x[i], y[i]));
+		}
+
+		GLM_FUNC_QUALIFIER static void noise3(std::size_t count, float const* x, float const* y, float const* z, vec3 const& rep, bool periodic, float* out)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = periodic ? perlin(vec3(x[i], y[i], z[i]), rep) : simplex(vec3(x[i], y[i], z[i]));
+		}
+	};
+
+	// The GLM_GTC_noise functions with every vector component held in its own register, one point per lane
+	template<length_t L>
+	struct compute_noise_batch<L, true>
+	{
+		typedef float_packet<L> P;
+		typedef typename P::type V;
+
+		GLM_FUNC_QUALIFIER static V fract(V x)
+		{
+			return P::sub(x, P::floor(x));
+		}
+
+		GLM_FUNC_QUALIFIER static V mod(V x, V y)
+		{
+			return P::sub(x, P::mul(y, P::floor(P::div(x, y))));
+		}
+
+		GLM_FUNC_QUALIFIER static V mod289(V x)
+		{
+			return P::sub(x, P::mul(P::floor(P::mul(x, P::set1(1.0f / 289.0f))), P::set1(289.0f)));
+		}
+
+		GLM_FUNC_QUALIFIER static V permute(V x)
+		{
+			return mod289(P::mul(P::add(P::mul(x, P::set1(34.0f)), P::set1(1.0f)), x));
+		}
+
+		GLM_FUNC_QUALIFIER static V taylorInvSqrt(V r)
+		{
+			return P::sub(P::set1(1.79284291400159f), P::mul(P::set1(0.85373472095314f), r));
+		}
+
+		GLM_FUNC_QUALIFIER static V fade(V t)
+		{
+			return P::mul(P::mul(P::mul(t, t), t), P::add(P::mul(t, P::sub(P::mul(t, P::set1(6.0f)), P::set1(15.0f))), P::set1(10.0f)));
+		}
+
+		GLM_FUNC_QUALIFIER static V mix(V x, V y, V a)
+		{
+			return P::add(P::mul(x, P::sub(P::set1(1.0f), a)), P::mul(y, a));
+		}
+
+		// step(edge, x): 0 where x < edge, 1 elsewhere
+		GLM_FUNC_QUALIFIER static V step(V edge, V x)
+		{
+			return P::and_(P::cmp_ge(x, edge), P::set1(1.0f));
+		}
+
+		GLM_FUNC_QUALIFIER static V simplex2(V vx, V vy)
+		{
+			V const C0 = P::set1(0.211324865405187f);
+			V const C1 = P::set1(0.366025403784439f);
+			V const C2 = P::set1(-0.577350269189626f);
+			V const C3 = P::set1(0.024390243902439f);
+			V const One = P::set1(1.0f);
+			V const Half = P::set1(0.5f);
+
+			// First corner
+			V const s = P::add(P::mul(vx, C1), P::mul(vy, C1));
+			V ix = P::floor(P::add(vx, s));
+			V iy = P::floor(P::add(vy, s));
+			V const t = P::add(P::mul(ix, C0), P::mul(iy, C0));
+			V const x0x = P::add(P::sub(vx, ix), t);
+			V const x0y = P::add(P::sub(vy, iy), t);
+
+			// Other corners
+			V const i1x = P::and_(P::cmp_gt(x0x, x0y), One);
+			V const i1y = P::sub(One, i1x);
+			V const x1x = P::sub(P::add(x0x, C0), i1x);
+			V const x1y = P::sub(P::add(x0y, C0), i1y);
+			V const x2x = P::add(x0x, C2);
+			V const x2y = P::add(x0y, C2);
+
+			// Permutations
+			V const Ring = P::set1(289.0f);
+			ix = mod(ix, Ring);
+			iy = mod(iy, Ring);
+			V const p0 = permute(P::add(permute(iy), ix));
+			V const p1 = permute(P::add(P::add(permute(P::add(iy, i1y)), ix), i1x));
+			V const p2 = permute(P::add(P::add(permute(P::add(iy, One)), ix), One));
+
+			V const Zero = P::set1(0.0f);
+			V m0 = P::max(P::sub(Half, P::add(P::mul(x0x, x0x), P::mul(x0y, x0y))), Zero);
+			V m1 = P::max(P::sub(Half, P::add(P::mul(x1x, x1x), P::mul(x1y, x1y))), Zero);
+			V m2 = P::max(P::sub(Half, P::add(P::mul(x2x, x2x), P::mul(x2y, x2y))), Zero);
+			m0 = P::mul(m0, m0);
+			m1 = P::mul(m1, m1);
+			m2 = P::mul(m2, m2);
+			m0 = P::mul(m0, m0);
+			m1 = P::mul(m1, m1);
+			m2 = P::mul(m2, m2);
+
+			// Gradients: 41 points uniformly over a line, mapped onto a diamond
+			V const Two = P::set1(2.0f);
+			V const gx0 = P::sub(P::mul(Two, fract(P::mul(p0, C3))), One);
+			V const gx1 = P::sub(P::mul(Two, fract(P::mul(p1, C3))), One);
+			V const gx2 = P::sub(P::mul(Two, fract(P::mul(p2, C3))), One);
+			V const h0 = P::sub(P::abs(gx0), Half);
+			V const h1 = P::sub(P::abs(gx1), Half);
+			V const h2 = P::sub(P::abs(gx2), Half);
+			V const a0 = P::sub(gx0, P::floor(P::add(gx0, Half)));
+			V const a1 = P::sub(gx1, P::floor(P::add(gx1, Half)));
+			V const a2 = P::sub(gx2, P::floor(P::add(gx2, Half)));
+
+			// Normalise gradients implicitly by scaling m
+			m0 = P::mul(m0, taylorInvSqrt(P::add(P::mul(a0, a0), P::mul(h0, h0))));
+			m1 = P::mul(m1, taylorInvSqrt(P::add(P::mul(a1, a1), P::mul(h1, h1))));
+			m2 = P::mul(m2, taylorInvSqrt(P::add(P::mul(a2, a2), P::mul(h2, h2))));
+
+			V const g0 = P::add(P::mul(a0, x0x), P::mul(h0, x0y));
+			V const g1 = P::add(P::mul(a1, x1x), P::mul(h1, x1y));
+			V const g2 = P::add(P::mul(a2, x2x), P::mul(h2, x2y));
+			return P::mul(P::set1(130.0f), P::add(P::add(P::mul(m0, g0), P::mul(m1, g1)), P::mul(m2, g2)));
+		}
+
+		// Gradient of one simplex corner: 7x7 points over a square, mapped onto an octahedron, returns its dot with
+		// the corner offset times its falloff
+		GLM_FUNC_QUALIFIER static V simplex3Corner(V p, V dx, V dy, V dz)
+		{
+			V const Zero = P::set1(0.0f);
+			V const One = P::set1(1.0f);
+			float const n_ = 0.142857142857f;
+			V const nsx = P::set1(n_ * 2.0f);
+			V const nsy = P::set1(n_ * 0.5f - 1.0f);
+			V const nsz = P::set1(n_);
+
+			V const j = P::sub(p, P::mul(P::set1(49.0f), P::floor(P::mul(P::mul(p, nsz), nsz))));
+			V const x_ = P::floor(P::mul(j, nsz));
+			V const y_ = P::floor(P::sub(j, P::mul(P::set1(7.0f), x_)));
+			V const x = P::add(P::mul(x_, nsx), nsy);
+			V const y = P::add(P::mul(y_, nsx), nsy);
+			V const h = P::sub(P::sub(One, P::abs(x)), P::abs(y));
+
+			V const sx = P::add(P::mul(P::floor(x), P::set1(2.0f)), One);
+			V const sy = P::add(P::mul(P::floor(y), P::set1(2.0f)), One);
+			V const sh = P::sub(Zero, step(h, Zero));
+			V gx = P::add(x, P::mul(sx, sh));
+			V gy = P::add(y, P::mul(sy, sh));
+			V gz = h;
+
+			V const norm = taylorInvSqrt(P::add(P::add(P::mul(gx, gx), P::mul(gy, gy)), P::mul(gz, gz)));
+			gx = P::mul(gx, norm);
+			gy = P::mul(gy, norm);
+			gz = P::mul(gz, norm);
+
+			V m = P::max(P::sub(P::set1(0.6f), P::add(P::add(P::mul(dx, dx), P::mul(dy, dy)), P::mul(dz, dz))), Zero);
+			m = P::mul(m, m);
+			return P::mul(P::mul(m, m), P::add(P::add(P::mul(gx, dx), P::mul(gy, dy)), P::mul(gz, dz)));
+		}
+
+		GLM_FUNC_QUALIFIER static V simplex3(V vx, V vy, V vz)
+		{
+			V const Cx = P::set1(1.0f / 6.0f);
+			V const Cy = P::set1(1.0f / 3.0f);
+			V const One = P::set1(1.0f);
+			V const Half = P::set1(0.5f);
+
+			// First corner
+			V const s = P::add(P::add(P::mul(vx, Cy), P::mul(vy, Cy)), P::mul(vz, Cy));
+			V ix = P::floor(P::add(vx, s));
+			V iy = P::floor(P::add(vy, s));
+			V iz = P::floor(P::add(vz, s));
+			V const t = P::add(P::add(P::mul(ix, Cx), P::mul(iy, Cx)), P::mul(iz, Cx));
+			V const x0x = P::add(P::sub(vx, ix), t);
+			V const x0y = P::add(P::sub(vy, iy), t);
+			V const x0z = P::add(P::sub(vz, iz), t);
+
+			// Other corners
+			V const gx = step(x0y, x0x);
+			V const gy = step(x0z, x0y);
+			V const gz = step(x0x, x0z);
+			V const lx = P::sub(One, gx);
+			V const ly = P::sub(One, gy);
+			V const lz = P::sub(One, gz);
+			V const i1x = P::min(gx, lz);
+			V const i1y = P::min(gy, lx);
+			V const i1z = P::min(gz, ly);
+			V const i2x = P::max(gx, lz);
+			V const i2y = P::max(gy, lx);
+			V const i2z = P::max(gz, ly);
+
+			V const x1x = P::add(P::sub(x0x, i1x), Cx);
+			V const x1y = P::add(P::sub(x0y, i1y), Cx);
+			V const x1z = P::add(P::sub(x0z, i1z), Cx);
+			V const x2x = P::add(P::sub(x0x, i2x), Cy);
+			V const x2y = P::add(P::sub(x0y, i2y), Cy);
+			V const x2z = P::add(P::sub(x0z, i2z), Cy);
+			V const x3x = P::sub(x0x, Half);
+			V const x3y = P::sub(x0y, Half);
+			V const x3z = P::sub(x0z, Half);
+
+			// Permutations
+			ix = mod289(ix);
+			iy = mod289(iy);
+			iz = mod289(iz);
+			V const p0 = permute(P::add(permute(P::add(permute(iz), iy)), ix));
+			V const p1 = permute(P::add(P::add(permute(P::add(P::add(permute(P::add(iz, i1z)), iy), i1y)), ix), i1x));
+			V const p2 = permute(P::add(P::add(permute(P::add(P::add(permute(P::add(iz, i2z)), iy), i2y)), ix), i2x));
+			V const p3 = permute(P::add(P::add(permute(P::add(P::add(permute(P::add(iz, One)), iy), One)), ix), One));
+
+			V const n0 = simplex3Corner(p0, x0x, x0y, x0z);
+			V const n1 = simplex3Corner(p1, x1x, x1y, x1z);
+			V const n2 = simplex3Corner(p2, x2x, x2y, x2z);
+			V const n3 = simplex3Corner(p3, x3x, x3y, x3z);
+			return P::mul(P::set1(42.0f), P::add(P::add(n0, n1), P::add(n2, n3)));
+		}
+
+		// One corner of 2D perlin noise: gradient from the hash, normalized, dotted with the offset to the corner
+		GLM_FUNC_QUALIFIER static V perlin2Corner(V ix, V iy, V fx, V fy)
+		{
+			V const i = permute(P::add(permute(ix), iy));
+			V gx = P::sub(P::mul(P::set1(2.0f), fract(P::div(i, P::set1(41.0f)))), P::set1(1.0f));
+			V gy = P::sub(P::abs(gx), P::set1(0.5f));
+			gx = P::sub(gx, P::floor(P::add(gx, P::set1(0.5f))));
+			V const norm = taylorInvSqrt(P::add(P::mul(gx, gx), P::mul(gy, gy)));
+			return P::add(P::mul(P::mul(gx, norm), fx), P::mul(P::mul(gy, norm), fy));
+		}
+
+		GLM_FUNC_QUALIFIER static V perlin2(V vx, V vy, V repx, V repy)
+		{
+			V const One = P::set1(1.0f);
+			V const Ring = P::set1(289.0f);
+			V const fx = P::floor(vx);
+			V const fy = P::floor(vy);
+			V const ix0 = mod(mod(fx, repx), Ring);
+			V const iy0 = mod(mod(fy, repy), Ring);
+			V const ix1 = mod(mod(P::add(fx, One), repx), Ring);
+			V const iy1 = mod(mod(P::add(fy, One), repy), Ring);
+			V const fx0 = P::sub(vx, fx);
+			V const fy0 = P::sub(vy, fy);
+			V const fx1 = P::sub(fx0, One);
+			V const fy1 = P::sub(fy0, One);
+
+			V const n00 = perlin2Corner(ix0, iy0, fx0, fy0);
+			V const n10 = perlin2Corner(ix1, iy0, fx1, fy0);
+			V const n01 = perlin2Corner(ix0, iy1, fx0, fy1);
+			V const n11 = perlin2Corner(ix1, iy1, fx1, fy1);
+
+			V const FadeX = fade(fx0);
+			V const FadeY = fade(fy0);
+			return P::mul(P::set1(2.3f), mix(mix(n00, n10, FadeX), mix(n01, n11, FadeX), FadeY));
+		}
+
+		// One corner of 3D perlin noise, ixy is the hash of the corner's x and y
+		GLM_FUNC_QUALIFIER static V perlin3Corner(V ixy, V iz, V fx, V fy, V fz)
+		{
+			V const Zero = P::set1(0.0f);
+			V const Half = P::set1(0.5f);
+			V const Seven = P::set1(7.0f);
+			V gx = P::div(permute(P::add(ixy, iz)), Seven);
+			V gy = P::sub(fract(P::div(P::floor(gx), Seven)), Half);
+			gx = fract(gx);
+			V const gz = P::sub(P::sub(Half, P::abs(gx)), P::abs(gy));
+			V const sz = step(gz, Zero);
+			gx = P::sub(gx, P::mul(sz, P::sub(step(Zero, gx), Half)));
+			gy = P::sub(gy, P::mul(sz, P::sub(step(Zero, gy), Half)));
+			V const norm = taylorInvSqrt(P::add(P::add(P::mul(gx, gx), P::mul(gy, gy)), P::mul(gz, gz)));
+			return P::add(P::add(P::mul(P::mul(gx, norm), fx), P::mul(P::mul(gy, norm), fy)), P::mul(P::mul(gz, norm), fz));
+		}
+
+		GLM_FUNC_QUALIFIER static V perlin3(V vx, V vy, V vz, V repx, V repy, V repz)
+		{
+			V const One = P::set1(1.0f);
+			V const Ring = P::set1(289.0f);
+			V const ix0 = mod(P::floor(vx), repx);
+			V const iy0 = mod(P::floor(vy), repy);
+			V const iz0 = mod(P::floor(vz), repz);
+			V const ix1 = mod(mod(P::add(ix0, One), repx), Ring);
+			V const iy1 = mod(mod(P::add(iy0, One), repy), Ring);
+			V const iz1 = mod(mod(P::add(iz0, One), repz), Ring);
+			V const jx0 = mod(ix0, Ring);
+			V const jy0 = mod(iy0, Ring);
+			V const jz0 = mod(iz0, Ring);
+			V const fx0 = fract(vx);
+			V const fy0 = fract(vy);
+			V const fz0 = fract(vz);
+			V const fx1 = P::sub(fx0, One);
+			V const fy1 = P::sub(fy0, One);
+			V const fz1 = P::sub(fz0, One);
+
+			V const h00 = permute(P::add(permute(jx0), jy0));
+			V const h10 = permute(P::add(permute(ix1), jy0));
+			V const h01 = permute(P::add(permute(jx0), iy1));
+			V const h11 = permute(P::add(permute(ix1), iy1));
+
+			V const n000 = perlin3Corner(h00, jz0, fx0, fy0, fz0);
+			V const n100 = perlin3Corner(h10, jz0, fx1, fy0, fz0);
+			V const n010 = perlin3Corner(h01, jz0, fx0, fy1, fz0);
+			V const n110 = perlin3Corner(h11, jz0, fx1, fy1, fz0);
+			V const n001 = perlin3Corner(h00, iz1, fx0, fy0, fz1);
+			V const n101 = perlin3Corner(h10, iz1, fx1, fy0, fz1);
+			V const n011 = perlin3Corner(h01, iz1, fx0, fy1, fz1);
+			V const n111 = perlin3Corner(h11, iz1, fx1, fy1, fz1);
+
+			V const FadeX = fade(fx0);
+			V const FadeY = fade(fy0);
+			V const FadeZ = fade(fz0);
+			V const nz00 = mix(n000, n001, FadeZ);
+			V const nz10 = mix(n100, n101, FadeZ);
+			V const nz01 = mix(n010, n011, FadeZ);
+			V const nz11 = mix(n110, n111, FadeZ);
+			return P::mul(P::set1(2.2f), mix(mix(nz00, nz01, FadeY), mix(nz10, nz11, FadeY), FadeX));
+		}
+
+		GLM_FUNC_QUALIFIER static V noise2(V x, V y, V repx, V repy, bool periodic)
+		{
+			return periodic ? perlin2(x, y, repx, repy) : simplex2(x, y);
+		}
+
+		GLM_FUNC_QUALIFIER static V noise3(V x, V y, V z, V repx, V repy, V repz, bool periodic)
+		{
+			return periodic ? perlin3(x, y, z, repx, repy, repz) : simplex3(x, y, z);
+		}
+
+		GLM_FUNC_QUALIFIER static void noise2(std::size_t count, float const* x, float const* y, vec2 const& rep, bool periodic, float* out)
+		{
+			V const repx = P::set1(rep.x);
+			V const repy = P::set1(rep.y);
+			std::size_t i = 0;
+			for(; i + L <= count; i += L)
+				P::store(out + i, noise2(P::load(x + i), P::load(y + i), repx, repy, periodic));
+			if(i == count)
+				return;
+
+			// Last partial packet, padded with zeros
+			float TailX[L] = {0};
+			float TailY[L] = {0};
+			float TailOut[L];
+			for(std::size_t j = 0; i + j < count; ++j)
+			{
+				TailX[j] = x[i + j];
+				TailY[j] = y[i + j];
+			}
+			P::store(TailOut, noise2(P::load(TailX), P::load(TailY), repx, repy, periodic));
+			for(std::size_t j = 0; i + j < count; ++j)
+				out[i + j] = TailOut[j];
+		}
+
+		GLM_FUNC_QUALIFIER static void noise3(std::size_t count, float const* x, float const* y, float const* z, vec3 const& rep, bool periodic, float* out)
+		{
+			V const repx = P::set1(rep.x);
+			V const repy = P::set1(rep.y);
+			V const repz = P::set1(rep.z);
+			std::size_t i = 0;
+			for(; i + L <= count; i += L)
+				P::store(out + i, noise3(P::load(x + i), P::load(y + i), P::load(z + i), repx, repy, repz, periodic));
+			if(i == count)
+				return;
+
+			float TailX[L] = {0};
+			float TailY[L] = {0};
+			float TailZ[L] = {0};
+			float TailOut[L];
+			for(std::size_t j = 0; i + j < count; ++j)
+			{
+				TailX[j] = x[i + j];
+				TailY[j] = y[i + j];
+				TailZ[j] = z[i + j];
+			}
+			P::store(TailOut, noise3(P::load(TailX), P::load(TailY), P::load(TailZ), repx, repy, repz, periodic));
+			for(std::size_t j = 0; i + j < count; ++j)
+				out[i + j] = TailOut[j];
+		}
+	};
@@ -0,0 +1,85 @@
+/// @ref gtx_quaternion_array
+/// @file glm/gtx/quaternion_array.hpp
+///
+/// @see core (dependence)
+/// @see gtc_quaternion (dependence)
+/// @see gtx_geometric_array (dependence)
+/// @see gtx_matrix_affine
+///
+/// @defgroup gtx_quaternion_array GLM_GTX_quaternion_array
+/// @ingroup gtx
+///
+/// Include <glm/gtx/quaternion_array.hpp> to use the features of this extension.
+///
+/// slerp, nlerp, product, vector rotation and conversion to mat3, mat4 or affine mat3x4 over whole arrays of quat.
+/// Like GLM_GTX_geometric_array, the SIMD paths transpose 4 quaternions at a time to one component per register and
+/// handle 8 quaternions per AVX register and 4 per SSE2 register; the last few, and every quaternion without SIMD,
+/// go through the core functions. The same kernels run on GLM_GTX_soa containers without the transposes.
+/// slerp evaluates acos and sin with polynomials, within 1e-6 of slerp for unit quaternions and t in [0, 1]; the
+/// other functions round like the core ones, up to the order of the additions.
+/// With GLM_CONFIG_SIMD_DISPATCH a build for a narrower GLM_ARCH still runs the AVX2 kernels on CPUs that have AVX2,
+/// see GLM_GTX_simd_dispatch.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/quaternion.hpp"
+#include "../gtx/geometric_array.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_quaternion_array is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	else
+#		pragma message("GLM: GLM_GTX_quaternion_array extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_quaternion_array
+	/// @{
+
+	/// out[i] = slerp(a[i], b[i], t): the shortest path interpolation of unit quaternions. out may be a or b.
+	/// From GLM_GTX_quaternion_array extension.
+	GLM_FUNC_DECL void slerpArray(quat const* a, quat const* b, float t, quat* out, std::size_t count);
+
+	/// out[i] = slerp(a[i], b[i], t[i]). out may be a or b.
+	/// From GLM_GTX_quaternion_array extension.
+	GLM_FUNC_DECL void slerpArray(quat const* a, quat const* b, float const* t, quat* out, std::size_t count);
+
+	/// out[i] = normalize(lerp(a[i], b[i], t)) after negating b[i] when dot(a[i], b[i]) < 0: the path of slerp at a
+	/// non constant speed, close to it when a[i] and b[i] are close, as between two animation keys. out may be a or b.
+	/// From GLM_GTX_quaternion_array extension.
+	GLM_FUNC_DECL void nlerpArray(quat const* a, quat const* b, float t, quat* out, std::size_t count);
+
+	/// nlerpArray with one interpolation factor per quaternion.
+	/// From GLM_GTX_quaternion_array extension.
+	GLM_FUNC_DECL void nlerpArray(quat const* a, quat const* b, float const* t, quat* out, std::size_t count);
+
+	/// out[i] = a[i] * b[i]. out may be a or b.
+	/// From GLM_GTX_quaternion_array extension.
+	GLM_FUNC_DECL void mulArray(quat const* a, quat const* b, quat* out, std::size_t count);
+
+	/// out[i] = q[i] * v[i], v[i] rotated by the unit quaternion q[i]. out may be v.
+	/// From GLM_GTX_quaternion_array extension.
+	GLM_FUNC_DECL void rotateArray(quat const* q, vec3 const* v, vec3* out, std::size_t count);
+
+	/// out[i] = mat3_cast(q[i]).
+	/// From GLM_GTX_quaternion_array extension.
+	GLM_FUNC_DECL void mat3_castArray(quat const* q, mat3* out, std::size_t count);
+
+	/// out[i] = mat4_cast(q[i]).
+	/// From GLM_GTX_quaternion_array extension.
+	GLM_FUNC_DECL void mat4_castArray(quat const* q, mat4* out, std::size_t count);
+
+	/// out[i] is the rotation q[i] followed by the translation t[i], as a GLM_GTX_matrix_affine mat3x4: one row of the
+	/// transform per column.
+	/// From GLM_GTX_quaternion_array extension.
+	GLM_FUNC_DECL void mat3x4_castArray(quat const* q, vec3 const* t, mat3x4* out, std::size_t count);
+
+	/// @}
+}//namespace glm
+
+#include "quaternion_array.inl"
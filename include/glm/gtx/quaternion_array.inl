@@ -0,0 +1,144 @@
+/// @ref gtx_quaternion_array
+
+namespace glm{
+namespace detail
+{
+#	include "quaternion_array_simd.inl"
+
+#	if GLM_SIMD_DISPATCH_AVX2
+	GLM_SIMD_TARGET_AVX2_BEGIN
+	namespace avx2
+	{
+#	include "quaternion_array_simd.inl"
+	}//namespace avx2
+	GLM_SIMD_TARGET_END
+#	endif//GLM_SIMD_DISPATCH_AVX2
+
+	typedef compute_quaternion_array<float_packet_width> quaternion_array;
+
+	// One entry per simd_dispatch tier. There is no 16 lane float_packet, AVX-512 CPUs run the AVX2 kernels
+	struct quaternion_array_kernels
+	{
+		std::size_t (*aos_slerp)(std::size_t, float const*, float const*, float const*, std::size_t, float*);
+		std::size_t (*aos_nlerp)(std::size_t, float const*, float const*, float const*, std::size_t, float*);
+		std::size_t (*aos_mul)(std::size_t, float const*, float const*, float*);
+		std::size_t (*aos_rotate)(std::size_t, float const*, float const*, float*);
+		std::size_t (*aos_mat3_cast)(std::size_t, float const*, float*);
+		std::size_t (*aos_mat4_cast)(std::size_t, float const*, float*);
+		std::size_t (*aos_mat3x4_cast)(std::size_t, float const*, float const*, float*);
+		std::size_t (*soa_slerp)(std::size_t, float const* const*, float const* const*, float const*, std::size_t, float* const*);
+		std::size_t (*soa_nlerp)(std::size_t, float const* const*, float const* const*, float const*, std::size_t, float* const*);
+		std::size_t (*soa_mul)(std::size_t, float const* const*, float const* const*, float* const*);
+		std::size_t (*soa_rotate)(std::size_t, float const* const*, float const* const*, float* const*);
+	};
+
+	GLM_FUNC_QUALIFIER quaternion_array_kernels const& quaternion_array_dispatch()
+	{
+#		if GLM_SIMD_DISPATCH_AVX2
+		typedef avx2::compute_quaternion_array<avx2::float_packet_width> quaternion_array_avx2;
+#		else
+		typedef quaternion_array quaternion_array_avx2;
+#		endif
+		static quaternion_array_kernels const Tiers[] =
+		{
+			{
+				&quaternion_array::aos_slerp, &quaternion_array::aos_nlerp, &quaternion_array::aos_mul, &quaternion_array::aos_rotate,
+				&quaternion_array::aos_mat3_cast, &quaternion_array::aos_mat4_cast, &quaternion_array::aos_mat3x4_cast,
+				&quaternion_array::soa_slerp, &quaternion_array::soa_nlerp, &quaternion_array::soa_mul, &quaternion_array::soa_rotate
+			},
+			{
+				&quaternion_array_avx2::aos_slerp, &quaternion_array_avx2::aos_nlerp, &quaternion_array_avx2::aos_mul, &quaternion_array_avx2::aos_rotate,
+				&quaternion_array_avx2::aos_mat3_cast, &quaternion_array_avx2::aos_mat4_cast, &quaternion_array_avx2::aos_mat3x4_cast,
+				&quaternion_array_avx2::soa_slerp, &quaternion_array_avx2::soa_nlerp, &quaternion_array_avx2::soa_mul, &quaternion_array_avx2::soa_rotate
+			},
+			{
+				&quaternion_array_avx2::aos_slerp, &quaternion_array_avx2::aos_nlerp, &quaternion_array_avx2::aos_mul, &quaternion_array_avx2::aos_rotate,
+				&quaternion_array_avx2::aos_mat3_cast, &quaternion_array_avx2::aos_mat4_cast, &quaternion_array_avx2::aos_mat3x4_cast,
+				&quaternion_array_avx2::soa_slerp, &quaternion_array_avx2::soa_nlerp, &quaternion_array_avx2::soa_mul, &quaternion_array_avx2::soa_rotate
+			}
+		};
+		return Tiers[simd_dispatch_current()];
+	}
+
+	GLM_FUNC_QUALIFIER quat nlerp(quat const& a, quat const& b, float t)
+	{
+		quat const c = dot(a, b) < 0.0f ? -b : b;
+		return normalize(lerp(a, c, t));
+	}
+
+	GLM_FUNC_QUALIFIER void slerp_array(quat const* a, quat const* b, float const* t, std::size_t TStep, quat* out, std::size_t count)
+	{
+		std::size_t i = quaternion_array_dispatch().aos_slerp(count, reinterpret_cast<float const*>(a), reinterpret_cast<float const*>(b), t, TStep, reinterpret_cast<float*>(out));
+		for(; i < count; ++i)
+			out[i] = slerp(a[i], b[i], t[i * TStep]);
+	}
+
+	GLM_FUNC_QUALIFIER void nlerp_array(quat const* a, quat const* b, float const* t, std::size_t TStep, quat* out, std::size_t count)
+	{
+		std::size_t i = quaternion_array_dispatch().aos_nlerp(count, reinterpret_cast<float const*>(a), reinterpret_cast<float const*>(b), t, TStep, reinterpret_cast<float*>(out));
+		for(; i < count; ++i)
+			out[i] = nlerp(a[i], b[i], t[i * TStep]);
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void slerpArray(quat const* a, quat const* b, float t, quat* out, std::size_t count)
+	{
+		detail::slerp_array(a, b, &t, 0, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void slerpArray(quat const* a, quat const* b, float const* t, quat* out, std::size_t count)
+	{
+		detail::slerp_array(a, b, t, 1, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void nlerpArray(quat const* a, quat const* b, float t, quat* out, std::size_t count)
+	{
+		detail::nlerp_array(a, b, &t, 0, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void nlerpArray(quat const* a, quat const* b, float const* t, quat* out, std::size_t count)
+	{
+		detail::nlerp_array(a, b, t, 1, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void mulArray(quat const* a, quat const* b, quat* out, std::size_t count)
+	{
+		std::size_t i = detail::quaternion_array_dispatch().aos_mul(count, reinterpret_cast<float const*>(a), reinterpret_cast<float const*>(b), reinterpret_cast<float*>(out));
+		for(; i < count; ++i)
+			out[i] = a[i] * b[i];
+	}
+
+	GLM_FUNC_QUALIFIER void rotateArray(quat const* q, vec3 const* v, vec3* out, std::size_t count)
+	{
+		std::size_t i = detail::quaternion_array_dispatch().aos_rotate(count, reinterpret_cast<float const*>(q), reinterpret_cast<float const*>(v), reinterpret_cast<float*>(out));
+		for(; i < count; ++i)
+			out[i] = q[i] * v[i];
+	}
+
+	GLM_FUNC_QUALIFIER void mat3_castArray(quat const* q, mat3* out, std::size_t count)
+	{
+		std::size_t i = detail::quaternion_array_dispatch().aos_mat3_cast(count, reinterpret_cast<float const*>(q), reinterpret_cast<float*>(out));
+		for(; i < count; ++i)
+			out[i] = mat3_cast(q[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void mat4_castArray(quat const* q, mat4* out, std::size_t count)
+	{
+		std::size_t i = detail::quaternion_array_dispatch().aos_mat4_cast(count, reinterpret_cast<float const*>(q), reinterpret_cast<float*>(out));
+		for(; i < count; ++i)
+			out[i] = mat4_cast(q[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void mat3x4_castArray(quat const* q, vec3 const* t, mat3x4* out, std::size_t count)
+	{
+		std::size_t i = detail::quaternion_array_dispatch().aos_mat3x4_cast(count, reinterpret_cast<float const*>(q), reinterpret_cast<float const*>(t), reinterpret_cast<float*>(out));
+		for(; i < count; ++i)
+		{
+			mat3 const r = mat3_cast(q[i]);
+			out[i] = mat3x4(
+				vec4(r[0][0], r[1][0], r[2][0], t[i].x),
+				vec4(r[0][1], r[1][1], r[2][1], t[i].y),
+				vec4(r[0][2], r[1][2], r[2][2], t[i].z));
+		}
+	}
+}//namespace glm
@@ -0,0 +1,365 @@
+/// @ref gtx_quaternion_array
+/// Included once per kernel tier, inside that tier's namespace, after the GLM_GTX_geometric_array kernels
+
+	// Scalar fallback, the caller runs every quaternion through the core functions. Each function handles a prefix of
+	// the arrays and returns its length. t is read at t[i] when TStep is 1 and at t[0] for every quaternion when it is 0
+	template<length_t L, bool Simd = float_packet<L>::simd>
+	struct compute_quaternion_array
+	{
+		GLM_FUNC_QUALIFIER static std::size_t aos_slerp(std::size_t, float const*, float const*, float const*, std::size_t, float*) { return 0; }
+		GLM_FUNC_QUALIFIER static std::size_t aos_nlerp(std::size_t, float const*, float const*, float const*, std::size_t, float*) { return 0; }
+		GLM_FUNC_QUALIFIER static std::size_t aos_mul(std::size_t, float const*, float const*, float*) { return 0; }
+		GLM_FUNC_QUALIFIER static std::size_t aos_rotate(std::size_t, float const*, float const*, float*) { return 0; }
+		GLM_FUNC_QUALIFIER static std::size_t aos_mat3_cast(std::size_t, float const*, float*) { return 0; }
+		GLM_FUNC_QUALIFIER static std::size_t aos_mat4_cast(std::size_t, float const*, float*) { return 0; }
+		GLM_FUNC_QUALIFIER static std::size_t aos_mat3x4_cast(std::size_t, float const*, float const*, float*) { return 0; }
+		GLM_FUNC_QUALIFIER static std::size_t soa_slerp(std::size_t, float const* const*, float const* const*, float const*, std::size_t, float* const*) { return 0; }
+		GLM_FUNC_QUALIFIER static std::size_t soa_nlerp(std::size_t, float const* const*, float const* const*, float const*, std::size_t, float* const*) { return 0; }
+		GLM_FUNC_QUALIFIER static std::size_t soa_mul(std::size_t, float const* const*, float const* const*, float* const*) { return 0; }
+		GLM_FUNC_QUALIFIER static std::size_t soa_rotate(std::size_t, float const* const*, float const* const*, float* const*) { return 0; }
+	};
+
+#	if GLM_CONFIG_SIMD == GLM_ENABLE
+	template<length_t L>
+	struct compute_quaternion_array<L, true>
+	{
+		typedef float_packet<L> P;
+		typedef typename P::type V;
+		typedef compute_geometric_array<L> geometric;
+		typedef typename geometric::template aos<3, geometric::vec3_stride> vec3_aos;
+		typedef typename geometric::template soa<3> vec3_soa;
+		typedef typename geometric::template soa<4> quat_soa;
+
+		// Floats between two mat3 of an array, 12 when the columns are aligned and padded
+		static length_t const mat3_stride = static_cast<length_t>(sizeof(mat3) / sizeof(float));
+
+		// Arrays of quat, loaded to and stored from x, y, z, w registers whatever the storage order of quat
+		struct quat_aos
+		{
+			GLM_FUNC_QUALIFIER static void load(float const* p, std::size_t i, V* v)
+			{
+				geometric::template aos<4, 4>::load(p, i, v);
+#				ifdef GLM_FORCE_QUAT_DATA_WXYZ
+				V const w = v[0];
+				v[0] = v[1];
+				v[1] = v[2];
+				v[2] = v[3];
+				v[3] = w;
+#				endif
+			}
+
+			GLM_FUNC_QUALIFIER static void store(float* p, std::size_t i, V const* v)
+			{
+#				ifdef GLM_FORCE_QUAT_DATA_WXYZ
+				V const m[4] = {v[3], v[0], v[1], v[2]};
+				geometric::template aos<4, 4>::store(p, i, m);
+#				else
+				geometric::template aos<4, 4>::store(p, i, v);
+#				endif
+			}
+		};
+
+		// Four registers holding one row each to four holding one column each, per block of 4 lanes
+		GLM_FUNC_QUALIFIER static void transpose(V* r)
+		{
+			V const xy01 = P::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(r[0], r[1]);
+			V const xy23 = P::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(r[0], r[1]);
+			V const zw01 = P::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(r[2], r[3]);
+			V const zw23 = P::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(r[2], r[3]);
+			r[0] = P::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(xy01, zw01);
+			r[1] = P::template shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(xy01, zw01);
+			r[2] = P::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(xy23, zw23);
+			r[3] = P::template shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(xy23, zw23);
+		}
+
+		// Arrays of matrices Stride floats apart with Cols columns of 4 floats, m[c * 4 + r] holding row r of column c
+		template<length_t Cols, length_t Stride>
+		GLM_FUNC_QUALIFIER static void store_matrix(float* p, std::size_t i, V const* m)
+		{
+			p += i * Stride;
+			for(length_t c = 0; c < Cols; ++c)
+			{
+				V r[4] = {m[c * 4 + 0], m[c * 4 + 1], m[c * 4 + 2], m[c * 4 + 3]};
+				transpose(r);
+				for(length_t k = 0; k < 4; ++k)
+					P::store(p + k * Stride + c * 4, 4 * Stride, r[k]);
+			}
+		}
+
+		// Packed mat3 columns are not 4 floats apart, they go through the stack
+		GLM_FUNC_QUALIFIER static void store_mat3(float* p, std::size_t i, V const* m)
+		{
+			if(mat3_stride != 9)
+			{
+				store_matrix<3, mat3_stride>(p, i, m);
+				return;
+			}
+
+			float Lanes[12][L];
+			for(length_t j = 0; j < 12; ++j)
+				P::store(Lanes[j], m[j]);
+			p += i * 9;
+			for(length_t l = 0; l < L; ++l)
+				for(length_t c = 0; c < 3; ++c)
+					for(length_t r = 0; r < 3; ++r)
+						p[l * 9 + c * 3 + r] = Lanes[c * 4 + r][l];
+		}
+
+		GLM_FUNC_QUALIFIER static V load_t(float const* t, std::size_t TStep, std::size_t i)
+		{
+			return TStep ? P::load(t + i) : P::set1(t[0]);
+		}
+
+		GLM_FUNC_QUALIFIER static V dot_lanes(V const* a, V const* b)
+		{
+			return P::add(P::add(P::mul(a[0], b[0]), P::mul(a[1], b[1])), P::add(P::mul(a[2], b[2]), P::mul(a[3], b[3])));
+		}
+
+		// Flips b where dot(a, b) < 0 and returns the absolute value of the dot product
+		GLM_FUNC_QUALIFIER static V shortest_path(V const* a, V* b)
+		{
+			V const Dot = dot_lanes(a, b);
+			V const Sign = P::and_(P::cmp_lt(Dot, P::set1(0.0f)), P::set1(-0.0f));
+			for(length_t c = 0; c < 4; ++c)
+				b[c] = P::xor_(b[c], Sign);
+			return P::xor_(Dot, Sign);
+		}
+
+		// acos(x) for x in [0, 1], Abramowitz and Stegun 4.4.46, within 2e-8
+		GLM_FUNC_QUALIFIER static V acos_unit(V x)
+		{
+			V Poly = P::set1(-0.0012624911f);
+			Poly = P::add(P::mul(Poly, x), P::set1(0.0066700901f));
+			Poly = P::add(P::mul(Poly, x), P::set1(-0.0170881256f));
+			Poly = P::add(P::mul(Poly, x), P::set1(0.0308918810f));
+			Poly = P::add(P::mul(Poly, x), P::set1(-0.0501743046f));
+			Poly = P::add(P::mul(Poly, x), P::set1(0.0889789874f));
+			Poly = P::add(P::mul(Poly, x), P::set1(-0.2145988016f));
+			Poly = P::add(P::mul(Poly, x), P::set1(1.5707963050f));
+			return P::mul(P::sqrt(P::sub(P::set1(1.0f), x)), Poly);
+		}
+
+		// sin(x) for x in [0, pi / 2], Taylor series to x^11, within 6e-8
+		GLM_FUNC_QUALIFIER static V sin_quarter(V x)
+		{
+			V const x2 = P::mul(x, x);
+			V Poly = P::set1(-2.5052108e-8f);
+			Poly = P::add(P::mul(Poly, x2), P::set1(2.7557319e-6f));
+			Poly = P::add(P::mul(Poly, x2), P::set1(-1.9841270e-4f));
+			Poly = P::add(P::mul(Poly, x2), P::set1(8.3333333e-3f));
+			Poly = P::add(P::mul(Poly, x2), P::set1(-1.6666667e-1f));
+			return P::add(x, P::mul(P::mul(x, x2), Poly));
+		}
+
+		template<typename Access, typename In, typename Out>
+		GLM_FUNC_QUALIFIER static std::size_t slerp(std::size_t count, In a, In b, float const* t, std::size_t TStep, Out out)
+		{
+			V const One = P::set1(1.0f);
+			V const Threshold = P::set1(1.0f - epsilon<float>());
+			std::size_t i = 0;
+			for(; i + L <= count; i += L)
+			{
+				V va[4], vb[4];
+				Access::load(a, i, va);
+				Access::load(b, i, vb);
+				V const T = load_t(t, TStep, i);
+				V const Cos = shortest_path(va, vb);
+				V const Angle = acos_unit(Cos);
+				V const InvSin = P::div(One, sin_quarter(Angle));
+				// Nearly equal quaternions interpolate linearly like slerp, which also avoids 0 / 0
+				V const Linear = P::cmp_gt(Cos, Threshold);
+				V const Wa = P::select(Linear, P::sub(One, T), P::mul(sin_quarter(P::mul(P::sub(One, T), Angle)), InvSin));
+				V const Wb = P::select(Linear, T, P::mul(sin_quarter(P::mul(T, Angle)), InvSin));
+				for(length_t c = 0; c < 4; ++c)
+					va[c] = P::add(P::mul(va[c], Wa), P::mul(vb[c], Wb));
+				Access::store(out, i, va);
+			}
+			return i;
+		}
+
+		template<typename Access, typename In, typename Out>
+		GLM_FUNC_QUALIFIER static std::size_t nlerp(std::size_t count, In a, In b, float const* t, std::size_t TStep, Out out)
+		{
+			V const Half = P::set1(0.5f);
+			V const ThreeHalfs = P::set1(1.5f);
+			std::size_t i = 0;
+			for(; i + L <= count; i += L)
+			{
+				V va[4], vb[4];
+				Access::load(a, i, va);
+				Access::load(b, i, vb);
+				V const T = load_t(t, TStep, i);
+				V const S = P::sub(P::set1(1.0f), T);
+				shortest_path(va, vb);
+				for(length_t c = 0; c < 4; ++c)
+					va[c] = P::add(P::mul(va[c], S), P::mul(vb[c], T));
+				// rsqrt and one Newton step, as normalizeArray
+				V const d = dot_lanes(va, va);
+				V y = P::rsqrt(d);
+				y = P::mul(y, P::sub(ThreeHalfs, P::mul(P::mul(P::mul(d, Half), y), y)));
+				for(length_t c = 0; c < 4; ++c)
+					va[c] = P::mul(va[c], y);
+				Access::store(out, i, va);
+			}
+			return i;
+		}
+
+		template<typename Access, typename In, typename Out>
+		GLM_FUNC_QUALIFIER static std::size_t mul(std::size_t count, In a, In b, Out out)
+		{
+			std::size_t i = 0;
+			for(; i + L <= count; i += L)
+			{
+				V va[4], vb[4], v[4];
+				Access::load(a, i, va);
+				Access::load(b, i, vb);
+				v[0] = P::add(P::add(P::mul(va[3], vb[0]), P::mul(va[0], vb[3])), P::sub(P::mul(va[1], vb[2]), P::mul(va[2], vb[1])));
+				v[1] = P::add(P::add(P::mul(va[3], vb[1]), P::mul(va[1], vb[3])), P::sub(P::mul(va[2], vb[0]), P::mul(va[0], vb[2])));
+				v[2] = P::add(P::add(P::mul(va[3], vb[2]), P::mul(va[2], vb[3])), P::sub(P::mul(va[0], vb[1]), P::mul(va[1], vb[0])));
+				v[3] = P::sub(P::sub(P::mul(va[3], vb[3]), P::mul(va[0], vb[0])), P::add(P::mul(va[1], vb[1]), P::mul(va[2], vb[2])));
+				Access::store(out, i, v);
+			}
+			return i;
+		}
+
+		// v + 2 (w uv + uuv) with uv = cross(q.xyz, v) and uuv = cross(q.xyz, uv), as quat * vec3
+		template<typename QAccess, typename VAccess, typename QIn, typename VIn, typename VOut>
+		GLM_FUNC_QUALIFIER static std::size_t rotate(std::size_t count, QIn q, VIn v, VOut out)
+		{
+			V const Two = P::set1(2.0f);
+			std::size_t i = 0;
+			for(; i + L <= count; i += L)
+			{
+				V vq[4], vv[4], uv[3], uuv[3];
+				QAccess::load(q, i, vq);
+				VAccess::load(v, i, vv);
+				uv[0] = P::sub(P::mul(vq[1], vv[2]), P::mul(vq[2], vv[1]));
+				uv[1] = P::sub(P::mul(vq[2], vv[0]), P::mul(vq[0], vv[2]));
+				uv[2] = P::sub(P::mul(vq[0], vv[1]), P::mul(vq[1], vv[0]));
+				uuv[0] = P::sub(P::mul(vq[1], uv[2]), P::mul(vq[2], uv[1]));
+				uuv[1] = P::sub(P::mul(vq[2], uv[0]), P::mul(vq[0], uv[2]));
+				uuv[2] = P::sub(P::mul(vq[0], uv[1]), P::mul(vq[1], uv[0]));
+				for(length_t c = 0; c < 3; ++c)
+					vv[c] = P::add(vv[c], P::mul(P::add(P::mul(uv[c], vq[3]), uuv[c]), Two));
+				VAccess::store(out, i, vv);
+			}
+			return i;
+		}
+
+		// mat3_cast of the quaternions, m[c * 4 + r] holding row r of column c and zero in row 3
+		GLM_FUNC_QUALIFIER static void rotation(V const* q, V* m)
+		{
+			V const One = P::set1(1.0f);
+			V const Two = P::set1(2.0f);
+			V const xx = P::mul(q[0], q[0]);
+			V const yy = P::mul(q[1], q[1]);
+			V const zz = P::mul(q[2], q[2]);
+			V const xz = P::mul(q[0], q[2]);
+			V const xy = P::mul(q[0], q[1]);
+			V const yz = P::mul(q[1], q[2]);
+			V const wx = P::mul(q[3], q[0]);
+			V const wy = P::mul(q[3], q[1]);
+			V const wz = P::mul(q[3], q[2]);
+
+			m[0] = P::sub(One, P::mul(Two, P::add(yy, zz)));
+			m[1] = P::mul(Two, P::add(xy, wz));
+			m[2] = P::mul(Two, P::sub(xz, wy));
+			m[4] = P::mul(Two, P::sub(xy, wz));
+			m[5] = P::sub(One, P::mul(Two, P::add(xx, zz)));
+			m[6] = P::mul(Two, P::add(yz, wx));
+			m[8] = P::mul(Two, P::add(xz, wy));
+			m[9] = P::mul(Two, P::sub(yz, wx));
+			m[10] = P::sub(One, P::mul(Two, P::add(xx, yy)));
+			m[3] = m[7] = m[11] = P::set1(0.0f);
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t aos_mat3_cast(std::size_t count, float const* q, float* out)
+		{
+			std::size_t i = 0;
+			for(; i + L <= count; i += L)
+			{
+				V vq[4], m[12];
+				quat_aos::load(q, i, vq);
+				rotation(vq, m);
+				store_mat3(out, i, m);
+			}
+			return i;
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t aos_mat4_cast(std::size_t count, float const* q, float* out)
+		{
+			std::size_t i = 0;
+			for(; i + L <= count; i += L)
+			{
+				V vq[4], m[16];
+				quat_aos::load(q, i, vq);
+				rotation(vq, m);
+				m[12] = m[13] = m[14] = P::set1(0.0f);
+				m[15] = P::set1(1.0f);
+				store_matrix<4, 16>(out, i, m);
+			}
+			return i;
+		}
+
+		// Column r of a mat3x4 is row r of the rotation followed by component r of the translation
+		GLM_FUNC_QUALIFIER static std::size_t aos_mat3x4_cast(std::size_t count, float const* q, float const* t, float* out)
+		{
+			std::size_t i = 0;
+			for(; i + L <= count; i += L)
+			{
+				V vq[4], vt[4], r[12], m[12];
+				quat_aos::load(q, i, vq);
+				vec3_aos::load(t, i, vt);
+				rotation(vq, r);
+				for(length_t Row = 0; Row < 3; ++Row)
+				{
+					for(length_t c = 0; c < 3; ++c)
+						m[Row * 4 + c] = r[c * 4 + Row];
+					m[Row * 4 + 3] = vt[Row];
+				}
+				store_matrix<3, 12>(out, i, m);
+			}
+			return i;
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t aos_slerp(std::size_t count, float const* a, float const* b, float const* t, std::size_t TStep, float* out)
+		{
+			return slerp<quat_aos>(count, a, b, t, TStep, out);
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t aos_nlerp(std::size_t count, float const* a, float const* b, float const* t, std::size_t TStep, float* out)
+		{
+			return nlerp<quat_aos>(count, a, b, t, TStep, out);
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t aos_mul(std::size_t count, float const* a, float const* b, float* out)
+		{
+			return mul<quat_aos>(count, a, b, out);
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t aos_rotate(std::size_t count, float const* q, float const* v, float* out)
+		{
+			return rotate<quat_aos, vec3_aos>(count, q, v, out);
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t soa_slerp(std::size_t count, float const* const* a, float const* const* b, float const* t, std::size_t TStep, float* const* out)
+		{
+			return slerp<quat_soa>(count, a, b, t, TStep, out);
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t soa_nlerp(std::size_t count, float const* const* a, float const* const* b, float const* t, std::size_t TStep, float* const* out)
+		{
+			return nlerp<quat_soa>(count, a, b, t, TStep, out);
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t soa_mul(std::size_t count, float const* const* a, float const* const* b, float* const* out)
+		{
+			return mul<quat_soa>(count, a, b, out);
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t soa_rotate(std::size_t count, float const* const* q, float const* const* v, float* const* out)
+		{
+			return rotate<quat_soa, vec3_soa>(count, q, v, out);
+		}
+	};
+#	endif//GLM_CONFIG_SIMD == GLM_ENABLE
@@ -0,0 +1,57 @@
+/// @ref gtx_simd_dispatch
+/// @file glm/gtx/simd_dispatch.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_simd_dispatch GLM_GTX_simd_dispatch
+/// @ingroup gtx
+///
+/// Include <glm/gtx/simd_dispatch.hpp> to use the features of this extension.
+///
+/// Queries and limits the runtime dispatch of the bulk SIMD functions (GLM_GTX_transform_array, GLM_GTX_noise_batch).
+/// When GLM_CONFIG_SIMD_DISPATCH is enabled, x86 builds whose GLM_ARCH is narrower than AVX-512 also compile AVX2 and
+/// AVX-512 kernels for these functions and pick one with cpuid on their first call, so a binary built for SSE2 still
+/// runs the wide kernels on CPUs that have them. Every other GLM function keeps using the GLM_ARCH code inline.
+/// Define GLM_FORCE_NO_SIMD_DISPATCH to turn the dispatch off.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../detail/_simd_dispatch.hpp"
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_simd_dispatch is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	else
+#		pragma message("GLM: GLM_GTX_simd_dispatch extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_simd_dispatch
+	/// @{
+
+	/// Instruction sets of the running CPU, queried once. All false without GLM_CONFIG_SIMD_DISPATCH.
+	/// From GLM_GTX_simd_dispatch extension.
+	GLM_FUNC_DECL cpu_features const& cpuFeatures();
+
+	/// Tier the bulk SIMD functions currently run.
+	/// From GLM_GTX_simd_dispatch extension.
+	GLM_FUNC_DECL simd_dispatch simdDispatch();
+
+	/// Caps the tier of the bulk SIMD functions, to compare tiers or to avoid AVX-512 clock throttling.
+	/// simd_dispatch_avx512, the default, lets them use whatever the CPU supports. Not synchronized: set it before
+	/// other threads call the bulk functions.
+	/// From GLM_GTX_simd_dispatch extension.
+	GLM_FUNC_DECL void simdDispatchLimit(simd_dispatch limit);
+
+	/// Name of a tier for logs: "GLM_ARCH", "AVX2" or "AVX-512".
+	/// From GLM_GTX_simd_dispatch extension.
+	GLM_FUNC_DECL char const* simdDispatchName(simd_dispatch tier);
+
+	/// @}
+}//namespace glm
+
+#include "simd_dispatch.inl"
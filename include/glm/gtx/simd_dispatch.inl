@@ -0,0 +1,32 @@
+/// @ref gtx_simd_dispatch
+
+namespace glm
+{
+	GLM_FUNC_QUALIFIER cpu_features const& cpuFeatures()
+	{
+		return detail::cpu_features_get();
+	}
+
+	GLM_FUNC_QUALIFIER simd_dispatch simdDispatch()
+	{
+		return detail::simd_dispatch_current();
+	}
+
+	GLM_FUNC_QUALIFIER void simdDispatchLimit(simd_dispatch limit)
+	{
+		detail::simd_dispatch_limit() = limit;
+	}
+
+	GLM_FUNC_QUALIFIER char const* simdDispatchName(simd_dispatch tier)
+	{
+		switch(tier)
+		{
+		case simd_dispatch_avx2:
+			return "AVX2";
+		case simd_dispatch_avx512:
+			return "AVX-512";
+		default:
+			return "GLM_ARCH";
+		}
+	}
+}//namespace glm
@@ -0,0 +1,66 @@
+/// @ref gtx_skinning
+/// @file glm/gtx/skinning.hpp
+///
+/// @see core (dependence)
+/// @see gtx_dual_quaternion (dependence)
+/// @see gtx_quaternion_array (dependence)
+/// @see gtx_matrix_affine
+///
+/// @defgroup gtx_skinning GLM_GTX_skinning
+/// @ingroup gtx
+///
+/// Include <glm/gtx/skinning.hpp> to use the features of this extension.
+///
+/// Skinning of whole vertex arrays: every vertex blends up to four joints of a palette, by their weights, and the
+/// blend moves its position and normal. Dual quaternion skinning blends the joints as dual quaternions and keeps the
+/// volume where joints twist; linear blend skinning blends the joint matrices, cheaper and the usual reference.
+/// The SIMD paths skin 8 vertices per AVX register and 4 per SSE2 register, with one component per register: dual
+/// quaternions are gathered from the palette 4 vertices at a time and transposed, matrices are blended per vertex
+/// and the blends transposed. The last few vertices, and every vertex without SIMD, go through the
+/// GLM_GTX_dual_quaternion and matrix functions.
+/// Influences whose weight is 0 for a whole register may be skipped, their joint index must still be in the palette.
+/// With GLM_CONFIG_SIMD_DISPATCH a build for a narrower GLM_ARCH still runs the AVX2 kernels on CPUs that have AVX2,
+/// see GLM_GTX_simd_dispatch.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../ext/vector_uint4_sized.hpp"
+#include "../gtx/dual_quaternion.hpp"
+#include "../gtx/quaternion_array.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_skinning is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	else
+#		pragma message("GLM: GLM_GTX_skinning extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_skinning
+	/// @{
+
+	/// Dual quaternion skinning. Vertex i blends palette[joints[i][k]] by weights[i][k], negating the joints whose
+	/// rotation points away from the blend so far, normalizes the blend and transforms positions[i] and rotates
+	/// normals[i] with it. The palette holds unit dual quaternions; outPositions and outNormals may be positions and normals.
+	/// From GLM_GTX_skinning extension.
+	GLM_FUNC_DECL void skinDualQuatArray(
+		dualquat const* palette, u16vec4 const* joints, vec4 const* weights,
+		vec3 const* positions, vec3 const* normals, vec3* outPositions, vec3* outNormals, std::size_t count);
+
+	/// Linear blend skinning. Vertex i blends the affine transforms palette[joints[i][k]] by weights[i][k], in the
+	/// GLM_GTX_matrix_affine mat3x4 layout of mat3x4_castArray, transforms positions[i] and normalizes the transformed
+	/// normals[i]. outPositions and outNormals may be positions and normals.
+	/// From GLM_GTX_skinning extension.
+	GLM_FUNC_DECL void skinLinearArray(
+		mat3x4 const* palette, u16vec4 const* joints, vec4 const* weights,
+		vec3 const* positions, vec3 const* normals, vec3* outPositions, vec3* outNormals, std::size_t count);
+
+	/// @}
+}//namespace glm
+
+#include "skinning.inl"
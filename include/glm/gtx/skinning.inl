@@ -0,0 +1,85 @@
+/// @ref gtx_skinning
+
+namespace glm{
+namespace detail
+{
+#	include "skinning_simd.inl"
+
+#	if GLM_SIMD_DISPATCH_AVX2
+	GLM_SIMD_TARGET_AVX2_BEGIN
+	namespace avx2
+	{
+#	include "skinning_simd.inl"
+	}//namespace avx2
+	GLM_SIMD_TARGET_END
+#	endif//GLM_SIMD_DISPATCH_AVX2
+
+	typedef compute_skinning<float_packet_width> skinning;
+
+	// One entry per simd_dispatch tier. There is no 16 lane float_packet, AVX-512 CPUs run the AVX2 kernels
+	struct skinning_kernels
+	{
+		std::size_t (*dual_quat)(std::size_t, float const*, unsigned short const*, float const*, float const*, float const*, float*, float*);
+		std::size_t (*linear)(std::size_t, float const*, unsigned short const*, float const*, float const*, float const*, float*, float*);
+	};
+
+	GLM_FUNC_QUALIFIER skinning_kernels const& skinning_dispatch()
+	{
+#		if GLM_SIMD_DISPATCH_AVX2
+		typedef avx2::compute_skinning<avx2::float_packet_width> skinning_avx2;
+#		else
+		typedef skinning skinning_avx2;
+#		endif
+		static skinning_kernels const Tiers[] =
+		{
+			{&skinning::dual_quat, &skinning::linear},
+			{&skinning_avx2::dual_quat, &skinning_avx2::linear},
+			{&skinning_avx2::dual_quat, &skinning_avx2::linear}
+		};
+		return Tiers[simd_dispatch_current()];
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void skinDualQuatArray(
+		dualquat const* palette, u16vec4 const* joints, vec4 const* weights,
+		vec3 const* positions, vec3 const* normals, vec3* outPositions, vec3* outNormals, std::size_t count)
+	{
+		std::size_t i = detail::skinning_dispatch().dual_quat(count, reinterpret_cast<float const*>(palette),
+			reinterpret_cast<unsigned short const*>(joints), reinterpret_cast<float const*>(weights),
+			reinterpret_cast<float const*>(positions), reinterpret_cast<float const*>(normals),
+			reinterpret_cast<float*>(outPositions), reinterpret_cast<float*>(outNormals));
+		for(; i < count; ++i)
+		{
+			dualquat Blend = palette[joints[i].x] * weights[i].x;
+			for(length_t k = 1; k < 4; ++k)
+			{
+				if(weights[i][k] == 0.0f)
+					continue;
+				dualquat const& Joint = palette[joints[i][k]];
+				Blend = Blend + Joint * (dot(Joint.real, Blend.real) < 0.0f ? -weights[i][k] : weights[i][k]);
+			}
+			Blend = normalize(Blend);
+			outPositions[i] = vec3(Blend * vec<3, float, highp>(positions[i]));
+			outNormals[i] = vec3(Blend.real * vec<3, float, highp>(normals[i]));
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void skinLinearArray(
+		mat3x4 const* palette, u16vec4 const* joints, vec4 const* weights,
+		vec3 const* positions, vec3 const* normals, vec3* outPositions, vec3* outNormals, std::size_t count)
+	{
+		std::size_t i = detail::skinning_dispatch().linear(count, reinterpret_cast<float const*>(palette),
+			reinterpret_cast<unsigned short const*>(joints), reinterpret_cast<float const*>(weights),
+			reinterpret_cast<float const*>(positions), reinterpret_cast<float const*>(normals),
+			reinterpret_cast<float*>(outPositions), reinterpret_cast<float*>(outNormals));
+		for(; i < count; ++i)
+		{
+			mat3x4 Blend = palette[joints[i].x] * weights[i].x;
+			for(length_t k = 1; k < 4; ++k)
+				if(weights[i][k] != 0.0f)
+					Blend += palette[joints[i][k]] * weights[i][k];
+			outPositions[i] = vec4(positions[i], 1.0f) * Blend;
+			outNormals[i] = normalize(vec4(normals[i], 0.0f) * Blend);
+		}
+	}
+}//namespace glm
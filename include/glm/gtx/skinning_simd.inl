@@ -0,0 +1,204 @@
+/// @ref gtx_skinning
+/// Included once per kernel tier, inside that tier's namespace, after the GLM_GTX_quaternion_array kernels
+
+	// Scalar fallback, the caller skins every vertex with the core functions. Each function handles a prefix of the
+	// vertices and returns its length
+	template<length_t L, bool Simd = float_packet<L>::simd>
+	struct compute_skinning
+	{
+		GLM_FUNC_QUALIFIER static std::size_t dual_quat(std::size_t, float const*, unsigned short const*, float const*, float const*, float const*, float*, float*) { return 0; }
+		GLM_FUNC_QUALIFIER static std::size_t linear(std::size_t, float const*, unsigned short const*, float const*, float const*, float const*, float*, float*) { return 0; }
+	};
+
+#	if GLM_CONFIG_SIMD == GLM_ENABLE
+	template<length_t L>
+	struct compute_skinning<L, true>
+	{
+		typedef float_packet<L> P;
+		typedef typename P::type V;
+		typedef float_packet<4> P4;
+		typedef compute_geometric_array<L> geometric;
+		typedef compute_quaternion_array<L> quaternion;
+		typedef typename geometric::template aos<3, geometric::vec3_stride> vec3_aos;
+		typedef typename geometric::template aos<4, 4> vec4_aos;
+
+		// Joint indices between two vertices, 4 unless u16vec4 is padded
+		static std::size_t const joints_stride = sizeof(u16vec4) / sizeof(unsigned short);
+
+		// Influence k of the vertices i to i + L - 1, as offsets in floats of their palette entries
+		template<std::size_t Stride>
+		GLM_FUNC_QUALIFIER static void load_joints(unsigned short const* joints, std::size_t i, length_t k, std::size_t* Joint)
+		{
+			joints += i * joints_stride + static_cast<std::size_t>(k);
+			for(length_t l = 0; l < L; ++l)
+				Joint[l] = joints[l * joints_stride] * Stride;
+		}
+
+		// The 4 floats Offset floats after p + Entry[l] for every lane l, one component per register
+		GLM_FUNC_QUALIFIER static void gather(float const* p, std::size_t const* Entry, std::size_t Offset, V* v)
+		{
+			p += Offset;
+			for(length_t l = 0; l < 4; ++l)
+				v[l] = P::load(p + Entry[l], p + Entry[(l + 4) % L]);
+			quaternion::transpose(v);
+		}
+
+		// A gathered quaternion to x, y, z, w registers whatever the storage order of quat
+		GLM_FUNC_QUALIFIER static void gather_quat(float const* palette, std::size_t const* Joint, std::size_t Offset, V* v)
+		{
+			gather(palette, Joint, Offset, v);
+#			ifdef GLM_FORCE_QUAT_DATA_WXYZ
+			V const w = v[0];
+			v[0] = v[1];
+			v[1] = v[2];
+			v[2] = v[3];
+			v[3] = w;
+#			endif
+		}
+
+		GLM_FUNC_QUALIFIER static bool all_zero(V w)
+		{
+			return P::movemask(P::cmp_lt(P::set1(0.0f), P::abs(w))) == 0;
+		}
+
+		GLM_FUNC_QUALIFIER static void cross(V const* a, V const* b, V* out)
+		{
+			out[0] = P::sub(P::mul(a[1], b[2]), P::mul(a[2], b[1]));
+			out[1] = P::sub(P::mul(a[2], b[0]), P::mul(a[0], b[2]));
+			out[2] = P::sub(P::mul(a[0], b[1]), P::mul(a[1], b[0]));
+		}
+
+		// rsqrt and one Newton step, as normalizeArray
+		GLM_FUNC_QUALIFIER static V inverse_sqrt(V d)
+		{
+			V const y = P::rsqrt(d);
+			return P::mul(y, P::sub(P::set1(1.5f), P::mul(P::mul(P::mul(d, P::set1(0.5f)), y), y)));
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t dual_quat(std::size_t count, float const* palette, unsigned short const* joints, float const* weights,
+			float const* positions, float const* normals, float* outPositions, float* outNormals)
+		{
+			V const Two = P::set1(2.0f);
+			V const SignBit = P::set1(-0.0f);
+			std::size_t i = 0;
+			for(; i + L <= count; i += L)
+			{
+				std::size_t Joint[L];
+				V w[4], Real[4], Dual[4];
+				vec4_aos::load(weights, i, w);
+
+				load_joints<8>(joints, i, 0, Joint);
+				gather_quat(palette, Joint, 0, Real);
+				gather_quat(palette, Joint, 4, Dual);
+				for(length_t c = 0; c < 4; ++c)
+				{
+					Real[c] = P::mul(Real[c], w[0]);
+					Dual[c] = P::mul(Dual[c], w[0]);
+				}
+
+				for(length_t k = 1; k < 4; ++k)
+				{
+					if(all_zero(w[k]))
+						continue;
+					V r[4], d[4];
+					load_joints<8>(joints, i, k, Joint);
+					gather_quat(palette, Joint, 0, r);
+					gather_quat(palette, Joint, 4, d);
+					// Joints on the other hemisphere from the blend so far take the other sign, for the shortest path
+					V const Weight = P::xor_(w[k], P::and_(P::cmp_lt(quaternion::dot_lanes(r, Real), P::set1(0.0f)), SignBit));
+					for(length_t c = 0; c < 4; ++c)
+					{
+						Real[c] = P::add(Real[c], P::mul(r[c], Weight));
+						Dual[c] = P::add(Dual[c], P::mul(d[c], Weight));
+					}
+				}
+
+				V const Scale = inverse_sqrt(quaternion::dot_lanes(Real, Real));
+				for(length_t c = 0; c < 4; ++c)
+				{
+					Real[c] = P::mul(Real[c], Scale);
+					Dual[c] = P::mul(Dual[c], Scale);
+				}
+
+				// (cross(r, cross(r, v) + v * r.w + d) + d * r.w - r * d.w) * 2 + v, as dualquat * vec3
+				V v[4], t[3], u[3];
+				vec3_aos::load(positions, i, v);
+				cross(Real, v, t);
+				for(length_t c = 0; c < 3; ++c)
+					t[c] = P::add(P::add(t[c], P::mul(v[c], Real[3])), Dual[c]);
+				cross(Real, t, u);
+				for(length_t c = 0; c < 3; ++c)
+					v[c] = P::add(v[c], P::mul(P::sub(P::add(u[c], P::mul(Dual[c], Real[3])), P::mul(Real[c], Dual[3])), Two));
+				vec3_aos::store(outPositions, i, v);
+
+				// The normal only turns, as quat * vec3
+				vec3_aos::load(normals, i, v);
+				cross(Real, v, t);
+				for(length_t c = 0; c < 3; ++c)
+					t[c] = P::add(t[c], P::mul(v[c], Real[3]));
+				cross(Real, t, u);
+				for(length_t c = 0; c < 3; ++c)
+					v[c] = P::add(v[c], P::mul(u[c], Two));
+				vec3_aos::store(outNormals, i, v);
+			}
+			return i;
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t linear(std::size_t count, float const* palette, unsigned short const* joints, float const* weights,
+			float const* positions, float const* normals, float* outPositions, float* outNormals)
+		{
+			std::size_t const Entry[8] = {0, 12, 24, 36, 48, 60, 72, 84};
+			std::size_t i = 0;
+			for(; i + L <= count; i += L)
+			{
+				V w[4];
+				vec4_aos::load(weights, i, w);
+				length_t Influences = 4;
+				while(Influences > 1 && all_zero(w[Influences - 1]))
+					--Influences;
+
+				// Each row of a mat3x4 fills a 4 float register as it is, so the blend runs per vertex and only the
+				// blended matrices are transposed
+				float Blend[L * 12];
+				for(length_t l = 0; l < L; ++l)
+				{
+					unsigned short const* Joint = joints + (i + l) * joints_stride;
+					float const* Weight = weights + (i + l) * 4;
+					typename P4::type Row[3];
+					typename P4::type const w0 = P4::set1(Weight[0]);
+					for(length_t r = 0; r < 3; ++r)
+						Row[r] = P4::mul(P4::load(palette + Joint[0] * 12 + r * 4), w0);
+					for(length_t k = 1; k < Influences; ++k)
+					{
+						typename P4::type const wk = P4::set1(Weight[k]);
+						for(length_t r = 0; r < 3; ++r)
+							Row[r] = P4::add(Row[r], P4::mul(P4::load(palette + Joint[k] * 12 + r * 4), wk));
+					}
+					for(length_t r = 0; r < 3; ++r)
+						P4::store(Blend + l * 12 + r * 4, Row[r]);
+				}
+
+				// m[Row * 4 + c] holds column c of the row, the translation in column 3, as the mat3x4 columns
+				V m[12];
+				for(length_t Row = 0; Row < 3; ++Row)
+					gather(Blend, Entry, static_cast<std::size_t>(Row) * 4, m + Row * 4);
+
+				V v[4], Out[4];
+				vec3_aos::load(positions, i, v);
+				for(length_t Row = 0; Row < 3; ++Row)
+					Out[Row] = P::add(P::add(P::mul(m[Row * 4 + 0], v[0]), P::mul(m[Row * 4 + 1], v[1])), P::add(P::mul(m[Row * 4 + 2], v[2]), m[Row * 4 + 3]));
+				vec3_aos::store(outPositions, i, Out);
+
+				// Scale and shear in the blend change the length of the normal
+				vec3_aos::load(normals, i, v);
+				for(length_t Row = 0; Row < 3; ++Row)
+					Out[Row] = P::add(P::add(P::mul(m[Row * 4 + 0], v[0]), P::mul(m[Row * 4 + 1], v[1])), P::mul(m[Row * 4 + 2], v[2]));
+				V const Scale = inverse_sqrt(P::add(P::add(P::mul(Out[0], Out[0]), P::mul(Out[1], Out[1])), P::mul(Out[2], Out[2])));
+				for(length_t c = 0; c < 3; ++c)
+					Out[c] = P::mul(Out[c], Scale);
+				vec3_aos::store(outNormals, i, Out);
+			}
+			return i;
+		}
+	};
+#	endif//GLM_CONFIG_SIMD == GLM_ENABLE
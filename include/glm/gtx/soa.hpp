@@ -0,0 +1,334 @@
+/// @ref gtx_soa
+/// @file glm/gtx/soa.hpp
+///
+/// @see core (dependence)
+/// @see gtx_geometric_array (dependence)
+/// @see gtx_quaternion_array (dependence)
+/// @see gtx_transform_array (dependence)
+///
+/// @defgroup gtx_soa GLM_GTX_soa
+/// @ingroup gtx
+///
+/// Include <glm/gtx/soa.hpp> to use the features of this extension.
+///
+/// Containers of vec3, vec4 or quat stored in structure of arrays form: one array of floats per component, each
+/// starting on a 64 byte boundary and padded to a multiple of 16 floats, so SIMD code loads whole registers without
+/// gathers or shuffles. Elements are read and written as whole vectors through get and set, through operator[] and
+/// iterators that return a proxy converting to and from the vector type, or in bulk from and to arrays of vectors.
+/// dot, cross, normalize, transform, slerp, nlerp, mul and rotate run over whole containers with the
+/// GLM_GTX_geometric_array, GLM_GTX_transform_array and GLM_GTX_quaternion_array kernels.
+/// Unlike vec3_packet of GLM_GTX_intersect_packet, which holds one SIMD register worth of vectors on the stack, these
+/// hold any number of vectors on the heap.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/quaternion.hpp"
+#include "../gtx/geometric_array.hpp"
+#include "../gtx/quaternion_array.hpp"
+#include "../gtx/transform_array.hpp"
+#include <cstddef>
+#include <iterator>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_soa is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	else
+#		pragma message("GLM: GLM_GTX_soa extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	template<typename genType>
+	class soa;
+
+namespace detail
+{
+	// Number of streams of a type and how a vector is spread over them: x, y, z, then w for vec4 and quat
+	template<typename genType>
+	struct soa_traits
+	{};
+
+	template<qualifier Q>
+	struct soa_traits<vec<3, float, Q> >
+	{
+		static length_t const components = 3;
+
+		GLM_FUNC_QUALIFIER static vec<3, float, Q> get(float* const* s, std::size_t i)
+		{
+			return vec<3, float, Q>(s[0][i], s[1][i], s[2][i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void set(float* const* s, std::size_t i, vec<3, float, Q> const& v)
+		{
+			s[0][i] = v.x;
+			s[1][i] = v.y;
+			s[2][i] = v.z;
+		}
+	};
+
+	template<qualifier Q>
+	struct soa_traits<vec<4, float, Q> >
+	{
+		static length_t const components = 4;
+
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> get(float* const* s, std::size_t i)
+		{
+			return vec<4, float, Q>(s[0][i], s[1][i], s[2][i], s[3][i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void set(float* const* s, std::size_t i, vec<4, float, Q> const& v)
+		{
+			s[0][i] = v.x;
+			s[1][i] = v.y;
+			s[2][i] = v.z;
+			s[3][i] = v.w;
+		}
+	};
+
+	template<qualifier Q>
+	struct soa_traits<qua<float, Q> >
+	{
+		static length_t const components = 4;
+
+		GLM_FUNC_QUALIFIER static qua<float, Q> get(float* const* s, std::size_t i)
+		{
+			return qua<float, Q>(s[3][i], s[0][i], s[1][i], s[2][i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void set(float* const* s, std::size_t i, qua<float, Q> const& q)
+		{
+			s[0][i] = q.x;
+			s[1][i] = q.y;
+			s[2][i] = q.z;
+			s[3][i] = q.w;
+		}
+	};
+
+	// What operator[] and iterators of a non const soa return: converts to genType, and assigning a genType writes
+	// every stream
+	template<typename genType>
+	class soa_reference
+	{
+	public:
+		GLM_FUNC_DECL soa_reference(soa<genType>& Container, std::size_t Index);
+
+		GLM_FUNC_DECL operator genType() const;
+		GLM_FUNC_DECL soa_reference& operator=(genType const& v);
+		GLM_FUNC_DECL soa_reference& operator=(soa_reference const& r);
+		GLM_FUNC_DECL soa_reference& operator+=(genType const& v);
+		GLM_FUNC_DECL soa_reference& operator-=(genType const& v);
+		GLM_FUNC_DECL soa_reference& operator*=(float s);
+
+	private:
+		soa<genType>* Container;
+		std::size_t Index;
+	};
+
+	template<typename genType, bool Const>
+	struct soa_iterator_types
+	{
+		typedef soa_reference<genType> reference;
+		typedef soa<genType> container_type;
+	};
+
+	template<typename genType>
+	struct soa_iterator_types<genType, true>
+	{
+		typedef genType reference;
+		typedef soa<genType> const container_type;
+	};
+
+	// Random access iterator over a soa, dereferencing to a soa_reference, or to a genType value when Const
+	template<typename genType, bool Const>
+	class soa_iterator
+	{
+		template<typename otherType, bool OtherConst>
+		friend class soa_iterator;
+
+	public:
+		typedef std::random_access_iterator_tag iterator_category;
+		typedef genType value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef void pointer;
+		typedef typename soa_iterator_types<genType, Const>::reference reference;
+		typedef typename soa_iterator_types<genType, Const>::container_type container_type;
+
+		GLM_FUNC_DECL soa_iterator();
+		GLM_FUNC_DECL soa_iterator(container_type* Container, std::size_t Index);
+		// Copy, and conversion of an iterator to a const_iterator
+		GLM_FUNC_DECL soa_iterator(soa_iterator<genType, false> const& i);
+
+		GLM_FUNC_DECL reference operator*() const;
+		GLM_FUNC_DECL reference operator[](difference_type n) const;
+
+		GLM_FUNC_DECL soa_iterator& operator++();
+		GLM_FUNC_DECL soa_iterator operator++(int);
+		GLM_FUNC_DECL soa_iterator& operator--();
+		GLM_FUNC_DECL soa_iterator operator--(int);
+		GLM_FUNC_DECL soa_iterator& operator+=(difference_type n);
+		GLM_FUNC_DECL soa_iterator& operator-=(difference_type n);
+		GLM_FUNC_DECL soa_iterator operator+(difference_type n) const;
+		GLM_FUNC_DECL soa_iterator operator-(difference_type n) const;
+		GLM_FUNC_DECL difference_type operator-(soa_iterator const& i) const;
+
+		GLM_FUNC_DECL bool operator==(soa_iterator const& i) const;
+		GLM_FUNC_DECL bool operator!=(soa_iterator const& i) const;
+		GLM_FUNC_DECL bool operator<(soa_iterator const& i) const;
+		GLM_FUNC_DECL bool operator>(soa_iterator const& i) const;
+		GLM_FUNC_DECL bool operator<=(soa_iterator const& i) const;
+		GLM_FUNC_DECL bool operator>=(soa_iterator const& i) const;
+
+	private:
+		container_type* Container;
+		std::size_t Index;
+	};
+}//namespace detail
+
+	/// @addtogroup gtx_soa
+	/// @{
+
+	/// Vectors of type genType (vec3, vec4 or quat, any float qualifier) in structure of arrays form.
+	/// stream(c) is the array of component c: x, y, z and w, also for quat whatever GLM_FORCE_QUAT_DATA_WXYZ says.
+	/// Lanes between size() and capacity() hold unspecified values; a stream may be read or written up to the next
+	/// multiple of 16 floats past size(), which is always within capacity().
+	/// Proxies do not take part in template argument deduction: write length(vec3(v[i])) or length(v.get(i)), not
+	/// length(v[i]).
+	/// From GLM_GTX_soa extension.
+	template<typename genType>
+	class soa
+	{
+	public:
+		typedef genType value_type;
+		typedef std::size_t size_type;
+		typedef detail::soa_reference<genType> reference;
+		typedef genType const_reference;
+		typedef detail::soa_iterator<genType, false> iterator;
+		typedef detail::soa_iterator<genType, true> const_iterator;
+
+		/// Number of streams, 3 for vec3 and 4 for vec4 and quat
+		static length_t const components = detail::soa_traits<genType>::components;
+
+		/// Streams are allocated by multiples of this many floats, 64 bytes
+		static size_type const stream_align = 16;
+
+		GLM_FUNC_DECL soa();
+		/// count zero filled elements
+		GLM_FUNC_DECL explicit soa(size_type count);
+		/// The count vectors of in, an array of structures
+		GLM_FUNC_DECL soa(genType const* in, size_type count);
+		GLM_FUNC_DECL soa(soa const& s);
+		GLM_FUNC_DECL ~soa();
+		GLM_FUNC_DECL soa& operator=(soa const& s);
+		GLM_FUNC_DECL void swap(soa& s);
+
+		GLM_FUNC_DECL size_type size() const;
+		GLM_FUNC_DECL size_type capacity() const;
+		GLM_FUNC_DECL bool empty() const;
+		GLM_FUNC_DECL void reserve(size_type count);
+		/// New elements are zero filled
+		GLM_FUNC_DECL void resize(size_type count);
+		GLM_FUNC_DECL void clear();
+		GLM_FUNC_DECL void push_back(genType const& v);
+
+		GLM_FUNC_DECL float* stream(length_t c);
+		GLM_FUNC_DECL float const* stream(length_t c) const;
+		GLM_FUNC_DECL float* x();
+		GLM_FUNC_DECL float const* x() const;
+		GLM_FUNC_DECL float* y();
+		GLM_FUNC_DECL float const* y() const;
+		GLM_FUNC_DECL float* z();
+		GLM_FUNC_DECL float const* z() const;
+		/// vec4 and quat only
+		GLM_FUNC_DECL float* w();
+		GLM_FUNC_DECL float const* w() const;
+
+		GLM_FUNC_DECL genType get(size_type i) const;
+		GLM_FUNC_DECL void set(size_type i, genType const& v);
+		GLM_FUNC_DECL reference operator[](size_type i);
+		GLM_FUNC_DECL const_reference operator[](size_type i) const;
+
+		GLM_FUNC_DECL iterator begin();
+		GLM_FUNC_DECL iterator end();
+		GLM_FUNC_DECL const_iterator begin() const;
+		GLM_FUNC_DECL const_iterator end() const;
+
+		/// Replaces the content with the count vectors of in, an array of structures
+		GLM_FUNC_DECL void assign(genType const* in, size_type count);
+		/// Writes the size() vectors to out, an array of structures
+		GLM_FUNC_DECL void copyTo(genType* out) const;
+
+	private:
+		GLM_FUNC_DECL void reallocate(size_type count);
+
+		void* Buffer;
+		float* Streams[4];
+		size_type Size;
+		size_type Capacity;
+	};
+
+	typedef soa<vec3> soa_vec3;
+	typedef soa<vec4> soa_vec4;
+	typedef soa<quat> soa_quat;
+
+	/// out[i] = dot(a[i], b[i]), a and b have the same size.
+	/// From GLM_GTX_soa extension.
+	GLM_FUNC_DECL void dot(soa_vec3 const& a, soa_vec3 const& b, float* out);
+
+	/// out[i] = dot(a[i], b[i]), a and b have the same size.
+	/// From GLM_GTX_soa extension.
+	GLM_FUNC_DECL void dot(soa_vec4 const& a, soa_vec4 const& b, float* out);
+
+	/// out[i] = cross(a[i], b[i]), out is resized to the size of a and may be a or b.
+	/// From GLM_GTX_soa extension.
+	GLM_FUNC_DECL void cross(soa_vec3 const& a, soa_vec3 const& b, soa_vec3& out);
+
+	/// out[i] = normalize(in[i]) with rsqrt and a Newton step, see GLM_GTX_geometric_array. out is resized to the size
+	/// of in and may be in.
+	/// From GLM_GTX_soa extension.
+	GLM_FUNC_DECL void normalize(soa_vec3 const& in, soa_vec3& out);
+
+	/// out[i] = normalize(in[i]), see normalize(soa_vec3 const&, soa_vec3&).
+	/// From GLM_GTX_soa extension.
+	GLM_FUNC_DECL void normalize(soa_vec4 const& in, soa_vec4& out);
+
+	/// out[i] = normalize(in[i]), see normalize(soa_vec3 const&, soa_vec3&). A zero quaternion gives NaN where the
+	/// quat normalize returns the identity.
+	/// From GLM_GTX_soa extension.
+	GLM_FUNC_DECL void normalize(soa_quat const& in, soa_quat& out);
+
+	/// out[i] = vec3(m * vec4(in[i], 1)) for points, the bottom row of m is taken to be (0, 0, 0, 1), see
+	/// transformAffineSoA. out is resized to the size of in and may be in.
+	/// From GLM_GTX_soa extension.
+	GLM_FUNC_DECL void transform(mat4 const& m, soa_vec3 const& in, soa_vec3& out);
+
+	/// out[i] = slerp(a[i], b[i], t), see slerpArray. a and b have the same size, out is resized to it and may be a or b.
+	/// From GLM_GTX_soa extension.
+	GLM_FUNC_DECL void slerp(soa_quat const& a, soa_quat const& b, float t, soa_quat& out);
+
+	/// out[i] = slerp(a[i], b[i], t[i]), see slerp(soa_quat const&, soa_quat const&, float, soa_quat&).
+	/// From GLM_GTX_soa extension.
+	GLM_FUNC_DECL void slerp(soa_quat const& a, soa_quat const& b, float const* t, soa_quat& out);
+
+	/// Shortest path normalized lerp, see nlerpArray. a and b have the same size, out is resized to it and may be a or b.
+	/// From GLM_GTX_soa extension.
+	GLM_FUNC_DECL void nlerp(soa_quat const& a, soa_quat const& b, float t, soa_quat& out);
+
+	/// nlerp with one interpolation factor per quaternion.
+	/// From GLM_GTX_soa extension.
+	GLM_FUNC_DECL void nlerp(soa_quat const& a, soa_quat const& b, float const* t, soa_quat& out);
+
+	/// out[i] = a[i] * b[i]. a and b have the same size, out is resized to it and may be a or b.
+	/// From GLM_GTX_soa extension.
+	GLM_FUNC_DECL void mul(soa_quat const& a, soa_quat const& b, soa_quat& out);
+
+	/// out[i] = q[i] * v[i]. q and v have the same size, out is resized to it and may be v.
+	/// From GLM_GTX_soa extension.
+	GLM_FUNC_DECL void rotate(soa_quat const& q, soa_vec3 const& v, soa_vec3& out);
+
+	/// @}
+}//namespace glm
+
+#include "soa.inl"
@@ -0,0 +1,576 @@
+/// @ref gtx_soa
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace glm{
+namespace detail
+{
+	// soa_reference
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER soa_reference<genType>::soa_reference(soa<genType>& c, std::size_t i)
+		: Container(&c)
+		, Index(i)
+	{}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER soa_reference<genType>::operator genType() const
+	{
+		return Container->get(Index);
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER soa_reference<genType>& soa_reference<genType>::operator=(genType const& v)
+	{
+		Container->set(Index, v);
+		return *this;
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER soa_reference<genType>& soa_reference<genType>::operator=(soa_reference const& r)
+	{
+		return *this = static_cast<genType>(r);
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER soa_reference<genType>& soa_reference<genType>::operator+=(genType const& v)
+	{
+		return *this = Container->get(Index) + v;
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER soa_reference<genType>& soa_reference<genType>::operator-=(genType const& v)
+	{
+		return *this = Container->get(Index) - v;
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER soa_reference<genType>& soa_reference<genType>::operator*=(float s)
+	{
+		return *this = Container->get(Index) * s;
+	}
+
+	// soa_iterator
+
+	template<typename genType, bool Const>
+	GLM_FUNC_QUALIFIER soa_iterator<genType, Const>::soa_iterator()
+		: Container(GLM_NULLPTR)
+		, Index(0)
+	{}
+
+	template<typename genType, bool Const>
+	GLM_FUNC_QUALIFIER soa_iterator<genType, Const>::soa_iterator(container_type* c, std::size_t i)
+		: Container(c)
+		, Index(i)
+	{}
+
+	template<typename genType, bool Const>
+	GLM_FUNC_QUALIFIER soa_iterator<genType, Const>::soa_iterator(soa_iterator<genType, false> const& i)
+		: Container(i.Container)
+		, Index(i.Index)
+	{}
+
+	template<typename genType, bool Const>
+	GLM_FUNC_QUALIFIER typename soa_iterator<genType, Const>::reference soa_iterator<genType, Const>::operator*() const
+	{
+		return (*Container)[Index];
+	}
+
+	template<typename genType, bool Const>
+	GLM_FUNC_QUALIFIER typename soa_iterator<genType, Const>::reference soa_iterator<genType, Const>::operator[](difference_type n) const
+	{
+		return (*Container)[Index + n];
+	}
+
+	template<typename genType, bool Const>
+	GLM_FUNC_QUALIFIER soa_iterator<genType, Const>& soa_iterator<genType, Const>::operator++()
+	{
+		++Index;
+		return *this;
+	}
+
+	template<typename genType, bool Const>
+	GLM_FUNC_QUALIFIER soa_iterator<genType, Const> soa_iterator<genType, Const>::operator++(int)
+	{
+		soa_iterator Result(*this);
+		++Index;
+		return Result;
+	}
+
+	template<typename genType, bool Const>
+	GLM_FUNC_QUALIFIER soa_iterator<genType, Const>& soa_iterator<genType, Const>::operator--()
+	{
+		--Index;
+		return *this;
+	}
+
+	template<typename genType, bool Const>
+	GLM_FUNC_QUALIFIER soa_iterator<genType, Const> soa_iterator<genType, Const>::operator--(int)
+	{
+		soa_iterator Result(*this);
+		--Index;
+		return Result;
+	}
+
+	template<typename genType, bool Const>
+	GLM_FUNC_QUALIFIER soa_iterator<genType, Const>& soa_iterator<genType, Const>::operator+=(difference_type n)
+	{
+		Index += n;
+		return *this;
+	}
+
+	template<typename genType, bool Const>
+	GLM_FUNC_QUALIFIER soa_iterator<genType, Const>& soa_iterator<genType, Const>::operator-=(difference_type n)
+	{
+		Index -= n;
+		return *this;
+	}
+
+	template<typename genType, bool Const>
+	GLM_FUNC_QUALIFIER soa_iterator<genType, Const> soa_iterator<genType, Const>::operator+(difference_type n) const
+	{
+		return soa_iterator(Container, Index + n);
+	}
+
+	template<typename genType, bool Const>
+	GLM_FUNC_QUALIFIER soa_iterator<genType, Const> soa_iterator<genType, Const>::operator-(difference_type n) const
+	{
+		return soa_iterator(Container, Index - n);
+	}
+
+	template<typename genType, bool Const>
+	GLM_FUNC_QUALIFIER typename soa_iterator<genType, Const>::difference_type soa_iterator<genType, Const>::operator-(soa_iterator const& i) const
+	{
+		return static_cast<difference_type>(Index) - static_cast<difference_type>(i.Index);
+	}
+
+	template<typename genType, bool Const>
+	GLM_FUNC_QUALIFIER bool soa_iterator<genType, Const>::operator==(soa_iterator const& i) const
+	{
+		return Index == i.Index;
+	}
+
+	template<typename genType, bool Const>
+	GLM_FUNC_QUALIFIER bool soa_iterator<genType, Const>::operator!=(soa_iterator const& i) const
+	{
+		return Index != i.Index;
+	}
+
+	template<typename genType, bool Const>
+	GLM_FUNC_QUALIFIER bool soa_iterator<genType, Const>::operator<(soa_iterator const& i) const
+	{
+		return Index < i.Index;
+	}
+
+	template<typename genType, bool Const>
+	GLM_FUNC_QUALIFIER bool soa_iterator<genType, Const>::operator>(soa_iterator const& i) const
+	{
+		return Index > i.Index;
+	}
+
+	template<typename genType, bool Const>
+	GLM_FUNC_QUALIFIER bool soa_iterator<genType, Const>::operator<=(soa_iterator const& i) const
+	{
+		return Index <= i.Index;
+	}
+
+	template<typename genType, bool Const>
+	GLM_FUNC_QUALIFIER bool soa_iterator<genType, Const>::operator>=(soa_iterator const& i) const
+	{
+		return Index >= i.Index;
+	}
+}//namespace detail
+
+	// soa
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER soa<genType>::soa()
+		: Buffer(GLM_NULLPTR)
+		, Size(0)
+		, Capacity(0)
+	{
+		for(length_t c = 0; c < 4; ++c)
+			Streams[c] = GLM_NULLPTR;
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER soa<genType>::soa(size_type count)
+		: Buffer(GLM_NULLPTR)
+		, Size(0)
+		, Capacity(0)
+	{
+		for(length_t c = 0; c < 4; ++c)
+			Streams[c] = GLM_NULLPTR;
+		resize(count);
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER soa<genType>::soa(genType const* in, size_type count)
+		: Buffer(GLM_NULLPTR)
+		, Size(0)
+		, Capacity(0)
+	{
+		for(length_t c = 0; c < 4; ++c)
+			Streams[c] = GLM_NULLPTR;
+		assign(in, count);
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER soa<genType>::soa(soa const& s)
+		: Buffer(GLM_NULLPTR)
+		, Size(0)
+		, Capacity(0)
+	{
+		for(length_t c = 0; c < 4; ++c)
+			Streams[c] = GLM_NULLPTR;
+		*this = s;
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER soa<genType>::~soa()
+	{
+		::operator delete(Buffer);
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER soa<genType>& soa<genType>::operator=(soa const& s)
+	{
+		if(this == &s)
+			return *this;
+		if(Capacity < s.Size)
+			reallocate(s.Size);
+		Size = s.Size;
+		for(length_t c = 0; c < components; ++c)
+			std::memcpy(Streams[c], s.Streams[c], Size * sizeof(float));
+		return *this;
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER void soa<genType>::swap(soa& s)
+	{
+		std::swap(Buffer, s.Buffer);
+		for(length_t c = 0; c < 4; ++c)
+			std::swap(Streams[c], s.Streams[c]);
+		std::swap(Size, s.Size);
+		std::swap(Capacity, s.Capacity);
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER typename soa<genType>::size_type soa<genType>::size() const
+	{
+		return Size;
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER typename soa<genType>::size_type soa<genType>::capacity() const
+	{
+		return Capacity;
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER bool soa<genType>::empty() const
+	{
+		return Size == 0;
+	}
+
+	// One allocation holds every stream, Capacity floats apart from the first 64 byte boundary of the buffer
+	template<typename genType>
+	GLM_FUNC_QUALIFIER void soa<genType>::reallocate(size_type count)
+	{
+		size_type const NewCapacity = (count + stream_align - 1) / stream_align * stream_align;
+		void* const NewBuffer = ::operator new(NewCapacity * components * sizeof(float) + stream_align * sizeof(float));
+		float* const First = reinterpret_cast<float*>((reinterpret_cast<std::size_t>(NewBuffer) + stream_align * sizeof(float) - 1) & ~(stream_align * sizeof(float) - 1));
+		for(length_t c = 0; c < components; ++c)
+		{
+			float* const Stream = First + NewCapacity * static_cast<size_type>(c);
+			if(Size > 0)
+				std::memcpy(Stream, Streams[c], Size * sizeof(float));
+			Streams[c] = Stream;
+		}
+		::operator delete(Buffer);
+		Buffer = NewBuffer;
+		Capacity = NewCapacity;
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER void soa<genType>::reserve(size_type count)
+	{
+		if(count > Capacity)
+			reallocate(count);
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER void soa<genType>::resize(size_type count)
+	{
+		reserve(count);
+		if(count > Size)
+			for(length_t c = 0; c < components; ++c)
+				std::memset(Streams[c] + Size, 0, (count - Size) * sizeof(float));
+		Size = count;
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER void soa<genType>::clear()
+	{
+		Size = 0;
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER void soa<genType>::push_back(genType const& v)
+	{
+		if(Size == Capacity)
+			reallocate(Capacity * 2 > stream_align ? Capacity * 2 : stream_align);
+		detail::soa_traits<genType>::set(Streams, Size, v);
+		++Size;
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER float* soa<genType>::stream(length_t c)
+	{
+		assert(c >= 0 && c < components);
+		return Streams[c];
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER float const* soa<genType>::stream(length_t c) const
+	{
+		assert(c >= 0 && c < components);
+		return Streams[c];
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER float* soa<genType>::x()
+	{
+		return stream(0);
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER float const* soa<genType>::x() const
+	{
+		return stream(0);
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER float* soa<genType>::y()
+	{
+		return stream(1);
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER float const* soa<genType>::y() const
+	{
+		return stream(1);
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER float* soa<genType>::z()
+	{
+		return stream(2);
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER float const* soa<genType>::z() const
+	{
+		return stream(2);
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER float* soa<genType>::w()
+	{
+		return stream(3);
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER float const* soa<genType>::w() const
+	{
+		return stream(3);
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER genType soa<genType>::get(size_type i) const
+	{
+		assert(i < Size);
+		return detail::soa_traits<genType>::get(Streams, i);
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER void soa<genType>::set(size_type i, genType const& v)
+	{
+		assert(i < Size);
+		detail::soa_traits<genType>::set(Streams, i, v);
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER typename soa<genType>::reference soa<genType>::operator[](size_type i)
+	{
+		return reference(*this, i);
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER typename soa<genType>::const_reference soa<genType>::operator[](size_type i) const
+	{
+		return get(i);
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER typename soa<genType>::iterator soa<genType>::begin()
+	{
+		return iterator(this, 0);
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER typename soa<genType>::iterator soa<genType>::end()
+	{
+		return iterator(this, Size);
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER typename soa<genType>::const_iterator soa<genType>::begin() const
+	{
+		return const_iterator(this, 0);
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER typename soa<genType>::const_iterator soa<genType>::end() const
+	{
+		return const_iterator(this, Size);
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER void soa<genType>::assign(genType const* in, size_type count)
+	{
+		if(Capacity < count)
+		{
+			Size = 0;
+			reallocate(count);
+		}
+		Size = count;
+		for(size_type i = 0; i < count; ++i)
+			detail::soa_traits<genType>::set(Streams, i, in[i]);
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER void soa<genType>::copyTo(genType* out) const
+	{
+		for(size_type i = 0; i < Size; ++i)
+			out[i] = detail::soa_traits<genType>::get(Streams, i);
+	}
+
+	// Bulk functions
+
+	GLM_FUNC_QUALIFIER void dot(soa_vec3 const& a, soa_vec3 const& b, float* out)
+	{
+		assert(a.size() == b.size());
+		dotSoA(a.size(), a.x(), a.y(), a.z(), b.x(), b.y(), b.z(), out);
+	}
+
+	GLM_FUNC_QUALIFIER void dot(soa_vec4 const& a, soa_vec4 const& b, float* out)
+	{
+		assert(a.size() == b.size());
+		dotSoA(a.size(), a.x(), a.y(), a.z(), a.w(), b.x(), b.y(), b.z(), b.w(), out);
+	}
+
+	GLM_FUNC_QUALIFIER void cross(soa_vec3 const& a, soa_vec3 const& b, soa_vec3& out)
+	{
+		assert(a.size() == b.size());
+		out.resize(a.size());
+		crossSoA(a.size(), a.x(), a.y(), a.z(), b.x(), b.y(), b.z(), out.x(), out.y(), out.z());
+	}
+
+	GLM_FUNC_QUALIFIER void normalize(soa_vec3 const& in, soa_vec3& out)
+	{
+		out.resize(in.size());
+		normalizeSoA(in.size(), in.x(), in.y(), in.z(), out.x(), out.y(), out.z());
+	}
+
+	GLM_FUNC_QUALIFIER void normalize(soa_vec4 const& in, soa_vec4& out)
+	{
+		out.resize(in.size());
+		normalizeSoA(in.size(), in.x(), in.y(), in.z(), in.w(), out.x(), out.y(), out.z(), out.w());
+	}
+
+	GLM_FUNC_QUALIFIER void normalize(soa_quat const& in, soa_quat& out)
+	{
+		out.resize(in.size());
+		normalizeSoA(in.size(), in.x(), in.y(), in.z(), in.w(), out.x(), out.y(), out.z(), out.w());
+	}
+
+	GLM_FUNC_QUALIFIER void transform(mat4 const& m, soa_vec3 const& in, soa_vec3& out)
+	{
+		out.resize(in.size());
+		transformAffineSoA(m, in.size(), in.x(), in.y(), in.z(), out.x(), out.y(), out.z());
+	}
+
+namespace detail
+{
+	GLM_FUNC_QUALIFIER void slerp_soa(soa_quat const& a, soa_quat const& b, float const* t, std::size_t TStep, soa_quat& out)
+	{
+		assert(a.size() == b.size());
+		out.resize(a.size());
+		float const* const A[] = {a.x(), a.y(), a.z(), a.w()};
+		float const* const B[] = {b.x(), b.y(), b.z(), b.w()};
+		float* const Out[] = {out.x(), out.y(), out.z(), out.w()};
+		std::size_t i = quaternion_array_dispatch().soa_slerp(a.size(), A, B, t, TStep, Out);
+		for(; i < a.size(); ++i)
+			out.set(i, slerp(a.get(i), b.get(i), t[i * TStep]));
+	}
+
+	GLM_FUNC_QUALIFIER void nlerp_soa(soa_quat const& a, soa_quat const& b, float const* t, std::size_t TStep, soa_quat& out)
+	{
+		assert(a.size() == b.size());
+		out.resize(a.size());
+		float const* const A[] = {a.x(), a.y(), a.z(), a.w()};
+		float const* const B[] = {b.x(), b.y(), b.z(), b.w()};
+		float* const Out[] = {out.x(), out.y(), out.z(), out.w()};
+		std::size_t i = quaternion_array_dispatch().soa_nlerp(a.size(), A, B, t, TStep, Out);
+		for(; i < a.size(); ++i)
+			out.set(i, nlerp(a.get(i), b.get(i), t[i * TStep]));
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void slerp(soa_quat const& a, soa_quat const& b, float t, soa_quat& out)
+	{
+		detail::slerp_soa(a, b, &t, 0, out);
+	}
+
+	GLM_FUNC_QUALIFIER void slerp(soa_quat const& a, soa_quat const& b, float const* t, soa_quat& out)
+	{
+		detail::slerp_soa(a, b, t, 1, out);
+	}
+
+	GLM_FUNC_QUALIFIER void nlerp(soa_quat const& a, soa_quat const& b, float t, soa_quat& out)
+	{
+		detail::nlerp_soa(a, b, &t, 0, out);
+	}
+
+	GLM_FUNC_QUALIFIER void nlerp(soa_quat const& a, soa_quat const& b, float const* t, soa_quat& out)
+	{
+		detail::nlerp_soa(a, b, t, 1, out);
+	}
+
+	GLM_FUNC_QUALIFIER void mul(soa_quat const& a, soa_quat const& b, soa_quat& out)
+	{
+		assert(a.size() == b.size());
+		out.resize(a.size());
+		float const* const A[] = {a.x(), a.y(), a.z(), a.w()};
+		float const* const B[] = {b.x(), b.y(), b.z(), b.w()};
+		float* const Out[] = {out.x(), out.y(), out.z(), out.w()};
+		std::size_t i = detail::quaternion_array_dispatch().soa_mul(a.size(), A, B, Out);
+		for(; i < a.size(); ++i)
+			out.set(i, a.get(i) * b.get(i));
+	}
+
+	GLM_FUNC_QUALIFIER void rotate(soa_quat const& q, soa_vec3 const& v, soa_vec3& out)
+	{
+		assert(q.size() == v.size());
+		out.resize(v.size());
+		float const* const Q[] = {q.x(), q.y(), q.z(), q.w()};
+		float const* const In[] = {v.x(), v.y(), v.z()};
+		float* const Out[] = {out.x(), out.y(), out.z()};
+		std::size_t i = detail::quaternion_array_dispatch().soa_rotate(v.size(), Q, In, Out);
+		for(; i < v.size(); ++i)
+			out.set(i, q.get(i) * v.get(i));
+	}
+}//namespace glm
@@ -0,0 +1,86 @@
+/// @ref gtx_spline_array
+/// @file glm/gtx/spline_array.hpp
+///
+/// @see core (dependence)
+/// @see gtx_spline (dependence)
+/// @see gtx_geometric_array (dependence)
+/// @see gtx_easing_array
+///
+/// @defgroup gtx_spline_array GLM_GTX_spline_array
+/// @ingroup gtx
+///
+/// Include <glm/gtx/spline_array.hpp> to use the features of this extension.
+///
+/// catmullRom, hermite, cubic and the linear segment mix evaluated over whole arrays of vec3 or vec4, one curve
+/// segment and one parameter per element, as animation tracks sampled together. Like GLM_GTX_geometric_array, the
+/// SIMD paths transpose 4 vectors at a time to one component per register and handle 8 vectors per AVX register
+/// and 4 per SSE2 register; the last few, and every vector without SIMD, go through the GLM_GTX_spline functions.
+/// Results round like those, up to the order of the operations.
+/// With GLM_CONFIG_SIMD_DISPATCH a build for a narrower GLM_ARCH still runs the AVX2 kernels on CPUs that have AVX2,
+/// see GLM_GTX_simd_dispatch.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtx/spline.hpp"
+#include "../gtx/geometric_array.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_spline_array is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	else
+#		pragma message("GLM: GLM_GTX_spline_array extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_spline_array
+	/// @{
+
+	/// out[i] = catmullRom(v1[i], v2[i], v3[i], v4[i], s[i]). out may be any of the inputs.
+	/// From GLM_GTX_spline_array extension.
+	GLM_FUNC_DECL void catmullRomArray(vec3 const* v1, vec3 const* v2, vec3 const* v3, vec3 const* v4, float const* s, vec3* out, std::size_t count);
+
+	/// out[i] = catmullRom(v1[i], v2[i], v3[i], v4[i], s[i]). out may be any of the inputs.
+	/// From GLM_GTX_spline_array extension.
+	GLM_FUNC_DECL void catmullRomArray(vec4 const* v1, vec4 const* v2, vec4 const* v3, vec4 const* v4, float const* s, vec4* out, std::size_t count);
+
+	/// out[i] = hermite(v1[i], t1[i], v2[i], t2[i], s[i]). out may be any of the inputs.
+	/// From GLM_GTX_spline_array extension.
+	GLM_FUNC_DECL void hermiteArray(vec3 const* v1, vec3 const* t1, vec3 const* v2, vec3 const* t2, float const* s, vec3* out, std::size_t count);
+
+	/// out[i] = hermite(v1[i], t1[i], v2[i], t2[i], s[i]). out may be any of the inputs.
+	/// From GLM_GTX_spline_array extension.
+	GLM_FUNC_DECL void hermiteArray(vec4 const* v1, vec4 const* t1, vec4 const* v2, vec4 const* t2, float const* s, vec4* out, std::size_t count);
+
+	/// out[i] = cubic(v1[i], v2[i], v3[i], v4[i], s[i]). out may be any of the inputs.
+	/// From GLM_GTX_spline_array extension.
+	GLM_FUNC_DECL void cubicArray(vec3 const* v1, vec3 const* v2, vec3 const* v3, vec3 const* v4, float const* s, vec3* out, std::size_t count);
+
+	/// out[i] = cubic(v1[i], v2[i], v3[i], v4[i], s[i]). out may be any of the inputs.
+	/// From GLM_GTX_spline_array extension.
+	GLM_FUNC_DECL void cubicArray(vec4 const* v1, vec4 const* v2, vec4 const* v3, vec4 const* v4, float const* s, vec4* out, std::size_t count);
+
+	/// out[i] = mix(a[i], b[i], s). out may be a or b.
+	/// From GLM_GTX_spline_array extension.
+	GLM_FUNC_DECL void mixArray(vec3 const* a, vec3 const* b, float s, vec3* out, std::size_t count);
+
+	/// out[i] = mix(a[i], b[i], s[i]). out may be a or b.
+	/// From GLM_GTX_spline_array extension.
+	GLM_FUNC_DECL void mixArray(vec3 const* a, vec3 const* b, float const* s, vec3* out, std::size_t count);
+
+	/// out[i] = mix(a[i], b[i], s). out may be a or b.
+	/// From GLM_GTX_spline_array extension.
+	GLM_FUNC_DECL void mixArray(vec4 const* a, vec4 const* b, float s, vec4* out, std::size_t count);
+
+	/// out[i] = mix(a[i], b[i], s[i]). out may be a or b.
+	/// From GLM_GTX_spline_array extension.
+	GLM_FUNC_DECL void mixArray(vec4 const* a, vec4 const* b, float const* s, vec4* out, std::size_t count);
+
+	/// @}
+}//namespace glm
+
+#include "spline_array.inl"
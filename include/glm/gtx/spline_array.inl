@@ -0,0 +1,121 @@
+/// @ref gtx_spline_array
+
+namespace glm{
+namespace detail
+{
+#	include "spline_array_simd.inl"
+
+#	if GLM_SIMD_DISPATCH_AVX2
+	GLM_SIMD_TARGET_AVX2_BEGIN
+	namespace avx2
+	{
+#	include "spline_array_simd.inl"
+	}//namespace avx2
+	GLM_SIMD_TARGET_END
+#	endif//GLM_SIMD_DISPATCH_AVX2
+
+	typedef compute_spline_array<float_packet_width> spline_array;
+
+	// One entry per simd_dispatch tier. There is no 16 lane float_packet, AVX-512 CPUs run the AVX2 kernels
+	struct spline_array_kernels
+	{
+		std::size_t (*aos_catmull_rom)(std::size_t, length_t, float const* const*, float const*, float*);
+		std::size_t (*aos_hermite)(std::size_t, length_t, float const* const*, float const*, float*);
+		std::size_t (*aos_cubic)(std::size_t, length_t, float const* const*, float const*, float*);
+		std::size_t (*aos_mix)(std::size_t, length_t, float const* const*, float const*, std::size_t, float*);
+	};
+
+	GLM_FUNC_QUALIFIER spline_array_kernels const& spline_array_dispatch()
+	{
+#		if GLM_SIMD_DISPATCH_AVX2
+		typedef avx2::compute_spline_array<avx2::float_packet_width> spline_array_avx2;
+#		else
+		typedef spline_array spline_array_avx2;
+#		endif
+		static spline_array_kernels const Tiers[] =
+		{
+			{&spline_array::aos_catmull_rom, &spline_array::aos_hermite, &spline_array::aos_cubic, &spline_array::aos_mix},
+			{&spline_array_avx2::aos_catmull_rom, &spline_array_avx2::aos_hermite, &spline_array_avx2::aos_cubic, &spline_array_avx2::aos_mix},
+			{&spline_array_avx2::aos_catmull_rom, &spline_array_avx2::aos_hermite, &spline_array_avx2::aos_cubic, &spline_array_avx2::aos_mix}
+		};
+		return Tiers[simd_dispatch_current()];
+	}
+
+	template<length_t C>
+	GLM_FUNC_QUALIFIER void mix_array(vec<C, float, defaultp> const* a, vec<C, float, defaultp> const* b, float const* s, std::size_t SStep, vec<C, float, defaultp>* out, std::size_t count)
+	{
+		float const* const In[] = {reinterpret_cast<float const*>(a), reinterpret_cast<float const*>(b)};
+		std::size_t i = spline_array_dispatch().aos_mix(count, C, In, s, SStep, reinterpret_cast<float*>(out));
+		for(; i < count; ++i)
+			out[i] = mix(a[i], b[i], s[i * SStep]);
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void catmullRomArray(vec3 const* v1, vec3 const* v2, vec3 const* v3, vec3 const* v4, float const* s, vec3* out, std::size_t count)
+	{
+		float const* const In[] = {reinterpret_cast<float const*>(v1), reinterpret_cast<float const*>(v2), reinterpret_cast<float const*>(v3), reinterpret_cast<float const*>(v4)};
+		std::size_t i = detail::spline_array_dispatch().aos_catmull_rom(count, 3, In, s, reinterpret_cast<float*>(out));
+		for(; i < count; ++i)
+			out[i] = catmullRom(v1[i], v2[i], v3[i], v4[i], s[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void catmullRomArray(vec4 const* v1, vec4 const* v2, vec4 const* v3, vec4 const* v4, float const* s, vec4* out, std::size_t count)
+	{
+		float const* const In[] = {reinterpret_cast<float const*>(v1), reinterpret_cast<float const*>(v2), reinterpret_cast<float const*>(v3), reinterpret_cast<float const*>(v4)};
+		std::size_t i = detail::spline_array_dispatch().aos_catmull_rom(count, 4, In, s, reinterpret_cast<float*>(out));
+		for(; i < count; ++i)
+			out[i] = catmullRom(v1[i], v2[i], v3[i], v4[i], s[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void hermiteArray(vec3 const* v1, vec3 const* t1, vec3 const* v2, vec3 const* t2, float const* s, vec3* out, std::size_t count)
+	{
+		float const* const In[] = {reinterpret_cast<float const*>(v1), reinterpret_cast<float const*>(t1), reinterpret_cast<float const*>(v2), reinterpret_cast<float const*>(t2)};
+		std::size_t i = detail::spline_array_dispatch().aos_hermite(count, 3, In, s, reinterpret_cast<float*>(out));
+		for(; i < count; ++i)
+			out[i] = hermite(v1[i], t1[i], v2[i], t2[i], s[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void hermiteArray(vec4 const* v1, vec4 const* t1, vec4 const* v2, vec4 const* t2, float const* s, vec4* out, std::size_t count)
+	{
+		float const* const In[] = {reinterpret_cast<float const*>(v1), reinterpret_cast<float const*>(t1), reinterpret_cast<float const*>(v2), reinterpret_cast<float const*>(t2)};
+		std::size_t i = detail::spline_array_dispatch().aos_hermite(count, 4, In, s, reinterpret_cast<float*>(out));
+		for(; i < count; ++i)
+			out[i] = hermite(v1[i], t1[i], v2[i], t2[i], s[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void cubicArray(vec3 const* v1, vec3 const* v2, vec3 const* v3, vec3 const* v4, float const* s, vec3* out, std::size_t count)
+	{
+		float const* const In[] = {reinterpret_cast<float const*>(v1), reinterpret_cast<float const*>(v2), reinterpret_cast<float const*>(v3), reinterpret_cast<float const*>(v4)};
+		std::size_t i = detail::spline_array_dispatch().aos_cubic(count, 3, In, s, reinterpret_cast<float*>(out));
+		for(; i < count; ++i)
+			out[i] = cubic(v1[i], v2[i], v3[i], v4[i], s[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void cubicArray(vec4 const* v1, vec4 const* v2, vec4 const* v3, vec4 const* v4, float const* s, vec4* out, std::size_t count)
+	{
+		float const* const In[] = {reinterpret_cast<float const*>(v1), reinterpret_cast<float const*>(v2), reinterpret_cast<float const*>(v3), reinterpret_cast<float const*>(v4)};
+		std::size_t i = detail::spline_array_dispatch().aos_cubic(count, 4, In, s, reinterpret_cast<float*>(out));
+		for(; i < count; ++i)
+			out[i] = cubic(v1[i], v2[i], v3[i], v4[i], s[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void mixArray(vec3 const* a, vec3 const* b, float s, vec3* out, std::size_t count)
+	{
+		detail::mix_array(a, b, &s, 0, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void mixArray(vec3 const* a, vec3 const* b, float const* s, vec3* out, std::size_t count)
+	{
+		detail::mix_array(a, b, s, 1, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void mixArray(vec4 const* a, vec4 const* b, float s, vec4* out, std::size_t count)
+	{
+		detail::mix_array(a, b, &s, 0, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void mixArray(vec4 const* a, vec4 const* b, float const* s, vec4* out, std::size_t count)
+	{
+		detail::mix_array(a, b, s, 1, out, count);
+	}
+}//namespace glm
@@ -0,0 +1,134 @@
+/// @ref gtx_spline_array
+/// Included once per kernel tier, inside that tier's namespace, after the GLM_GTX_geometric_array kernels
+
+	// Scalar fallback, the caller runs every vector through the GLM_GTX_spline functions. Each function handles a
+	// prefix of the arrays of C component vectors and returns its length. in points to the 4 input arrays, 2 for mix.
+	// s is read at s[i] when SStep is 1 and at s[0] for every vector when it is 0
+	template<length_t L, bool Simd = float_packet<L>::simd>
+	struct compute_spline_array
+	{
+		GLM_FUNC_QUALIFIER static std::size_t aos_catmull_rom(std::size_t, length_t, float const* const*, float const*, float*) { return 0; }
+		GLM_FUNC_QUALIFIER static std::size_t aos_hermite(std::size_t, length_t, float const* const*, float const*, float*) { return 0; }
+		GLM_FUNC_QUALIFIER static std::size_t aos_cubic(std::size_t, length_t, float const* const*, float const*, float*) { return 0; }
+		GLM_FUNC_QUALIFIER static std::size_t aos_mix(std::size_t, length_t, float const* const*, float const*, std::size_t, float*) { return 0; }
+	};
+
+#	if GLM_CONFIG_SIMD == GLM_ENABLE
+	template<length_t L>
+	struct compute_spline_array<L, true>
+	{
+		typedef float_packet<L> P;
+		typedef typename P::type V;
+		typedef compute_geometric_array<L> geometric;
+
+		// Every curve is a sum of its inputs weighted by polynomials of s, the bases give the weights in input order
+
+		// catmullRom with its final halving folded into the weights
+		struct catmull_rom
+		{
+			static length_t const inputs = 4;
+
+			GLM_FUNC_QUALIFIER static void weights(V s, V* f)
+			{
+				V const s2 = P::mul(s, s);
+				V const s3 = P::mul(s2, s);
+				V const Half = P::set1(0.5f);
+				f[0] = P::mul(P::sub(P::add(s2, s2), P::add(s3, s)), Half);
+				f[1] = P::mul(P::add(P::sub(P::mul(P::set1(3.0f), s3), P::mul(P::set1(5.0f), s2)), P::set1(2.0f)), Half);
+				f[2] = P::mul(P::add(P::sub(P::mul(P::set1(4.0f), s2), P::mul(P::set1(3.0f), s3)), s), Half);
+				f[3] = P::mul(P::sub(s3, s2), Half);
+			}
+		};
+
+		// Inputs v1, t1, v2, t2
+		struct hermite
+		{
+			static length_t const inputs = 4;
+
+			GLM_FUNC_QUALIFIER static void weights(V s, V* f)
+			{
+				V const s2 = P::mul(s, s);
+				V const s3 = P::mul(s2, s);
+				V const Cubic = P::sub(P::mul(P::set1(2.0f), s3), P::mul(P::set1(3.0f), s2));
+				f[0] = P::add(Cubic, P::set1(1.0f));
+				f[1] = P::add(P::sub(s3, P::add(s2, s2)), s);
+				f[2] = P::sub(P::set1(0.0f), Cubic);
+				f[3] = P::sub(s3, s2);
+			}
+		};
+
+		struct cubic
+		{
+			static length_t const inputs = 4;
+
+			GLM_FUNC_QUALIFIER static void weights(V s, V* f)
+			{
+				f[2] = s;
+				f[1] = P::mul(s, s);
+				f[0] = P::mul(f[1], s);
+				f[3] = P::set1(1.0f);
+			}
+		};
+
+		struct linear
+		{
+			static length_t const inputs = 2;
+
+			GLM_FUNC_QUALIFIER static void weights(V s, V* f)
+			{
+				f[0] = P::sub(P::set1(1.0f), s);
+				f[1] = s;
+			}
+		};
+
+		template<typename Basis, length_t C, typename Access>
+		GLM_FUNC_QUALIFIER static std::size_t combine(std::size_t count, float const* const* in, float const* s, std::size_t SStep, float* out)
+		{
+			std::size_t i = 0;
+			for(; i + L <= count; i += L)
+			{
+				V f[4], v[4], Sum[4];
+				Basis::weights(SStep ? P::load(s + i) : P::set1(s[0]), f);
+				Access::load(in[0], i, v);
+				for(length_t c = 0; c < C; ++c)
+					Sum[c] = P::mul(v[c], f[0]);
+				for(length_t k = 1; k < Basis::inputs; ++k)
+				{
+					Access::load(in[k], i, v);
+					for(length_t c = 0; c < C; ++c)
+						Sum[c] = P::add(Sum[c], P::mul(v[c], f[k]));
+				}
+				Access::store(out, i, Sum);
+			}
+			return i;
+		}
+
+		template<typename Basis>
+		GLM_FUNC_QUALIFIER static std::size_t aos_combine(std::size_t count, length_t C, float const* const* in, float const* s, std::size_t SStep, float* out)
+		{
+			typedef typename geometric::template aos<4, 4> vec4_aos;
+			typedef typename geometric::template aos<3, geometric::vec3_stride> vec3_aos;
+			return C == 4 ? combine<Basis, 4, vec4_aos>(count, in, s, SStep, out) : combine<Basis, 3, vec3_aos>(count, in, s, SStep, out);
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t aos_catmull_rom(std::size_t count, length_t C, float const* const* in, float const* s, float* out)
+		{
+			return aos_combine<catmull_rom>(count, C, in, s, 1, out);
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t aos_hermite(std::size_t count, length_t C, float const* const* in, float const* s, float* out)
+		{
+			return aos_combine<hermite>(count, C, in, s, 1, out);
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t aos_cubic(std::size_t count, length_t C, float const* const* in, float const* s, float* out)
+		{
+			return aos_combine<cubic>(count, C, in, s, 1, out);
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t aos_mix(std::size_t count, length_t C, float const* const* in, float const* s, std::size_t SStep, float* out)
+		{
+			return aos_combine<linear>(count, C, in, s, SStep, out);
+		}
+	};
+#	endif//GLM_CONFIG_SIMD == GLM_ENABLE
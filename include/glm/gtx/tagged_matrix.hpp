@@ -0,0 +1,114 @@
+/// @ref gtx_tagged_matrix
+/// @file glm/gtx/tagged_matrix.hpp
+///
+/// @see core (dependence)
+/// @see gtc_matrix_inverse (dependence)
+/// @see gtc_matrix_transform (dependence)
+/// @see gtx_matrix_affine (dependence)
+///
+/// @defgroup gtx_tagged_matrix GLM_GTX_tagged_matrix
+/// @ingroup gtx
+///
+/// Include <glm/gtx/tagged_matrix.hpp> to use the features of this extension.
+///
+/// A mat4 that carries the class of transform it is known to be, so inverse picks the cheap path on its own:
+/// rigidInverse for rotations and translations, affineInverse while the last row stays (0, 0, 0, 1), and the
+/// general code otherwise. Products keep track of the class. The class is a promise made by whoever builds the matrix, it is not
+/// checked; matrixClass measures it when it is not known.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/matrix_inverse.hpp"
+#include "../gtc/matrix_transform.hpp"
+#include "matrix_affine.hpp"
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_tagged_matrix is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	else
+#		pragma message("GLM: GLM_GTX_tagged_matrix extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_tagged_matrix
+	/// @{
+
+	/// Transform classes from the most to the least constrained, a product belongs to the larger class of its factors.
+	enum matrix_class
+	{
+		matrix_class_rigid,		///< Rotation and translation
+		matrix_class_affine,	///< Last row (0, 0, 0, 1): rotation, scale, shear and translation
+		matrix_class_general	///< Anything, projections included
+	};
+
+	template<typename T, qualifier Q = defaultp>
+	struct ttagged_mat4
+	{
+		// -- Implementation detail --
+
+		typedef T value_type;
+		typedef mat<4, 4, T, Q> matrix_type;
+
+		// -- Data --
+
+		mat<4, 4, T, Q> value;
+		matrix_class tag;
+
+		// -- Constructors --
+
+		/// Identity, rigid.
+		GLM_FUNC_DECL ttagged_mat4();
+		/// A matrix of unknown class, general.
+		GLM_FUNC_DECL GLM_EXPLICIT ttagged_mat4(mat<4, 4, T, Q> const& m);
+		GLM_FUNC_DECL ttagged_mat4(mat<4, 4, T, Q> const& m, matrix_class c);
+	};
+
+	/// Smallest class m belongs to, each element compared with an absolute tolerance of epsilon.
+	/// From GLM_GTX_tagged_matrix extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL matrix_class matrixClass(mat<4, 4, T, Q> const& m, T epsilon);
+
+	/// Product of the two matrices, of the larger class of the two.
+	/// From GLM_GTX_tagged_matrix extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL ttagged_mat4<T, Q> operator*(ttagged_mat4<T, Q> const& a, ttagged_mat4<T, Q> const& b);
+
+	/// From GLM_GTX_tagged_matrix extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL vec<4, T, Q> operator*(ttagged_mat4<T, Q> const& m, vec<4, T, Q> const& v);
+
+	/// rigidInverse, affineInverse or inverse, whichever the class allows. The inverse keeps the class.
+	/// From GLM_GTX_tagged_matrix extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL ttagged_mat4<T, Q> inverse(ttagged_mat4<T, Q> const& m);
+
+	/// m * translate(v), of the class of m.
+	/// From GLM_GTX_tagged_matrix extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL ttagged_mat4<T, Q> translate(ttagged_mat4<T, Q> const& m, vec<3, T, Q> const& v);
+
+	/// m * rotate(angle, axis), of the class of m.
+	/// From GLM_GTX_tagged_matrix extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL ttagged_mat4<T, Q> rotate(ttagged_mat4<T, Q> const& m, T angle, vec<3, T, Q> const& axis);
+
+	/// m * scale(v), at least affine.
+	/// From GLM_GTX_tagged_matrix extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL ttagged_mat4<T, Q> scale(ttagged_mat4<T, Q> const& m, vec<3, T, Q> const& v);
+
+	typedef ttagged_mat4<float, defaultp>		tagged_mat4;
+	typedef ttagged_mat4<double, defaultp>		tagged_dmat4;
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+	/// Stored in an aligned_mat4, so the SIMD kernels of the product, affineInverse and rigidInverse apply.
+	typedef ttagged_mat4<float, aligned_highp>	aligned_tagged_mat4;
+#	endif
+
+	/// @}
+}//namespace glm
+
+#include "tagged_matrix.inl"
@@ -0,0 +1,92 @@
+/// @ref gtx_tagged_matrix
+
+namespace glm
+{
+	// -- Constructors --
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER ttagged_mat4<T, Q>::ttagged_mat4()
+		: value(static_cast<T>(1))
+		, tag(matrix_class_rigid)
+	{}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER ttagged_mat4<T, Q>::ttagged_mat4(mat<4, 4, T, Q> const& m)
+		: value(m)
+		, tag(matrix_class_general)
+	{}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER ttagged_mat4<T, Q>::ttagged_mat4(mat<4, 4, T, Q> const& m, matrix_class c)
+		: value(m)
+		, tag(c)
+	{}
+
+	// -- Functions --
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER matrix_class matrixClass(mat<4, 4, T, Q> const& m, T epsilon)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_GENTYPE, "'matrixClass' only accept floating-point inputs");
+
+		if(abs(m[0][3]) > epsilon || abs(m[1][3]) > epsilon || abs(m[2][3]) > epsilon || abs(m[3][3] - static_cast<T>(1)) > epsilon)
+			return matrix_class_general;
+
+		// Orthonormal columns and no reflection
+		vec<3, T, Q> const c0(m[0]);
+		vec<3, T, Q> const c1(m[1]);
+		vec<3, T, Q> const c2(m[2]);
+		bool const Orthonormal =
+			abs(dot(c0, c0) - static_cast<T>(1)) <= epsilon &&
+			abs(dot(c1, c1) - static_cast<T>(1)) <= epsilon &&
+			abs(dot(c2, c2) - static_cast<T>(1)) <= epsilon &&
+			abs(dot(c0, c1)) <= epsilon && abs(dot(c1, c2)) <= epsilon && abs(dot(c2, c0)) <= epsilon &&
+			dot(cross(c0, c1), c2) > static_cast<T>(0);
+		return Orthonormal ? matrix_class_rigid : matrix_class_affine;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER ttagged_mat4<T, Q> operator*(ttagged_mat4<T, Q> const& a, ttagged_mat4<T, Q> const& b)
+	{
+		// The plain product, not affineMul: the mat4 kernels are faster than it at every tier, only the tags combine
+		return ttagged_mat4<T, Q>(a.value * b.value, a.tag > b.tag ? a.tag : b.tag);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<4, T, Q> operator*(ttagged_mat4<T, Q> const& m, vec<4, T, Q> const& v)
+	{
+		return m.value * v;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER ttagged_mat4<T, Q> inverse(ttagged_mat4<T, Q> const& m)
+	{
+		switch(m.tag)
+		{
+		case matrix_class_rigid:
+			return ttagged_mat4<T, Q>(rigidInverse(m.value), m.tag);
+		case matrix_class_affine:
+			return ttagged_mat4<T, Q>(affineInverse(m.value), m.tag);
+		default:
+			return ttagged_mat4<T, Q>(inverse(m.value), m.tag);
+		}
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER ttagged_mat4<T, Q> translate(ttagged_mat4<T, Q> const& m, vec<3, T, Q> const& v)
+	{
+		return m * ttagged_mat4<T, Q>(translate(mat<4, 4, T, Q>(static_cast<T>(1)), v), matrix_class_rigid);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER ttagged_mat4<T, Q> rotate(ttagged_mat4<T, Q> const& m, T angle, vec<3, T, Q> const& axis)
+	{
+		return m * ttagged_mat4<T, Q>(rotate(mat<4, 4, T, Q>(static_cast<T>(1)), angle, axis), matrix_class_rigid);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER ttagged_mat4<T, Q> scale(ttagged_mat4<T, Q> const& m, vec<3, T, Q> const& v)
+	{
+		return m * ttagged_mat4<T, Q>(scale(mat<4, 4, T, Q>(static_cast<T>(1)), v), matrix_class_affine);
+	}
+}//namespace glm
@@ -0,0 +1,66 @@
+/// @ref gtx_transform_array
+/// @file glm/gtx/transform_array.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_transform_array GLM_GTX_transform_array
+/// @ingroup gtx
+///
+/// Include <glm/gtx/transform_array.hpp> to use the features of this extension.
+///
+/// Transform contiguous arrays of points by one 4x4 matrix: vec4 arrays, vec3 arrays packed at a 12 byte stride, and
+/// points split in one array per coordinate.
+/// The SIMD paths handle 4 points per SSE2 register, 8 per AVX register and 16 per AVX-512 register, transposing
+/// vec3 points to one coordinate per register on the fly; the last few points go through the scalar code.
+/// Outputs of GLM_TRANSFORM_ARRAY_STREAM_BYTES or more (4 MiB by default) that start on a 16 byte boundary are written
+/// with non temporal stores, so a large result does not evict the working set from the caches.
+/// With GLM_CONFIG_SIMD_DISPATCH arrays of 64 points or more run the widest kernels the CPU supports, whatever GLM_ARCH
+/// the code was built for, see GLM_GTX_simd_dispatch.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../detail/_simd_dispatch.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_transform_array is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	else
+#		pragma message("GLM: GLM_GTX_transform_array extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_transform_array
+	/// @{
+
+	/// out[i] = m * in[i] for count vectors. in and out may be the same array.
+	/// From GLM_GTX_transform_array extension.
+	GLM_FUNC_DECL void transformArray(mat4 const& m, vec4 const* in, vec4* out, std::size_t count);
+
+	/// out[i] = m * vec4(in[i], 1) for count points, the homogeneous result a vertex shader would output.
+	/// From GLM_GTX_transform_array extension.
+	GLM_FUNC_DECL void transformArray(mat4 const& m, vec3 const* in, vec4* out, std::size_t count);
+
+	/// out[i] = vec3(m * vec4(in[i], 1)) for count points. The bottom row of m is not read, it is taken to be
+	/// (0, 0, 0, 1) as in any model or view matrix. in and out may be the same array.
+	/// From GLM_GTX_transform_array extension.
+	GLM_FUNC_DECL void transformAffineArray(mat4 const& m, vec3 const* in, vec3* out, std::size_t count);
+
+	/// out[i] = vec3(p) / p.w with p = m * vec4(in[i], 1) for count points, for projection matrices.
+	/// in and out may be the same array.
+	/// From GLM_GTX_transform_array extension.
+	GLM_FUNC_DECL void transformProjectArray(mat4 const& m, vec3 const* in, vec3* out, std::size_t count);
+
+	/// transformAffineArray for count points given in structure of arrays form, one array per coordinate.
+	/// The outputs may be the inputs.
+	/// From GLM_GTX_transform_array extension.
+	GLM_FUNC_DECL void transformAffineSoA(mat4 const& m, std::size_t count, float const* x, float const* y, float const* z, float* outX, float* outY, float* outZ);
+
+	/// @}
+}//namespace glm
+
+#include "transform_array.inl"
@@ -0,0 +1,136 @@
+/// @ref gtx_transform_array
+
+#ifndef GLM_TRANSFORM_ARRAY_STREAM_BYTES
+#	define GLM_TRANSFORM_ARRAY_STREAM_BYTES (4 << 20)
+#endif
+
+namespace glm{
+namespace detail
+{
+	// Non temporal stores need 16 byte aligned addresses and only pay off once the output no longer fits in the caches
+	GLM_FUNC_QUALIFIER bool transform_array_stream(void const* Out, std::size_t Bytes)
+	{
+		return Bytes >= static_cast<std::size_t>(GLM_TRANSFORM_ARRAY_STREAM_BYTES) && (reinterpret_cast<std::size_t>(Out) & 15) == 0;
+	}
+
+#	define GLM_KERNEL_ARCH GLM_ARCH
+#	include "transform_array_simd.inl"
+#	undef GLM_KERNEL_ARCH
+
+#	if GLM_SIMD_DISPATCH_AVX2
+	GLM_SIMD_TARGET_AVX2_BEGIN
+	namespace avx2
+	{
+#	define GLM_KERNEL_ARCH GLM_ARCH_AVX2
+#	include "transform_array_simd.inl"
+#	undef GLM_KERNEL_ARCH
+	}//namespace avx2
+	GLM_SIMD_TARGET_END
+#	endif//GLM_SIMD_DISPATCH_AVX2
+
+#	if GLM_SIMD_DISPATCH_AVX512
+	GLM_SIMD_TARGET_AVX512_BEGIN
+	namespace avx512
+	{
+#	define GLM_KERNEL_ARCH GLM_ARCH_AVX512
+#	include "transform_array_simd.inl"
+#	undef GLM_KERNEL_ARCH
+	}//namespace avx512
+	GLM_SIMD_TARGET_END
+#	endif//GLM_SIMD_DISPATCH_AVX512
+
+	typedef compute_transform_array<transform_lanes_width> transform_array;
+
+	// One entry per simd_dispatch tier
+	struct transform_array_kernels
+	{
+		std::size_t (*vec4s)(mat4 const&, vec4 const*, vec4*, std::size_t, bool);
+		std::size_t (*points)(mat4 const&, vec3 const*, vec4*, std::size_t, bool);
+		std::size_t (*affine)(mat4 const&, vec3 const*, vec3*, std::size_t, bool);
+		std::size_t (*project)(mat4 const&, vec3 const*, vec3*, std::size_t, bool);
+		std::size_t (*affine_soa)(mat4 const&, float const* const*, float* const*, std::size_t, bool);
+	};
+
+	GLM_FUNC_QUALIFIER transform_array_kernels const& transform_array_dispatch()
+	{
+#		if GLM_SIMD_DISPATCH_AVX2
+		typedef avx2::compute_transform_array<avx2::transform_lanes_width> transform_array_avx2;
+#		else
+		typedef transform_array transform_array_avx2;
+#		endif
+#		if GLM_SIMD_DISPATCH_AVX512
+		typedef avx512::compute_transform_array<avx512::transform_lanes_width> transform_array_avx512;
+#		else
+		typedef transform_array transform_array_avx512;
+#		endif
+		static transform_array_kernels const Tiers[] =
+		{
+			{&transform_array::vec4s, &transform_array::points, &transform_array::affine, &transform_array::project, &transform_array::affine_soa},
+			{&transform_array_avx2::vec4s, &transform_array_avx2::points, &transform_array_avx2::affine, &transform_array_avx2::project, &transform_array_avx2::affine_soa},
+			{&transform_array_avx512::vec4s, &transform_array_avx512::points, &transform_array_avx512::affine, &transform_array_avx512::project, &transform_array_avx512::affine_soa}
+		};
+		return Tiers[simd_dispatch_current()];
+	}
+
+	// Shorter arrays run the GLM_ARCH kernels inline instead, a wider register would mostly leave them to the scalar
+	// tail anyway. They are also far below the streaming threshold
+	static std::size_t const transform_array_dispatch_min = 64;
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void transformArray(mat4 const& m, vec4 const* in, vec4* out, std::size_t count)
+	{
+		std::size_t i = count < detail::transform_array_dispatch_min
+			? detail::transform_array::vec4s(m, in, out, count, false)
+			: detail::transform_array_dispatch().vec4s(m, in, out, count, detail::transform_array_stream(out, count * sizeof(vec4)));
+		for(; i < count; ++i)
+			out[i] = m * in[i];
+	}
+
+	GLM_FUNC_QUALIFIER void transformArray(mat4 const& m, vec3 const* in, vec4* out, std::size_t count)
+	{
+		std::size_t i = count < detail::transform_array_dispatch_min
+			? detail::transform_array::points(m, in, out, count, false)
+			: detail::transform_array_dispatch().points(m, in, out, count, detail::transform_array_stream(out, count * sizeof(vec4)));
+		for(; i < count; ++i)
+			out[i] = m * vec4(in[i], 1.0f);
+	}
+
+	GLM_FUNC_QUALIFIER void transformAffineArray(mat4 const& m, vec3 const* in, vec3* out, std::size_t count)
+	{
+		std::size_t i = count < detail::transform_array_dispatch_min
+			? detail::transform_array::affine(m, in, out, count, false)
+			: detail::transform_array_dispatch().affine(m, in, out, count, detail::transform_array_stream(out, count * sizeof(vec3)));
+		for(; i < count; ++i)
+			out[i] = vec3(m[0]) * in[i].x + vec3(m[1]) * in[i].y + (vec3(m[2]) * in[i].z + vec3(m[3]));
+	}
+
+	GLM_FUNC_QUALIFIER void transformProjectArray(mat4 const& m, vec3 const* in, vec3* out, std::size_t count)
+	{
+		std::size_t i = count < detail::transform_array_dispatch_min
+			? detail::transform_array::project(m, in, out, count, false)
+			: detail::transform_array_dispatch().project(m, in, out, count, detail::transform_array_stream(out, count * sizeof(vec3)));
+		for(; i < count; ++i)
+		{
+			vec4 const p = m * vec4(in[i], 1.0f);
+			out[i] = vec3(p) / p.w;
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void transformAffineSoA(mat4 const& m, std::size_t count, float const* x, float const* y, float const* z, float* outX, float* outY, float* outZ)
+	{
+		float const* const In[] = {x, y, z};
+		float* const Out[] = {outX, outY, outZ};
+		bool const Stream = detail::transform_array_stream(outX, count * sizeof(float) * 3)
+			&& detail::transform_array_stream(outY, count * sizeof(float) * 3) && detail::transform_array_stream(outZ, count * sizeof(float) * 3);
+		std::size_t i = count < detail::transform_array_dispatch_min
+			? detail::transform_array::affine_soa(m, In, Out, count, false)
+			: detail::transform_array_dispatch().affine_soa(m, In, Out, count, Stream);
+		for(; i < count; ++i)
+		{
+			vec3 const p = vec3(m[0]) * x[i] + vec3(m[1]) * y[i] + (vec3(m[2]) * z[i] + vec3(m[3]));
+			outX[i] = p.x;
+			outY[i] = p.y;
+			outZ[i] = p.z;
+		}
+	}
+}//namespace glm
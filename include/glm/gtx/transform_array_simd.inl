@@ -0,0 +1,326 @@
+/// @ref gtx_transform_array
+/// Included once per kernel tier, inside that tier's namespace, with GLM_KERNEL_ARCH naming its instruction sets
+
+	// W blocks of 4 floats per register, each block worked on independently: shuffles stay inside a block, loads and
+	// stores move whole blocks, so one register transforms W groups of 4 points. simd is false without such a register
+	template<length_t W>
+	struct transform_lanes
+	{
+		static bool const simd = false;
+	};
+
+#	if GLM_KERNEL_ARCH & GLM_ARCH_SSE2_BIT
+	template<>
+	struct transform_lanes<1>
+	{
+		static bool const simd = true;
+		typedef __m128 type;
+
+		GLM_FUNC_QUALIFIER static type broadcast(float const* p) { return _mm_loadu_ps(p); }
+		GLM_FUNC_QUALIFIER static type set1(float s) { return _mm_set1_ps(s); }
+		GLM_FUNC_QUALIFIER static type load(float const* p) { return _mm_loadu_ps(p); }
+		GLM_FUNC_QUALIFIER static type load(float const* p, std::size_t) { return _mm_loadu_ps(p); }
+		template<bool Stream>
+		GLM_FUNC_QUALIFIER static void store(float* p, std::size_t, type v)
+		{
+			if(Stream)
+				_mm_stream_ps(p, v);
+			else
+				_mm_storeu_ps(p, v);
+		}
+		GLM_FUNC_QUALIFIER static type add(type a, type b) { return _mm_add_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type mul(type a, type b) { return _mm_mul_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type div(type a, type b) { return _mm_div_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type madd(type a, type b, type c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+		template<int S>
+		GLM_FUNC_QUALIFIER static type shuffle(type a, type b) { return _mm_shuffle_ps(a, b, S); }
+	};
+#	endif//GLM_KERNEL_ARCH & GLM_ARCH_SSE2_BIT
+
+#	if GLM_KERNEL_ARCH & GLM_ARCH_AVX_BIT
+	template<>
+	struct transform_lanes<2>
+	{
+		static bool const simd = true;
+		typedef __m256 type;
+
+		GLM_FUNC_QUALIFIER static type broadcast(float const* p) { return _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(p)); }
+		GLM_FUNC_QUALIFIER static type set1(float s) { return _mm256_set1_ps(s); }
+		GLM_FUNC_QUALIFIER static type load(float const* p) { return _mm256_loadu_ps(p); }
+		GLM_FUNC_QUALIFIER static type load(float const* p, std::size_t Stride)
+		{
+			return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p)), _mm_loadu_ps(p + Stride), 1);
+		}
+		template<bool Stream>
+		GLM_FUNC_QUALIFIER static void store(float* p, std::size_t Stride, type v)
+		{
+			transform_lanes<1>::store<Stream>(p, 0, _mm256_castps256_ps128(v));
+			transform_lanes<1>::store<Stream>(p + Stride, 0, _mm256_extractf128_ps(v, 1));
+		}
+		GLM_FUNC_QUALIFIER static type add(type a, type b) { return _mm256_add_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type mul(type a, type b) { return _mm256_mul_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type div(type a, type b) { return _mm256_div_ps(a, b); }
+#		if GLM_KERNEL_ARCH & GLM_ARCH_AVX2_BIT
+		GLM_FUNC_QUALIFIER static type madd(type a, type b, type c) { return _mm256_fmadd_ps(a, b, c); }
+#		else
+		GLM_FUNC_QUALIFIER static type madd(type a, type b, type c) { return _mm256_add_ps(_mm256_mul_ps(a, b), c); }
+#		endif
+		template<int S>
+		GLM_FUNC_QUALIFIER static type shuffle(type a, type b) { return _mm256_shuffle_ps(a, b, S); }
+	};
+#	endif//GLM_KERNEL_ARCH & GLM_ARCH_AVX_BIT
+
+#	if GLM_KERNEL_ARCH & GLM_ARCH_AVX512_BIT
+	template<>
+	struct transform_lanes<4>
+	{
+		static bool const simd = true;
+		typedef __m512 type;
+
+		// Blocks are inserted into and extracted from defined registers, the plain broadcast, cast and extract
+		// intrinsics start from _mm512_undefined_ps which GCC 12 reports as maybe uninitialized
+		GLM_FUNC_QUALIFIER static type broadcast(float const* p) { return load(p, 0); }
+		GLM_FUNC_QUALIFIER static type set1(float s) { return _mm512_set1_ps(s); }
+		GLM_FUNC_QUALIFIER static type load(float const* p) { return _mm512_loadu_ps(p); }
+		GLM_FUNC_QUALIFIER static type load(float const* p, std::size_t Stride)
+		{
+			type v = _mm512_insertf32x4(_mm512_setzero_ps(), _mm_loadu_ps(p), 0);
+			v = _mm512_insertf32x4(v, _mm_loadu_ps(p + Stride), 1);
+			v = _mm512_insertf32x4(v, _mm_loadu_ps(p + Stride * 2), 2);
+			return _mm512_insertf32x4(v, _mm_loadu_ps(p + Stride * 3), 3);
+		}
+		template<bool Stream>
+		GLM_FUNC_QUALIFIER static void store(float* p, std::size_t Stride, type v)
+		{
+			__m128 const Zero = _mm_setzero_ps();
+			transform_lanes<1>::store<Stream>(p, 0, _mm512_mask_extractf32x4_ps(Zero, 0xF, v, 0));
+			transform_lanes<1>::store<Stream>(p + Stride, 0, _mm512_mask_extractf32x4_ps(Zero, 0xF, v, 1));
+			transform_lanes<1>::store<Stream>(p + Stride * 2, 0, _mm512_mask_extractf32x4_ps(Zero, 0xF, v, 2));
+			transform_lanes<1>::store<Stream>(p + Stride * 3, 0, _mm512_mask_extractf32x4_ps(Zero, 0xF, v, 3));
+		}
+		GLM_FUNC_QUALIFIER static type add(type a, type b) { return _mm512_add_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type mul(type a, type b) { return _mm512_mul_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type div(type a, type b) { return _mm512_div_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type madd(type a, type b, type c) { return _mm512_fmadd_ps(a, b, c); }
+		template<int S>
+		GLM_FUNC_QUALIFIER static type shuffle(type a, type b) { return _mm512_shuffle_ps(a, b, S); }
+	};
+#	endif//GLM_KERNEL_ARCH & GLM_ARCH_AVX512_BIT
+
+	// Widest transform_lanes of the tier
+#	if GLM_KERNEL_ARCH & GLM_ARCH_AVX512_BIT
+	static length_t const transform_lanes_width = 4;
+#	elif GLM_KERNEL_ARCH & GLM_ARCH_AVX_BIT
+	static length_t const transform_lanes_width = 2;
+#	else
+	static length_t const transform_lanes_width = 1;
+#	endif
+
+	// Each function transforms a prefix of the array and returns its length, the caller finishes the rest point by point
+	template<length_t W, bool Simd = transform_lanes<W>::simd>
+	struct compute_transform_array
+	{
+		GLM_FUNC_QUALIFIER static std::size_t vec4s(mat4 const&, vec4 const*, vec4*, std::size_t, bool) { return 0; }
+		GLM_FUNC_QUALIFIER static std::size_t points(mat4 const&, vec3 const*, vec4*, std::size_t, bool) { return 0; }
+		GLM_FUNC_QUALIFIER static std::size_t affine(mat4 const&, vec3 const*, vec3*, std::size_t, bool) { return 0; }
+		GLM_FUNC_QUALIFIER static std::size_t project(mat4 const&, vec3 const*, vec3*, std::size_t, bool) { return 0; }
+		GLM_FUNC_QUALIFIER static std::size_t affine_soa(mat4 const&, float const* const*, float* const*, std::size_t, bool) { return 0; }
+	};
+
+#	if GLM_CONFIG_SIMD == GLM_ENABLE
+	template<length_t W>
+	struct compute_transform_array<W, true>
+	{
+		typedef transform_lanes<W> lanes;
+		typedef typename lanes::type type;
+
+		// Four packed vec3 per block, x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3, to one coordinate per register
+		GLM_FUNC_QUALIFIER static void load_points(float const* p, type& x, type& y, type& z)
+		{
+			type const a = lanes::load(p, 12);
+			type const b = lanes::load(p + 4, 12);
+			type const c = lanes::load(p + 8, 12);
+			type const xy = lanes::template shuffle<_MM_SHUFFLE(2, 1, 3, 2)>(b, c);
+			type const yz = lanes::template shuffle<_MM_SHUFFLE(1, 0, 2, 1)>(a, b);
+			x = lanes::template shuffle<_MM_SHUFFLE(2, 0, 3, 0)>(a, xy);
+			y = lanes::template shuffle<_MM_SHUFFLE(3, 1, 2, 0)>(yz, xy);
+			z = lanes::template shuffle<_MM_SHUFFLE(3, 0, 3, 1)>(yz, c);
+		}
+
+		template<bool Stream>
+		GLM_FUNC_QUALIFIER static void store_points(float* p, type x, type y, type z)
+		{
+			type const xxyy = lanes::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(x, y);
+			type const zzxx = lanes::template shuffle<_MM_SHUFFLE(3, 1, 2, 0)>(z, x);
+			type const yyzz = lanes::template shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(y, z);
+			lanes::template store<Stream>(p, 12, lanes::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(xxyy, zzxx));
+			lanes::template store<Stream>(p + 4, 12, lanes::template shuffle<_MM_SHUFFLE(3, 1, 2, 0)>(yyzz, xxyy));
+			lanes::template store<Stream>(p + 8, 12, lanes::template shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(zzxx, yyzz));
+		}
+
+		// Every matrix element splat across a register, read once up front: out may alias m as far as the
+		// compiler knows, which would otherwise reload the matrix after each store
+		struct splats
+		{
+			GLM_FUNC_QUALIFIER explicit splats(mat4 const& m)
+			{
+				for(length_t c = 0; c < 4; ++c)
+				for(length_t r = 0; r < 4; ++r)
+					Data[c][r] = lanes::set1(m[c][r]);
+			}
+
+			// Same grouping as the scalar mat4 * vec4: (c0 * x + c1 * y) + (c2 * z + c3)
+			GLM_FUNC_QUALIFIER type row(length_t r, type x, type y, type z) const
+			{
+				return lanes::add(lanes::madd(Data[1][r], y, lanes::mul(Data[0][r], x)), lanes::madd(Data[2][r], z, Data[3][r]));
+			}
+
+			type Data[4][4];
+		};
+
+		template<bool Stream>
+		GLM_FUNC_QUALIFIER static std::size_t vec4s(mat4 const& m, vec4 const* in, vec4* out, std::size_t count)
+		{
+			type const c0 = lanes::broadcast(&m[0][0]);
+			type const c1 = lanes::broadcast(&m[1][0]);
+			type const c2 = lanes::broadcast(&m[2][0]);
+			type const c3 = lanes::broadcast(&m[3][0]);
+
+			std::size_t i = 0;
+			for(; i + W <= count; i += W)
+			{
+				type const v = lanes::load(&in[i].x);
+				type const x = lanes::template shuffle<_MM_SHUFFLE(0, 0, 0, 0)>(v, v);
+				type const y = lanes::template shuffle<_MM_SHUFFLE(1, 1, 1, 1)>(v, v);
+				type const z = lanes::template shuffle<_MM_SHUFFLE(2, 2, 2, 2)>(v, v);
+				type const w = lanes::template shuffle<_MM_SHUFFLE(3, 3, 3, 3)>(v, v);
+				lanes::template store<Stream>(&out[i].x, 4, lanes::add(lanes::madd(c1, y, lanes::mul(c0, x)), lanes::madd(c3, w, lanes::mul(c2, z))));
+			}
+			return i;
+		}
+
+		template<bool Stream>
+		GLM_FUNC_QUALIFIER static std::size_t points(mat4 const& m, vec3 const* in, vec4* out, std::size_t count)
+		{
+			splats const s(m);
+			std::size_t i = 0;
+			for(; i + W * 4 <= count; i += W * 4)
+			{
+				type x, y, z;
+				load_points(&in[i].x, x, y, z);
+				type const ox = s.row(0, x, y, z);
+				type const oy = s.row(1, x, y, z);
+				type const oz = s.row(2, x, y, z);
+				type const ow = s.row(3, x, y, z);
+
+				// 4x4 transpose per block back to one point per vec4
+				type const xxyy01 = lanes::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(ox, oy);
+				type const xxyy23 = lanes::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(ox, oy);
+				type const zzww01 = lanes::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(oz, ow);
+				type const zzww23 = lanes::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(oz, ow);
+				float* const p = &out[i].x;
+				lanes::template store<Stream>(p, 16, lanes::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(xxyy01, zzww01));
+				lanes::template store<Stream>(p + 4, 16, lanes::template shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(xxyy01, zzww01));
+				lanes::template store<Stream>(p + 8, 16, lanes::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(xxyy23, zzww23));
+				lanes::template store<Stream>(p + 12, 16, lanes::template shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(xxyy23, zzww23));
+			}
+			return i;
+		}
+
+		template<bool Stream>
+		GLM_FUNC_QUALIFIER static std::size_t affine(mat4 const& m, vec3 const* in, vec3* out, std::size_t count)
+		{
+			splats const s(m);
+			std::size_t i = 0;
+			for(; i + W * 4 <= count; i += W * 4)
+			{
+				type x, y, z;
+				load_points(&in[i].x, x, y, z);
+				store_points<Stream>(&out[i].x, s.row(0, x, y, z), s.row(1, x, y, z), s.row(2, x, y, z));
+			}
+			return i;
+		}
+
+		template<bool Stream>
+		GLM_FUNC_QUALIFIER static std::size_t project(mat4 const& m, vec3 const* in, vec3* out, std::size_t count)
+		{
+			splats const s(m);
+			std::size_t i = 0;
+			for(; i + W * 4 <= count; i += W * 4)
+			{
+				type x, y, z;
+				load_points(&in[i].x, x, y, z);
+				type const w = s.row(3, x, y, z);
+				store_points<Stream>(&out[i].x, lanes::div(s.row(0, x, y, z), w), lanes::div(s.row(1, x, y, z), w), lanes::div(s.row(2, x, y, z), w));
+			}
+			return i;
+		}
+
+		// One array per coordinate, so no transpose either way
+		template<bool Stream>
+		GLM_FUNC_QUALIFIER static std::size_t affine_soa(mat4 const& m, float const* const* in, float* const* out, std::size_t count)
+		{
+			splats const s(m);
+			std::size_t i = 0;
+			for(; i + W * 4 <= count; i += W * 4)
+			{
+				type const x = lanes::load(in[0] + i);
+				type const y = lanes::load(in[1] + i);
+				type const z = lanes::load(in[2] + i);
+				type const ox = s.row(0, x, y, z);
+				type const oy = s.row(1, x, y, z);
+				type const oz = s.row(2, x, y, z);
+				lanes::template store<Stream>(out[0] + i, 4, ox);
+				lanes::template store<Stream>(out[1] + i, 4, oy);
+				lanes::template store<Stream>(out[2] + i, 4, oz);
+			}
+			return i;
+		}
+
+		// Streamed stores are weakly ordered, the fence makes them visible before anything written after the call
+		GLM_FUNC_QUALIFIER static std::size_t vec4s(mat4 const& m, vec4 const* in, vec4* out, std::size_t count, bool Stream)
+		{
+			if(!Stream)
+				return vec4s<false>(m, in, out, count);
+			std::size_t const Done = vec4s<true>(m, in, out, count);
+			_mm_sfence();
+			return Done;
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t points(mat4 const& m, vec3 const* in, vec4* out, std::size_t count, bool Stream)
+		{
+			if(!Stream)
+				return points<false>(m, in, out, count);
+			std::size_t const Done = points<true>(m, in, out, count);
+			_mm_sfence();
+			return Done;
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t affine(mat4 const& m, vec3 const* in, vec3* out, std::size_t count, bool Stream)
+		{
+			if(!Stream)
+				return affine<false>(m, in, out, count);
+			std::size_t const Done = affine<true>(m, in, out, count);
+			_mm_sfence();
+			return Done;
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t project(mat4 const& m, vec3 const* in, vec3* out, std::size_t count, bool Stream)
+		{
+			if(!Stream)
+				return project<false>(m, in, out, count);
+			std::size_t const Done = project<true>(m, in, out, count);
+			_mm_sfence();
+			return Done;
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t affine_soa(mat4 const& m, float const* const* in, float* const* out, std::size_t count, bool Stream)
+		{
+			if(!Stream)
+				return affine_soa<false>(m, in, out, count);
+			std::size_t const Done = affine_soa<true>(m, in, out, count);
+			_mm_sfence();
+			return Done;
+		}
+	};
+#	endif//GLM_CONFIG_SIMD == GLM_ENABLE
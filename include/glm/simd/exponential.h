@@ -3,7 +3,8 @@
 
 #pragma once
 
-#include "platform.h"
+#include "common.h"
+#include <limits>
 
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
@@ -12,9 +13,230 @@ GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec1_sqrt_lowp(glm_f32vec4 x)
 	return _mm_mul_ss(_mm_rsqrt_ss(x), x);
 }
 
+// rsqrtps has a relative error below 1.5 * 2^-12, one Newton step brings it to 2^-22 or so
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_inversesqrt_lowp(glm_f32vec4 x)
+{
+	return _mm_rsqrt_ps(x);
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_inversesqrt_mediump(glm_f32vec4 x)
+{
+	// y' = y (1.5 - 0.5 x y^2), which 0 * inf would turn into NaN for zero and infinite x
+	glm_f32vec4 const y = _mm_rsqrt_ps(x);
+	glm_f32vec4 const Step = _mm_mul_ps(y, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(x, _mm_set1_ps(0.5f)), y), y)));
+	glm_f32vec4 const Finite = _mm_and_ps(_mm_cmpgt_ps(x, _mm_setzero_ps()), _mm_cmplt_ps(x, _mm_set1_ps(std::numeric_limits<float>::infinity())));
+	return _mm_or_ps(_mm_and_ps(Finite, Step), _mm_andnot_ps(Finite, y));
+}
+
+// sqrt(x) = x / sqrt(x), zero and inf are kept aside since 0 * inf is NaN
 GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_sqrt_lowp(glm_f32vec4 x)
 {
-	return _mm_mul_ps(_mm_rsqrt_ps(x), x);
+	glm_f32vec4 const Keep = _mm_or_ps(_mm_cmpeq_ps(x, _mm_setzero_ps()), _mm_cmpeq_ps(x, _mm_set1_ps(std::numeric_limits<float>::infinity())));
+	return _mm_or_ps(_mm_and_ps(Keep, x), _mm_andnot_ps(Keep, _mm_mul_ps(_mm_rsqrt_ps(x), x)));
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_sqrt_mediump(glm_f32vec4 x)
+{
+	glm_f32vec4 const Keep = _mm_or_ps(_mm_cmpeq_ps(x, _mm_setzero_ps()), _mm_cmpeq_ps(x, _mm_set1_ps(std::numeric_limits<float>::infinity())));
+	return _mm_or_ps(_mm_and_ps(Keep, x), _mm_andnot_ps(Keep, _mm_mul_ps(glm_vec4_inversesqrt_mediump(x), x)));
+}
+
+// Cephes single precision polynomials. Max error in ulp against the exact result, over every float:
+// exp: 1.0, exp2: 1.5, log: 0.9, log2: 1.5
+// pow is exp2(y log2(x)) and its error grows with |y log2(x)|: 1.8 while that stays below 32, 7.2 as the result nears
+// the ends of the float range (random inputs). Denormal results are rounded twice and may be one denormal unit off.
+
+// 2^n for integer n in [-252, 256], scaled in two steps so that neither factor leaves the normal exponent range
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_ldexp(glm_vec4 x, glm_ivec4 n)
+{
+	glm_ivec4 const Half = _mm_srai_epi32(n, 1);
+	glm_ivec4 const Bias = _mm_set1_epi32(127);
+	glm_vec4 const Scale0 = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(Half, Bias), 23));
+	glm_vec4 const Scale1 = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_sub_epi32(n, Half), Bias), 23));
+	return _mm_mul_ps(_mm_mul_ps(x, Scale0), Scale1);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_exp(glm_vec4 x)
+{
+	// Out of these bounds the result is 0 or inf, clamping keeps the exponent arithmetic in range
+	glm_vec4 const Clamped = _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(-104.0f)), _mm_set1_ps(89.0f));
+
+	// x = n ln2 + r, |r| <= ln2 / 2 with ln2 split in two parts
+	glm_ivec4 const n = _mm_cvtps_epi32(_mm_mul_ps(Clamped, _mm_set1_ps(1.44269504088896341f)));
+	glm_vec4 const fn = _mm_cvtepi32_ps(n);
+	glm_vec4 r = glm_vec4_fma(fn, _mm_set1_ps(-0.693359375f), Clamped);
+	r = glm_vec4_fma(fn, _mm_set1_ps(2.12194440e-4f), r);
+	glm_vec4 const z = _mm_mul_ps(r, r);
+
+	// Estrin's scheme, like glm_vec4_log_reduce
+	glm_vec4 const p01 = glm_vec4_fma(_mm_set1_ps(1.6666665459e-1f), r, _mm_set1_ps(5.0000001201e-1f));
+	glm_vec4 const p23 = glm_vec4_fma(_mm_set1_ps(8.3334519073e-3f), r, _mm_set1_ps(4.1665795894e-2f));
+	glm_vec4 const p45 = glm_vec4_fma(_mm_set1_ps(1.9875691500e-4f), r, _mm_set1_ps(1.3981999507e-3f));
+	glm_vec4 const p25 = glm_vec4_fma(p45, z, p23);
+	glm_vec4 p = glm_vec4_fma(p25, z, p01);
+	p = _mm_add_ps(glm_vec4_fma(p, z, r), _mm_set1_ps(1.0f));
+
+	glm_vec4 const Result = glm_vec4_ldexp(p, n);
+	glm_vec4 const Nan = _mm_cmpunord_ps(x, x);
+	return _mm_or_ps(_mm_and_ps(Nan, x), _mm_andnot_ps(Nan, Result));
+}
+
+// 2^(n + r) for |r| <= 1/2
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_exp2_reduced(glm_vec4 r, glm_ivec4 n)
+{
+	// Estrin's scheme, like glm_vec4_log_reduce
+	glm_vec4 const r2 = _mm_mul_ps(r, r);
+	glm_vec4 const p12 = glm_vec4_fma(_mm_set1_ps(2.402264791363012e-1f), r, _mm_set1_ps(6.931472028550421e-1f));
+	glm_vec4 const p34 = glm_vec4_fma(_mm_set1_ps(9.618437357674640e-3f), r, _mm_set1_ps(5.550332471162809e-2f));
+	glm_vec4 const p56 = glm_vec4_fma(_mm_set1_ps(1.535336188319500e-4f), r, _mm_set1_ps(1.339887440266574e-3f));
+	glm_vec4 const p36 = glm_vec4_fma(p56, r2, p34);
+	glm_vec4 const p16 = glm_vec4_fma(p36, r2, p12);
+	return glm_vec4_ldexp(glm_vec4_fma(p16, r, _mm_set1_ps(1.0f)), n);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_exp2(glm_vec4 x)
+{
+	glm_vec4 const Clamped = _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(-151.0f)), _mm_set1_ps(129.0f));
+	glm_ivec4 const n = _mm_cvtps_epi32(Clamped);
+	glm_vec4 const Result = glm_vec4_exp2_reduced(_mm_sub_ps(Clamped, _mm_cvtepi32_ps(n)), n);
+
+	glm_vec4 const Nan = _mm_cmpunord_ps(x, x);
+	return _mm_or_ps(_mm_and_ps(Nan, x), _mm_andnot_ps(Nan, Result));
+}
+
+// Splits a positive finite x into x = 2^e (1 + m) with m in [sqrt(1/2) - 1, sqrt(2) - 1] and returns the part of
+// log(1 + m) past m, so that log(x) = e ln2 + m + returned value
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log_reduce(glm_vec4 x, glm_vec4* m, glm_vec4* e)
+{
+	// Denormals are scaled up by 2^23 first
+	glm_vec4 const Denormal = _mm_cmplt_ps(x, _mm_set1_ps(std::numeric_limits<float>::min()));
+	x = _mm_or_ps(_mm_and_ps(Denormal, _mm_mul_ps(x, _mm_set1_ps(8388608.0f))), _mm_andnot_ps(Denormal, x));
+	glm_ivec4 const Bits = _mm_castps_si128(x);
+
+	glm_ivec4 Exponent = _mm_sub_epi32(_mm_srli_epi32(Bits, 23), _mm_set1_epi32(126));
+	Exponent = _mm_sub_epi32(Exponent, _mm_and_si128(_mm_castps_si128(Denormal), _mm_set1_epi32(23)));
+	glm_vec4 Mantissa = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(Bits, _mm_set1_epi32(0x007fffff)), _mm_set1_epi32(0x3f000000)));
+
+	// Mantissa in [0.5, 1): below sqrt(1/2) it is doubled and the exponent lowered
+	glm_vec4 const Small = _mm_cmplt_ps(Mantissa, _mm_set1_ps(0.707106781186547524f));
+	Exponent = _mm_add_epi32(Exponent, _mm_castps_si128(Small));
+	Mantissa = _mm_sub_ps(_mm_add_ps(Mantissa, _mm_and_ps(Small, Mantissa)), _mm_set1_ps(1.0f));
+
+	// Estrin's scheme: the degree 8 polynomial is evaluated in four dependent steps instead of eight
+	glm_vec4 const z = _mm_mul_ps(Mantissa, Mantissa);
+	glm_vec4 const z2 = _mm_mul_ps(z, z);
+	glm_vec4 const p01 = glm_vec4_fma(_mm_set1_ps(-2.4999993993e-1f), Mantissa, _mm_set1_ps(3.3333331174e-1f));
+	glm_vec4 const p23 = glm_vec4_fma(_mm_set1_ps(-1.6668057665e-1f), Mantissa, _mm_set1_ps(2.0000714765e-1f));
+	glm_vec4 const p45 = glm_vec4_fma(_mm_set1_ps(-1.2420140846e-1f), Mantissa, _mm_set1_ps(1.4249322787e-1f));
+	glm_vec4 const p67 = glm_vec4_fma(_mm_set1_ps(-1.1514610310e-1f), Mantissa, _mm_set1_ps(1.1676998740e-1f));
+	glm_vec4 const p03 = glm_vec4_fma(p23, z, p01);
+	glm_vec4 const p47 = glm_vec4_fma(p67, z, p45);
+	glm_vec4 const p48 = glm_vec4_fma(_mm_set1_ps(7.0376836292e-2f), z2, p47);
+	glm_vec4 p = glm_vec4_fma(p48, z2, p03);
+	p = _mm_mul_ps(_mm_mul_ps(p, Mantissa), z);
+
+	*m = Mantissa;
+	*e = _mm_cvtepi32_ps(Exponent);
+	return glm_vec4_fma(_mm_set1_ps(-0.5f), z, p);
+}
+
+// log and log2 results for zero, negative, infinite and NaN inputs
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log_special(glm_vec4 x, glm_vec4 Result)
+{
+	glm_vec4 const Inf = _mm_set1_ps(std::numeric_limits<float>::infinity());
+	glm_vec4 const Zero = _mm_cmpeq_ps(x, _mm_setzero_ps());
+	glm_vec4 const Invalid = _mm_or_ps(_mm_cmplt_ps(x, _mm_setzero_ps()), _mm_cmpunord_ps(x, x));
+	glm_vec4 const Infinite = _mm_cmpeq_ps(x, Inf);
+	Result = _mm_or_ps(_mm_and_ps(Zero, _mm_xor_ps(Inf, _mm_set1_ps(-0.0f))), _mm_andnot_ps(Zero, Result));
+	Result = _mm_or_ps(_mm_and_ps(Infinite, Inf), _mm_andnot_ps(Infinite, Result));
+	return _mm_or_ps(Invalid, Result);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log(glm_vec4 x)
+{
+	glm_vec4 m, e;
+	glm_vec4 const y = glm_vec4_log_reduce(x, &m, &e);
+
+	// e ln2 with ln2 split in two parts
+	glm_vec4 Result = glm_vec4_fma(e, _mm_set1_ps(-2.12194440e-4f), y);
+	Result = _mm_add_ps(Result, m);
+	Result = glm_vec4_fma(e, _mm_set1_ps(0.693359375f), Result);
+	return glm_vec4_log_special(x, Result);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log2(glm_vec4 x)
+{
+	glm_vec4 m, e;
+	glm_vec4 const y = glm_vec4_log_reduce(x, &m, &e);
+
+	// log2(e) = 1 + LOG2EA, the product by 1 stays exact
+	glm_vec4 const Log2ea = _mm_set1_ps(0.44269504088896340736f);
+	glm_vec4 Result = _mm_mul_ps(y, Log2ea);
+	Result = glm_vec4_fma(m, Log2ea, Result);
+	Result = _mm_add_ps(_mm_add_ps(Result, y), m);
+	Result = _mm_add_ps(Result, e);
+	return glm_vec4_log_special(x, Result);
+}
+
+// y log2(x) for two lanes in double precision, from the parts glm_vec4_log_reduce splits x in
+GLM_FUNC_QUALIFIER glm_f64vec2 glm_dvec2_pow_exponent(glm_vec4 y, glm_vec4 m, glm_vec4 Tail, glm_vec4 e)
+{
+	glm_f64vec2 const Log2e = _mm_set1_pd(1.44269504088896340736);
+	glm_f64vec2 const Fraction = _mm_mul_pd(_mm_add_pd(_mm_cvtps_pd(m), _mm_cvtps_pd(Tail)), Log2e);
+	return _mm_mul_pd(_mm_cvtps_pd(y), _mm_add_pd(_mm_cvtps_pd(e), Fraction));
+}
+
+// Integer exponents of negative bases give a signed result, other finite negative bases NaN.
+// pow(x, 0), pow(1, y) and pow(-1, +-inf) are 1
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_pow(glm_vec4 x, glm_vec4 y)
+{
+	glm_vec4 const SignMask = _mm_set1_ps(-0.0f);
+	glm_vec4 const One = _mm_set1_ps(1.0f);
+	glm_vec4 const Inf = _mm_set1_ps(std::numeric_limits<float>::infinity());
+	glm_vec4 const Ax = _mm_andnot_ps(SignMask, x);
+	glm_vec4 const Ay = _mm_andnot_ps(SignMask, y);
+
+	// y log2(x) is formed in double precision: in float its rounding error, scaled by y, would dominate the result
+	glm_vec4 m, e;
+	glm_vec4 const Tail = glm_vec4_log_reduce(Ax, &m, &e);
+	glm_f64vec2 const Min = _mm_set1_pd(-151.0);
+	glm_f64vec2 const Max = _mm_set1_pd(129.0);
+	glm_f64vec2 const Tl = _mm_min_pd(_mm_max_pd(glm_dvec2_pow_exponent(y, m, Tail, e), Min), Max);
+	glm_f64vec2 const Th = _mm_min_pd(_mm_max_pd(glm_dvec2_pow_exponent(_mm_movehl_ps(y, y), _mm_movehl_ps(m, m), _mm_movehl_ps(Tail, Tail), _mm_movehl_ps(e, e)), Min), Max);
+	glm_ivec4 const Nl = _mm_cvtpd_epi32(Tl);
+	glm_ivec4 const Nh = _mm_cvtpd_epi32(Th);
+	glm_vec4 const r = _mm_movelh_ps(_mm_cvtpd_ps(_mm_sub_pd(Tl, _mm_cvtepi32_pd(Nl))), _mm_cvtpd_ps(_mm_sub_pd(Th, _mm_cvtepi32_pd(Nh))));
+	glm_vec4 Result = glm_vec4_exp2_reduced(r, _mm_unpacklo_epi64(Nl, Nh));
+
+	// Positive finite bases with finite exponents are done, the other lanes are rare enough to branch on
+	glm_vec4 const Fix = _mm_or_ps(_mm_or_ps(_mm_cmple_ps(x, _mm_setzero_ps()), _mm_cmpunord_ps(x, y)), _mm_or_ps(_mm_cmpeq_ps(Ax, Inf), _mm_cmpeq_ps(Ay, Inf)));
+	if(!_mm_movemask_ps(Fix))
+		return Result;
+
+	// Zero, infinite and NaN bases: y log2(x) is +-inf or NaN, giving inf, 0 or NaN
+	glm_vec4 const Special = _mm_or_ps(_mm_or_ps(_mm_cmpeq_ps(Ax, _mm_setzero_ps()), _mm_cmpeq_ps(Ax, Inf)), _mm_cmpunord_ps(Ax, y));
+	glm_vec4 const Product = _mm_mul_ps(y, glm_vec4_log_special(Ax, _mm_setzero_ps()));
+	glm_vec4 const SpecialResult = _mm_or_ps(_mm_and_ps(_mm_cmpgt_ps(Product, _mm_setzero_ps()), Inf), _mm_cmpunord_ps(Product, Product));
+	Result = _mm_or_ps(_mm_and_ps(Special, SpecialResult), _mm_andnot_ps(Special, Result));
+
+	// Infinite exponents: 0 or inf depending on which side of 1 |x| is
+	glm_vec4 const InfiniteY = _mm_and_ps(_mm_cmpeq_ps(Ay, Inf), _mm_cmpord_ps(x, x));
+	glm_vec4 const InfiniteResult = _mm_and_ps(_mm_cmpgt_ps(_mm_mul_ps(y, _mm_sub_ps(Ax, One)), _mm_setzero_ps()), Inf);
+	Result = _mm_or_ps(_mm_and_ps(InfiniteY, InfiniteResult), _mm_andnot_ps(InfiniteY, Result));
+
+	// Past 2^24 every float is an even integer
+	glm_vec4 const Large = _mm_cmpge_ps(Ay, _mm_set1_ps(16777216.0f));
+	glm_ivec4 const Truncated = _mm_cvttps_epi32(y);
+	glm_vec4 const Integer = _mm_or_ps(Large, _mm_cmpeq_ps(_mm_cvtepi32_ps(Truncated), y));
+	glm_vec4 const Odd = _mm_andnot_ps(Large, _mm_castsi128_ps(_mm_slli_epi32(Truncated, 31)));
+
+	glm_vec4 const NegativeFinite = _mm_and_ps(_mm_cmplt_ps(x, _mm_setzero_ps()), _mm_cmpneq_ps(Ax, Inf));
+	Result = _mm_xor_ps(Result, _mm_and_ps(Odd, _mm_and_ps(x, SignMask)));
+	Result = _mm_or_ps(Result, _mm_andnot_ps(Integer, NegativeFinite));
+
+	glm_vec4 const AbsOneInf = _mm_and_ps(_mm_cmpeq_ps(Ax, One), InfiniteY);
+	glm_vec4 const Unit = _mm_or_ps(_mm_or_ps(_mm_cmpeq_ps(y, _mm_setzero_ps()), _mm_cmpeq_ps(x, One)), AbsOneInf);
+	return _mm_or_ps(_mm_and_ps(Unit, One), _mm_andnot_ps(Unit, Result));
 }
 
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -121,4 +121,57 @@ GLM_FUNC_QUALIFIER __m128 glm_vec4_refract(glm_vec4 I, glm_vec4 N, glm_vec4 eta)
 	return sub2;
 }
 
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+
+// Double precision, one dvec4 per 256 bit register. Sums group lanes like the scalar code, (x + y) + (z + w)
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_dot(glm_dvec4 v1, glm_dvec4 v2)
+{
+	glm_dvec4 const mul0 = _mm256_mul_pd(v1, v2);
+	glm_dvec4 const add0 = _mm256_add_pd(mul0, _mm256_permute_pd(mul0, 0x5));
+	glm_dvec4 const add1 = _mm256_add_pd(add0, _mm256_permute2f128_pd(add0, add0, 0x01));
+	return add1;
+}
+
+// A 256 bit sqrtpd or divpd costs about twice the 128 bit one, the square root and division run on the low lane
+// and the result is broadcast
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_length(glm_dvec4 x)
+{
+	__m128d const dot0 = _mm256_castpd256_pd128(glm_dvec4_dot(x, x));
+	__m128d const sqt0 = _mm_sqrt_sd(dot0, dot0);
+	return _mm256_set1_pd(_mm_cvtsd_f64(sqt0));
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_distance(glm_dvec4 p0, glm_dvec4 p1)
+{
+	glm_dvec4 const sub0 = _mm256_sub_pd(p0, p1);
+	glm_dvec4 const len0 = glm_dvec4_length(sub0);
+	return len0;
+}
+
+// v * inversesqrt(dot(v, v)) with a full precision square root and division, there is no double rsqrt
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_normalize(glm_dvec4 v)
+{
+	__m128d const dot0 = _mm256_castpd256_pd128(glm_dvec4_dot(v, v));
+	__m128d const isr0 = _mm_div_sd(_mm_set_sd(1.0), _mm_sqrt_sd(dot0, dot0));
+	glm_dvec4 const mul0 = _mm256_mul_pd(v, _mm256_set1_pd(_mm_cvtsd_f64(isr0)));
+	return mul0;
+}
+
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_cross(glm_dvec4 v1, glm_dvec4 v2)
+{
+	glm_dvec4 const swp0 = _mm256_permute4x64_pd(v1, _MM_SHUFFLE(3, 0, 2, 1));
+	glm_dvec4 const swp1 = _mm256_permute4x64_pd(v1, _MM_SHUFFLE(3, 1, 0, 2));
+	glm_dvec4 const swp2 = _mm256_permute4x64_pd(v2, _MM_SHUFFLE(3, 0, 2, 1));
+	glm_dvec4 const swp3 = _mm256_permute4x64_pd(v2, _MM_SHUFFLE(3, 1, 0, 2));
+	glm_dvec4 const mul0 = _mm256_mul_pd(swp0, swp3);
+	glm_dvec4 const mul1 = _mm256_mul_pd(swp1, swp2);
+	glm_dvec4 const sub0 = _mm256_sub_pd(mul0, mul1);
+	return sub0;
+}
+#	endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
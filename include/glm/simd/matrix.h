@@ -1025,4 +1025,386 @@ GLM_FUNC_QUALIFIER void glm_mat4_outerProduct(__m128 const& c, __m128 const& r,
 	out[3] = _mm_mul_ps(c, _mm_shuffle_ps(r, r, _MM_SHUFFLE(3, 3, 3, 3)));
 }
 
+// mat4 whose last row is (0, 0, 0, 1): a linear part in the first 3 columns and a translation in the fourth.
+// The inverses ignore the last row of in and write (0, 0, 0, 1).
+
+GLM_FUNC_QUALIFIER void glm_mat4_affine_mul(glm_vec4 const in1[4], glm_vec4 const in2[4], glm_vec4 out[4])
+{
+	glm_vec4 Col[4];
+	for(int j = 0; j < 4; ++j)
+	{
+		glm_vec4 const e0 = _mm_shuffle_ps(in2[j], in2[j], _MM_SHUFFLE(0, 0, 0, 0));
+		glm_vec4 const e1 = _mm_shuffle_ps(in2[j], in2[j], _MM_SHUFFLE(1, 1, 1, 1));
+		glm_vec4 const e2 = _mm_shuffle_ps(in2[j], in2[j], _MM_SHUFFLE(2, 2, 2, 2));
+
+		glm_vec4 const mul0 = _mm_mul_ps(in1[0], e0);
+		glm_vec4 const mad0 = glm_vec4_fma(in1[1], e1, mul0);
+		Col[j] = glm_vec4_fma(in1[2], e2, mad0);
+	}
+	// out may alias in1
+	out[0] = Col[0];
+	out[1] = Col[1];
+	out[2] = Col[2];
+	out[3] = _mm_add_ps(Col[3], in1[3]);
+}
+
+// Linear part inverted with the cross products of its columns, translation t replaced by -inverse(linear) * t
+GLM_FUNC_QUALIFIER void glm_mat4_affine_inverse(glm_vec4 const in[4], glm_vec4 out[4])
+{
+	glm_vec4 const MaskXYZ = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+	glm_vec4 const a0 = _mm_and_ps(in[0], MaskXYZ);
+	glm_vec4 const a1 = _mm_and_ps(in[1], MaskXYZ);
+	glm_vec4 const a2 = _mm_and_ps(in[2], MaskXYZ);
+
+	// Rows of the adjugate, 0 in w
+	glm_vec4 Row[4];
+	Row[0] = glm_vec4_cross(a1, a2);
+	Row[1] = glm_vec4_cross(a2, a0);
+	Row[2] = glm_vec4_cross(a0, a1);
+	Row[3] = _mm_setzero_ps();
+
+	glm_vec4 const det0 = glm_vec4_dot(a0, Row[0]);
+	glm_vec4 const rcp0 = _mm_div_ps(_mm_set1_ps(1.0f), det0);
+
+	glm_vec4 Col[4];
+	glm_mat4_transpose(Row, Col);
+	out[0] = _mm_mul_ps(Col[0], rcp0);
+	out[1] = _mm_mul_ps(Col[1], rcp0);
+	out[2] = _mm_mul_ps(Col[2], rcp0);
+
+	glm_vec4 const t0 = _mm_shuffle_ps(in[3], in[3], _MM_SHUFFLE(0, 0, 0, 0));
+	glm_vec4 const t1 = _mm_shuffle_ps(in[3], in[3], _MM_SHUFFLE(1, 1, 1, 1));
+	glm_vec4 const t2 = _mm_shuffle_ps(in[3], in[3], _MM_SHUFFLE(2, 2, 2, 2));
+	glm_vec4 const mul0 = _mm_mul_ps(out[0], t0);
+	glm_vec4 const mad0 = glm_vec4_fma(out[1], t1, mul0);
+	glm_vec4 const mad1 = glm_vec4_fma(out[2], t2, mad0);
+	out[3] = _mm_sub_ps(_mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f), mad1);
+}
+
+// Rotation and translation only: the rotation is transposed, the translation rotated back and negated
+GLM_FUNC_QUALIFIER void glm_mat4_rigid_inverse(glm_vec4 const in[4], glm_vec4 out[4])
+{
+	glm_vec4 Col[4];
+	Col[0] = in[0];
+	Col[1] = in[1];
+	Col[2] = in[2];
+	Col[3] = _mm_setzero_ps();
+
+	// the w lanes of the first 3 columns end up in Row[3], which is dropped
+	glm_vec4 Row[4];
+	glm_mat4_transpose(Col, Row);
+
+	glm_vec4 const t0 = _mm_shuffle_ps(in[3], in[3], _MM_SHUFFLE(0, 0, 0, 0));
+	glm_vec4 const t1 = _mm_shuffle_ps(in[3], in[3], _MM_SHUFFLE(1, 1, 1, 1));
+	glm_vec4 const t2 = _mm_shuffle_ps(in[3], in[3], _MM_SHUFFLE(2, 2, 2, 2));
+	glm_vec4 const mul0 = _mm_mul_ps(Row[0], t0);
+	glm_vec4 const mad0 = glm_vec4_fma(Row[1], t1, mul0);
+	glm_vec4 const mad1 = glm_vec4_fma(Row[2], t2, mad0);
+
+	out[0] = Row[0];
+	out[1] = Row[1];
+	out[2] = Row[2];
+	out[3] = _mm_sub_ps(_mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f), mad1);
+}
+
+// Affine transforms stored as their 3 rows (R | t), the mat3x4 layout of GLM_GTX_matrix_affine and mat3x4_cast of
+// GLM_GTX_dual_quaternion. The fourth row, (0, 0, 0, 1), is implicit.
+
+GLM_FUNC_QUALIFIER void glm_affine_mul(glm_vec4 const in1[3], glm_vec4 const in2[3], glm_vec4 out[3])
+{
+	// row i: in1[i].x * in2[0] + in1[i].y * in2[1] + in1[i].z * in2[2] + (0, 0, 0, in1[i].w)
+	glm_vec4 const MaskW = _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0));
+	glm_vec4 Row[3];
+	for(int i = 0; i < 3; ++i)
+	{
+		glm_vec4 const e0 = _mm_shuffle_ps(in1[i], in1[i], _MM_SHUFFLE(0, 0, 0, 0));
+		glm_vec4 const e1 = _mm_shuffle_ps(in1[i], in1[i], _MM_SHUFFLE(1, 1, 1, 1));
+		glm_vec4 const e2 = _mm_shuffle_ps(in1[i], in1[i], _MM_SHUFFLE(2, 2, 2, 2));
+
+		glm_vec4 const mad0 = glm_vec4_fma(e0, in2[0], _mm_and_ps(in1[i], MaskW));
+		glm_vec4 const mad1 = glm_vec4_fma(e1, in2[1], mad0);
+		Row[i] = glm_vec4_fma(e2, in2[2], mad1);
+	}
+	// out may alias in2
+	out[0] = Row[0];
+	out[1] = Row[1];
+	out[2] = Row[2];
+}
+
+// (m * v).xyz in the x, y and z lanes, 0 in w
+GLM_FUNC_QUALIFIER glm_vec4 glm_affine_mul_vec4(glm_vec4 const m[3], glm_vec4 v)
+{
+	glm_vec4 Mul[4];
+	Mul[0] = _mm_mul_ps(m[0], v);
+	Mul[1] = _mm_mul_ps(m[1], v);
+	Mul[2] = _mm_mul_ps(m[2], v);
+	Mul[3] = _mm_setzero_ps();
+
+	glm_vec4 Col[4];
+	glm_mat4_transpose(Mul, Col);
+	return _mm_add_ps(_mm_add_ps(Col[0], Col[1]), _mm_add_ps(Col[2], Col[3]));
+}
+
+// (R^T | -R^T t), R orthonormal
+GLM_FUNC_QUALIFIER void glm_affine_rigid_inverse(glm_vec4 const in[3], glm_vec4 out[3])
+{
+	// R^T t in the x, y and z lanes
+	glm_vec4 const t0 = _mm_shuffle_ps(in[0], in[0], _MM_SHUFFLE(3, 3, 3, 3));
+	glm_vec4 const t1 = _mm_shuffle_ps(in[1], in[1], _MM_SHUFFLE(3, 3, 3, 3));
+	glm_vec4 const t2 = _mm_shuffle_ps(in[2], in[2], _MM_SHUFFLE(3, 3, 3, 3));
+	glm_vec4 const mul0 = _mm_mul_ps(in[0], t0);
+	glm_vec4 const mad0 = glm_vec4_fma(in[1], t1, mul0);
+	glm_vec4 const mad1 = glm_vec4_fma(in[2], t2, mad0);
+
+	glm_vec4 Row[4];
+	Row[0] = in[0];
+	Row[1] = in[1];
+	Row[2] = in[2];
+	Row[3] = _mm_xor_ps(mad1, _mm_set1_ps(-0.0f));
+
+	glm_vec4 Col[4];
+	glm_mat4_transpose(Row, Col);
+	out[0] = Col[0];
+	out[1] = Col[1];
+	out[2] = Col[2];
+}
+
+// (R^-1 | -R^-1 t) with R^-1 from the cross products of the rows of R
+GLM_FUNC_QUALIFIER void glm_affine_inverse(glm_vec4 const in[3], glm_vec4 out[3])
+{
+	// Columns of the adjugate of R, 0 in w
+	glm_vec4 const c0 = glm_vec4_cross(in[1], in[2]);
+	glm_vec4 const c1 = glm_vec4_cross(in[2], in[0]);
+	glm_vec4 const c2 = glm_vec4_cross(in[0], in[1]);
+
+	glm_vec4 const det0 = glm_vec4_dot(_mm_and_ps(in[0], _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1))), c0);
+	glm_vec4 const rcp0 = _mm_div_ps(_mm_set1_ps(1.0f), det0);
+
+	// adj(R) t in the x, y and z lanes
+	glm_vec4 const t0 = _mm_shuffle_ps(in[0], in[0], _MM_SHUFFLE(3, 3, 3, 3));
+	glm_vec4 const t1 = _mm_shuffle_ps(in[1], in[1], _MM_SHUFFLE(3, 3, 3, 3));
+	glm_vec4 const t2 = _mm_shuffle_ps(in[2], in[2], _MM_SHUFFLE(3, 3, 3, 3));
+	glm_vec4 const mul0 = _mm_mul_ps(c0, t0);
+	glm_vec4 const mad0 = glm_vec4_fma(c1, t1, mul0);
+	glm_vec4 const mad1 = glm_vec4_fma(c2, t2, mad0);
+
+	glm_vec4 Row[4];
+	Row[0] = c0;
+	Row[1] = c1;
+	Row[2] = c2;
+	Row[3] = _mm_xor_ps(mad1, _mm_set1_ps(-0.0f));
+
+	glm_vec4 Col[4];
+	glm_mat4_transpose(Row, Col);
+	out[0] = _mm_mul_ps(Col[0], rcp0);
+	out[1] = _mm_mul_ps(Col[1], rcp0);
+	out[2] = _mm_mul_ps(Col[2], rcp0);
+}
+
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+// AVX2 and FMA: two columns per 256 bit register.
+// The matrices are read and written as arrays of 4 columns, 16 contiguous floats, like the SSE functions above.
+
+GLM_FUNC_QUALIFIER void glm_mat4_mul_avx2(glm_vec4 const in1[4], glm_vec4 const in2[4], glm_vec4 out[4])
+{
+	// each column of in1 in both halves, times the broadcast elements of two columns of in2 at once
+	__m256 const a0 = _mm256_broadcast_ps(&in1[0]);
+	__m256 const a1 = _mm256_broadcast_ps(&in1[1]);
+	__m256 const a2 = _mm256_broadcast_ps(&in1[2]);
+	__m256 const a3 = _mm256_broadcast_ps(&in1[3]);
+
+	__m256 const b01 = _mm256_loadu_ps(reinterpret_cast<float const*>(&in2[0]));
+	__m256 const b23 = _mm256_loadu_ps(reinterpret_cast<float const*>(&in2[2]));
+
+	__m256 const m01a = _mm256_fmadd_ps(a1, _mm256_permute_ps(b01, _MM_SHUFFLE(1, 1, 1, 1)), _mm256_mul_ps(a0, _mm256_permute_ps(b01, _MM_SHUFFLE(0, 0, 0, 0))));
+	__m256 const m01b = _mm256_fmadd_ps(a3, _mm256_permute_ps(b01, _MM_SHUFFLE(3, 3, 3, 3)), _mm256_mul_ps(a2, _mm256_permute_ps(b01, _MM_SHUFFLE(2, 2, 2, 2))));
+	__m256 const m23a = _mm256_fmadd_ps(a1, _mm256_permute_ps(b23, _MM_SHUFFLE(1, 1, 1, 1)), _mm256_mul_ps(a0, _mm256_permute_ps(b23, _MM_SHUFFLE(0, 0, 0, 0))));
+	__m256 const m23b = _mm256_fmadd_ps(a3, _mm256_permute_ps(b23, _MM_SHUFFLE(3, 3, 3, 3)), _mm256_mul_ps(a2, _mm256_permute_ps(b23, _MM_SHUFFLE(2, 2, 2, 2))));
+
+	_mm256_storeu_ps(reinterpret_cast<float*>(&out[0]), _mm256_add_ps(m01a, m01b));
+	_mm256_storeu_ps(reinterpret_cast<float*>(&out[2]), _mm256_add_ps(m23a, m23b));
+}
+
+GLM_FUNC_QUALIFIER void glm_mat4_transpose_avx2(glm_vec4 const in[4], glm_vec4 out[4])
+{
+	__m256 const m01 = _mm256_loadu_ps(reinterpret_cast<float const*>(&in[0]));
+	__m256 const m23 = _mm256_loadu_ps(reinterpret_cast<float const*>(&in[2]));
+
+	// rows 0 and 1 take elements x then y of every column, rows 2 and 3 elements z then w
+	__m256i const Rows01 = _mm256_setr_epi32(0, 4, 0, 4, 1, 5, 1, 5);
+	__m256i const Rows23 = _mm256_setr_epi32(2, 6, 2, 6, 3, 7, 3, 7);
+
+	_mm256_storeu_ps(reinterpret_cast<float*>(&out[0]), _mm256_blend_ps(_mm256_permutevar8x32_ps(m01, Rows01), _mm256_permutevar8x32_ps(m23, Rows01), 0xCC));
+	_mm256_storeu_ps(reinterpret_cast<float*>(&out[2]), _mm256_blend_ps(_mm256_permutevar8x32_ps(m01, Rows23), _mm256_permutevar8x32_ps(m23, Rows23), 0xCC));
+}
+
+// SubFactor pairs of glm_mat4_inverse, m[2][p] * m[3][q] - m[3][p] * m[2][q] and the same with columns 1 and 2 or 1 and 3,
+// for (p0, q0) in the low half and (p1, q1) in the high half. m12 holds columns 1 and 2, m23 columns 2 and 3
+GLM_FUNC_QUALIFIER __m256 glm_mat4_inverse_factors_avx2(__m256 m12, __m256 m23, int p0, int q0, int p1, int q1)
+{
+	__m256 const Ap = _mm256_permutevar8x32_ps(m12, _mm256_setr_epi32(4 + p0, 4 + p0, p0, p0, 4 + p1, 4 + p1, p1, p1));
+	__m256 const Aq = _mm256_permutevar8x32_ps(m12, _mm256_setr_epi32(4 + q0, 4 + q0, q0, q0, 4 + q1, 4 + q1, q1, q1));
+	__m256 const Bp = _mm256_permutevar8x32_ps(m23, _mm256_setr_epi32(4 + p0, 4 + p0, 4 + p0, p0, 4 + p1, 4 + p1, 4 + p1, p1));
+	__m256 const Bq = _mm256_permutevar8x32_ps(m23, _mm256_setr_epi32(4 + q0, 4 + q0, 4 + q0, q0, 4 + q1, 4 + q1, 4 + q1, q1));
+	return _mm256_fmsub_ps(Ap, Bq, _mm256_mul_ps(Bp, Aq));
+}
+
+// The cofactor expansion of glm_mat4_inverse, computing Inv0 with Inv1 and Inv2 with Inv3
+GLM_FUNC_QUALIFIER void glm_mat4_inverse_avx2(glm_vec4 const in[4], glm_vec4 out[4])
+{
+	__m256 const m01 = _mm256_loadu_ps(reinterpret_cast<float const*>(&in[0]));
+	__m256 const m12 = _mm256_loadu_ps(reinterpret_cast<float const*>(&in[1]));
+	__m256 const m23 = _mm256_loadu_ps(reinterpret_cast<float const*>(&in[2]));
+
+	// Fac0 to Fac5 of the SSE version
+	__m256 const Fac01 = glm_mat4_inverse_factors_avx2(m12, m23, 2, 3, 1, 3);
+	__m256 const Fac23 = glm_mat4_inverse_factors_avx2(m12, m23, 1, 2, 0, 3);
+	__m256 const Fac45 = glm_mat4_inverse_factors_avx2(m12, m23, 0, 2, 0, 1);
+
+	__m256 const Fac00 = _mm256_permute2f128_ps(Fac01, Fac01, 0x00);
+	__m256 const Fac13 = _mm256_permute2f128_ps(Fac01, Fac23, 0x31);
+	__m256 const Fac24 = _mm256_permute2f128_ps(Fac23, Fac45, 0x20);
+	__m256 const Fac12 = _mm256_permute2f128_ps(Fac01, Fac23, 0x21);
+	__m256 const Fac34 = _mm256_permute2f128_ps(Fac23, Fac45, 0x21);
+	__m256 const Fac55 = _mm256_permute2f128_ps(Fac45, Fac45, 0x11);
+
+	// VecK = (m[1][K], m[0][K], m[0][K], m[0][K])
+	__m256 const Vec10 = _mm256_permutevar8x32_ps(m01, _mm256_setr_epi32(5, 1, 1, 1, 4, 0, 0, 0));
+	__m256 const Vec22 = _mm256_permutevar8x32_ps(m01, _mm256_setr_epi32(6, 2, 2, 2, 6, 2, 2, 2));
+	__m256 const Vec33 = _mm256_permutevar8x32_ps(m01, _mm256_setr_epi32(7, 3, 3, 3, 7, 3, 3, 3));
+	__m256 const Vec00 = _mm256_permutevar8x32_ps(m01, _mm256_setr_epi32(4, 0, 0, 0, 4, 0, 0, 0));
+	__m256 const Vec11 = _mm256_permutevar8x32_ps(m01, _mm256_setr_epi32(5, 1, 1, 1, 5, 1, 1, 1));
+	__m256 const Vec32 = _mm256_permutevar8x32_ps(m01, _mm256_setr_epi32(7, 3, 3, 3, 6, 2, 2, 2));
+
+	// SignB then SignA, applied by flipping sign bits
+	__m256 const Sign = _mm256_setr_ps(0.0f, -0.0f, 0.0f, -0.0f, -0.0f, 0.0f, -0.0f, 0.0f);
+	__m256 const Inv01 = _mm256_xor_ps(Sign, _mm256_fmadd_ps(Vec33, Fac24, _mm256_fnmadd_ps(Vec22, Fac13, _mm256_mul_ps(Vec10, Fac00))));
+	__m256 const Inv23 = _mm256_xor_ps(Sign, _mm256_fmadd_ps(Vec32, Fac55, _mm256_fnmadd_ps(Vec11, Fac34, _mm256_mul_ps(Vec00, Fac12))));
+
+	// Determinant = m[0][0] * Inv0[0] + m[0][1] * Inv1[0] + m[0][2] * Inv2[0] + m[0][3] * Inv3[0]
+	__m256 const Col0 = _mm256_fmadd_ps(Inv23, _mm256_permutevar8x32_ps(m01, _mm256_setr_epi32(2, 2, 2, 2, 3, 3, 3, 3)),
+		_mm256_mul_ps(Inv01, _mm256_permutevar8x32_ps(m01, _mm256_setr_epi32(0, 0, 0, 0, 1, 1, 1, 1))));
+	__m128 const Det0 = _mm_add_ps(_mm256_castps256_ps128(Col0), _mm256_extractf128_ps(Col0, 1));
+	__m256 const Rcp0 = _mm256_broadcastss_ps(_mm_div_ss(_mm_set_ss(1.0f), Det0));
+
+	_mm256_storeu_ps(reinterpret_cast<float*>(&out[0]), _mm256_mul_ps(Inv01, Rcp0));
+	_mm256_storeu_ps(reinterpret_cast<float*>(&out[2]), _mm256_mul_ps(Inv23, Rcp0));
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+#if GLM_ARCH & GLM_ARCH_AVX512_BIT
+
+// AVX-512: the whole matrix in one 512 bit register, one column per 128 bit lane.
+// The permutes go through the zero-masking forms with every lane set and the determinant is summed with permutes
+// rather than _mm512_mask_reduce_add_ps: GCC implements the unmasked permutes and the lane extracts of the reduction
+// with an undefined operand that trips -Wmaybe-uninitialized wherever these functions are inlined.
+
+GLM_FUNC_QUALIFIER void glm_mat4_mul_avx512(glm_vec4 const in1[4], glm_vec4 const in2[4], glm_vec4 out[4])
+{
+	__m512 const a = _mm512_loadu_ps(reinterpret_cast<float const*>(in1));
+	__m512 const b = _mm512_loadu_ps(reinterpret_cast<float const*>(in2));
+
+	// column K of in1 in every lane
+	__m512i const Column = _mm512_setr_epi32(0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3);
+	__m512 const a0 = _mm512_maskz_permutexvar_ps(0xFFFF, Column, a);
+	__m512 const a1 = _mm512_maskz_permutexvar_ps(0xFFFF, _mm512_add_epi32(Column, _mm512_set1_epi32(4)), a);
+	__m512 const a2 = _mm512_maskz_permutexvar_ps(0xFFFF, _mm512_add_epi32(Column, _mm512_set1_epi32(8)), a);
+	__m512 const a3 = _mm512_maskz_permutexvar_ps(0xFFFF, _mm512_add_epi32(Column, _mm512_set1_epi32(12)), a);
+
+	__m512 const m0 = _mm512_fmadd_ps(a1, _mm512_maskz_permute_ps(0xFFFF, b, _MM_SHUFFLE(1, 1, 1, 1)), _mm512_mul_ps(a0, _mm512_maskz_permute_ps(0xFFFF, b, _MM_SHUFFLE(0, 0, 0, 0))));
+	__m512 const m1 = _mm512_fmadd_ps(a3, _mm512_maskz_permute_ps(0xFFFF, b, _MM_SHUFFLE(3, 3, 3, 3)), _mm512_mul_ps(a2, _mm512_maskz_permute_ps(0xFFFF, b, _MM_SHUFFLE(2, 2, 2, 2))));
+
+	_mm512_storeu_ps(reinterpret_cast<float*>(out), _mm512_add_ps(m0, m1));
+}
+
+GLM_FUNC_QUALIFIER void glm_mat4_transpose_avx512(glm_vec4 const in[4], glm_vec4 out[4])
+{
+	__m512 const m = _mm512_loadu_ps(reinterpret_cast<float const*>(in));
+	__m512i const Rows = _mm512_setr_epi32(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+	_mm512_storeu_ps(reinterpret_cast<float*>(out), _mm512_maskz_permutexvar_ps(0xFFFF, Rows, m));
+}
+
+// Four SubFactors of glm_mat4_inverse, m[2][p] * m[3][q] - m[3][p] * m[2][q] and the same with columns 1 and 2 or 1
+// and 3, with (pK, qK) in lane K
+GLM_FUNC_QUALIFIER __m512 glm_mat4_inverse_factors_avx512(__m512 m, int p0, int q0, int p1, int q1, int p2, int q2, int p3, int q3)
+{
+	__m512 const Ap = _mm512_maskz_permutexvar_ps(0xFFFF, _mm512_setr_epi32(8 + p0, 8 + p0, 4 + p0, 4 + p0, 8 + p1, 8 + p1, 4 + p1, 4 + p1, 8 + p2, 8 + p2, 4 + p2, 4 + p2, 8 + p3, 8 + p3, 4 + p3, 4 + p3), m);
+	__m512 const Aq = _mm512_maskz_permutexvar_ps(0xFFFF, _mm512_setr_epi32(8 + q0, 8 + q0, 4 + q0, 4 + q0, 8 + q1, 8 + q1, 4 + q1, 4 + q1, 8 + q2, 8 + q2, 4 + q2, 4 + q2, 8 + q3, 8 + q3, 4 + q3, 4 + q3), m);
+	__m512 const Bp = _mm512_maskz_permutexvar_ps(0xFFFF, _mm512_setr_epi32(12 + p0, 12 + p0, 12 + p0, 8 + p0, 12 + p1, 12 + p1, 12 + p1, 8 + p1, 12 + p2, 12 + p2, 12 + p2, 8 + p2, 12 + p3, 12 + p3, 12 + p3, 8 + p3), m);
+	__m512 const Bq = _mm512_maskz_permutexvar_ps(0xFFFF, _mm512_setr_epi32(12 + q0, 12 + q0, 12 + q0, 8 + q0, 12 + q1, 12 + q1, 12 + q1, 8 + q1, 12 + q2, 12 + q2, 12 + q2, 8 + q2, 12 + q3, 12 + q3, 12 + q3, 8 + q3), m);
+	return _mm512_fmsub_ps(Ap, Bq, _mm512_mul_ps(Bp, Aq));
+}
+
+// The cofactor expansion of glm_mat4_inverse with Inv0 to Inv3 in one register
+GLM_FUNC_QUALIFIER void glm_mat4_inverse_avx512(glm_vec4 const in[4], glm_vec4 out[4])
+{
+	__m512 const m = _mm512_loadu_ps(reinterpret_cast<float const*>(in));
+
+	// the factors each column of the inverse needs: Inv0 = Vec1 * Fac0 - Vec2 * Fac1 + Vec3 * Fac2, and so on
+	__m512 const FacA = glm_mat4_inverse_factors_avx512(m, 2, 3, 2, 3, 1, 3, 1, 2);
+	__m512 const FacB = glm_mat4_inverse_factors_avx512(m, 1, 3, 0, 3, 0, 3, 0, 2);
+	__m512 const FacC = glm_mat4_inverse_factors_avx512(m, 1, 2, 0, 2, 0, 1, 0, 1);
+
+	// VecK = (m[1][K], m[0][K], m[0][K], m[0][K]), (Vec1, Vec0, Vec0, Vec0) then (Vec2, Vec2, Vec1, Vec1) then (Vec3, Vec3, Vec3, Vec2)
+	__m512 const VecA = _mm512_maskz_permutexvar_ps(0xFFFF, _mm512_setr_epi32(5, 1, 1, 1, 4, 0, 0, 0, 4, 0, 0, 0, 4, 0, 0, 0), m);
+	__m512 const VecB = _mm512_maskz_permutexvar_ps(0xFFFF, _mm512_setr_epi32(6, 2, 2, 2, 6, 2, 2, 2, 5, 1, 1, 1, 5, 1, 1, 1), m);
+	__m512 const VecC = _mm512_maskz_permutexvar_ps(0xFFFF, _mm512_setr_epi32(7, 3, 3, 3, 7, 3, 3, 3, 7, 3, 3, 3, 6, 2, 2, 2), m);
+
+	// SignB, SignA, SignB, SignA applied by flipping sign bits
+	__m512i const Sign = _mm512_castps_si512(_mm512_setr_ps(
+		0.0f, -0.0f, 0.0f, -0.0f, -0.0f, 0.0f, -0.0f, 0.0f,
+		0.0f, -0.0f, 0.0f, -0.0f, -0.0f, 0.0f, -0.0f, 0.0f));
+	__m512 const Cof = _mm512_fmadd_ps(VecC, FacC, _mm512_fnmadd_ps(VecB, FacB, _mm512_mul_ps(VecA, FacA)));
+	__m512 const Inv = _mm512_castsi512_ps(_mm512_xor_si512(Sign, _mm512_castps_si512(Cof)));
+
+	// Determinant = m[0][0] * Inv0[0] + m[0][1] * Inv1[0] + m[0][2] * Inv2[0] + m[0][3] * Inv3[0]
+	__m512 const Col0 = _mm512_mul_ps(Inv, _mm512_maskz_permutexvar_ps(0xFFFF, _mm512_setr_epi32(0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3), m));
+	__m512 const Sum8 = _mm512_add_ps(Col0, _mm512_maskz_permutexvar_ps(0xFFFF, _mm512_setr_epi32(8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7), Col0));
+	__m512 const Sum4 = _mm512_add_ps(Sum8, _mm512_maskz_permutexvar_ps(0xFFFF, _mm512_setr_epi32(4, 5, 6, 7, 0, 1, 2, 3, 12, 13, 14, 15, 8, 9, 10, 11), Sum8));
+	float const Det = _mm512_cvtss_f32(Sum4);
+
+	_mm512_storeu_ps(reinterpret_cast<float*>(out), _mm512_mul_ps(Inv, _mm512_set1_ps(1.0f / Det)));
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX512_BIT
+
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+
+// Double precision with AVX: one dmat4 column per 256 bit register, the FMA forms with AVX2.
+
+GLM_FUNC_QUALIFIER void glm_dmat4_mul(glm_dvec4 const in1[4], glm_dvec4 const in2[4], glm_dvec4 out[4])
+{
+	glm_dvec4 const a0 = in1[0];
+	glm_dvec4 const a1 = in1[1];
+	glm_dvec4 const a2 = in1[2];
+	glm_dvec4 const a3 = in1[3];
+
+	// in2 is read one column ahead of the store, so out may be in2
+	double const* b = reinterpret_cast<double const*>(in2);
+	for(int i = 0; i < 4; ++i, b += 4)
+	{
+		glm_dvec4 const m01 = glm_dvec4_fma(a1, _mm256_broadcast_sd(b + 1), _mm256_mul_pd(a0, _mm256_broadcast_sd(b + 0)));
+		glm_dvec4 const m23 = glm_dvec4_fma(a3, _mm256_broadcast_sd(b + 3), _mm256_mul_pd(a2, _mm256_broadcast_sd(b + 2)));
+		out[i] = _mm256_add_pd(m01, m23);
+	}
+}
+
+GLM_FUNC_QUALIFIER void glm_dmat4_transpose(glm_dvec4 const in[4], glm_dvec4 out[4])
+{
+	// x0 x1 z0 z1, y0 y1 w0 w1, x2 x3 z2 z3, y2 y3 w2 w3
+	glm_dvec4 const t0 = _mm256_unpacklo_pd(in[0], in[1]);
+	glm_dvec4 const t1 = _mm256_unpackhi_pd(in[0], in[1]);
+	glm_dvec4 const t2 = _mm256_unpacklo_pd(in[2], in[3]);
+	glm_dvec4 const t3 = _mm256_unpackhi_pd(in[2], in[3]);
+
+	out[0] = _mm256_permute2f128_pd(t0, t2, 0x20);
+	out[1] = _mm256_permute2f128_pd(t1, t3, 0x20);
+	out[2] = _mm256_permute2f128_pd(t0, t2, 0x31);
+	out[3] = _mm256_permute2f128_pd(t1, t3, 0x31);
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
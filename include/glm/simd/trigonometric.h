@@ -3,7 +3,191 @@
 
 #pragma once
 
+#include "common.h"
+#include <cmath>
+#include <limits>
+
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
-#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+// Cephes single precision polynomials. Max error in ulp against the exact result, over every float for the one
+// argument functions and over random inputs for atan2 (see --transcendental-bench):
+// sin, cos: 1.6, atan: 2.9, atan2: 3.2
+
+// sin and cos of x = q pi/2 + r from those of r: odd quadrants swap them, sin is negated in quadrants 2 and 3, cos in 1 and 2
+GLM_FUNC_QUALIFIER void glm_vec4_sincos_quadrant(glm_ivec4 q, glm_vec4 SinR, glm_vec4 CosR, glm_vec4* s, glm_vec4* c)
+{
+	glm_vec4 const Swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(q, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+	glm_vec4 const SinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(q, _mm_set1_epi32(2)), 30));
+	glm_vec4 const CosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(q, _mm_set1_epi32(1)), _mm_set1_epi32(2)), 30));
+	*s = _mm_xor_ps(_mm_or_ps(_mm_and_ps(Swap, CosR), _mm_andnot_ps(Swap, SinR)), SinSign);
+	*c = _mm_xor_ps(_mm_or_ps(_mm_and_ps(Swap, SinR), _mm_andnot_ps(Swap, CosR)), CosSign);
+}
+
+GLM_FUNC_QUALIFIER void glm_vec4_sincos(glm_vec4 x, glm_vec4* s, glm_vec4* c)
+{
+	// x = q pi/2 + r with |r| <= pi/4. The reduction runs in double precision with pi/2 split in a 33 bit head,
+	// exact times any q below 2^20, and a tail, so that r keeps its accuracy next to the zeros of sin and cos
+	glm_f64vec2 const InvPio2 = _mm_set1_pd(0.63661977236758134308);
+	glm_f64vec2 const Pio2Head = _mm_set1_pd(1.57079632673412561417);
+	glm_f64vec2 const Pio2Tail = _mm_set1_pd(6.07710050650619224932e-11);
+	glm_f64vec2 const Low = _mm_cvtps_pd(x);
+	glm_f64vec2 const High = _mm_cvtps_pd(_mm_movehl_ps(x, x));
+	glm_ivec4 const QuadrantLow = _mm_cvtpd_epi32(_mm_mul_pd(Low, InvPio2));
+	glm_ivec4 const QuadrantHigh = _mm_cvtpd_epi32(_mm_mul_pd(High, InvPio2));
+	glm_f64vec2 const Ql = _mm_cvtepi32_pd(QuadrantLow);
+	glm_f64vec2 const Qh = _mm_cvtepi32_pd(QuadrantHigh);
+	glm_f64vec2 const Rl = _mm_sub_pd(_mm_sub_pd(Low, _mm_mul_pd(Ql, Pio2Head)), _mm_mul_pd(Ql, Pio2Tail));
+	glm_f64vec2 const Rh = _mm_sub_pd(_mm_sub_pd(High, _mm_mul_pd(Qh, Pio2Head)), _mm_mul_pd(Qh, Pio2Tail));
+	glm_vec4 const r = _mm_movelh_ps(_mm_cvtpd_ps(Rl), _mm_cvtpd_ps(Rh));
+	glm_ivec4 const q = _mm_unpacklo_epi64(QuadrantLow, QuadrantHigh);
+	glm_vec4 const z = _mm_mul_ps(r, r);
+
+	glm_vec4 SinR = glm_vec4_fma(_mm_set1_ps(-1.9515295891e-4f), z, _mm_set1_ps(8.3321608736e-3f));
+	SinR = glm_vec4_fma(SinR, z, _mm_set1_ps(-1.6666654611e-1f));
+	SinR = glm_vec4_fma(_mm_mul_ps(SinR, z), r, r);
+
+	glm_vec4 CosR = glm_vec4_fma(_mm_set1_ps(2.443315711809948e-5f), z, _mm_set1_ps(-1.388731625493765e-3f));
+	CosR = glm_vec4_fma(CosR, z, _mm_set1_ps(4.166664568298827e-2f));
+	CosR = _mm_mul_ps(_mm_mul_ps(CosR, z), z);
+	CosR = _mm_add_ps(glm_vec4_fma(_mm_set1_ps(-0.5f), z, CosR), _mm_set1_ps(1.0f));
+
+	glm_vec4 SinX, CosX;
+	glm_vec4_sincos_quadrant(q, SinR, CosR, &SinX, &CosX);
+	// The reduction turns -0 into +0, sin keeps the sign of a zero
+	glm_vec4 const Zero = _mm_cmpeq_ps(x, _mm_setzero_ps());
+	SinX = _mm_or_ps(_mm_and_ps(Zero, x), _mm_andnot_ps(Zero, SinX));
+
+	// Past 2^20 pi/2 the head product is no longer exact, leave those lanes (and inf / NaN) to libm
+	glm_vec4 const Limit = _mm_set1_ps(1647099.0f);
+	if(_mm_movemask_ps(_mm_cmpnle_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), x), Limit)))
+	{
+		float In[4];
+		float OutSin[4];
+		float OutCos[4];
+		_mm_storeu_ps(In, x);
+		_mm_storeu_ps(OutSin, SinX);
+		_mm_storeu_ps(OutCos, CosX);
+		for(int i = 0; i < 4; ++i)
+		{
+			if(!(std::fabs(In[i]) <= 1647099.0f))
+			{
+				OutSin[i] = std::sin(In[i]);
+				OutCos[i] = std::cos(In[i]);
+			}
+		}
+		SinX = _mm_loadu_ps(OutSin);
+		CosX = _mm_loadu_ps(OutCos);
+	}
+
+	*s = SinX;
+	*c = CosX;
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sin(glm_vec4 x)
+{
+	glm_vec4 s, c;
+	glm_vec4_sincos(x, &s, &c);
+	return s;
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_cos(glm_vec4 x)
+{
+	glm_vec4 s, c;
+	glm_vec4_sincos(x, &s, &c);
+	return c;
+}
+
+// Lower precision sin and cos for gtx/fast_trigonometry, minimax polynomials over [-pi/4, pi/4] after a single
+// precision reduction that holds for |x| <= 1e5. Max absolute error: 1.9e-4 for lowp, 1.9e-6 for mediump
 
+// x = q pi/2 + r with |r| <= pi/4, pi/2 split in three floats, the first exact times any q below 2^16
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sincos_reduce_lowp(glm_vec4 x, glm_ivec4* q)
+{
+	*q = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(0.636619772367581343f)));
+	glm_vec4 const y = _mm_cvtepi32_ps(*q);
+	glm_vec4 r = glm_vec4_fma(y, _mm_set1_ps(-1.5703125f), x);
+	r = glm_vec4_fma(y, _mm_set1_ps(-4.837512969970703125e-4f), r);
+	r = glm_vec4_fma(y, _mm_set1_ps(-7.54978995489188216e-8f), r);
+	// x - x is NaN for inf and NaN, whose lanes the polynomials would otherwise turn into +-inf
+	glm_vec4 const Diff = _mm_sub_ps(x, x);
+	return _mm_or_ps(r, _mm_cmpunord_ps(Diff, Diff));
+}
+
+GLM_FUNC_QUALIFIER void glm_vec4_sincos_lowp(glm_vec4 x, glm_vec4* s, glm_vec4* c)
+{
+	glm_ivec4 q;
+	glm_vec4 const r = glm_vec4_sincos_reduce_lowp(x, &q);
+	glm_vec4 const z = _mm_mul_ps(r, r);
+	glm_vec4 const SinR = _mm_mul_ps(glm_vec4_fma(_mm_set1_ps(-0.16034401672f), z, _mm_set1_ps(0.99903142291f)), r);
+	glm_vec4 CosR = glm_vec4_fma(_mm_set1_ps(0.040398535969f), z, _mm_set1_ps(-0.49970814036f));
+	CosR = glm_vec4_fma(CosR, z, _mm_set1_ps(0.99999003496f));
+	glm_vec4_sincos_quadrant(q, SinR, CosR, s, c);
+}
+
+GLM_FUNC_QUALIFIER void glm_vec4_sincos_mediump(glm_vec4 x, glm_vec4* s, glm_vec4* c)
+{
+	glm_ivec4 q;
+	glm_vec4 const r = glm_vec4_sincos_reduce_lowp(x, &q);
+	glm_vec4 const z = _mm_mul_ps(r, r);
+	glm_vec4 SinR = glm_vec4_fma(_mm_set1_ps(0.0081365119623f), z, _mm_set1_ps(-0.16661749354f));
+	SinR = _mm_mul_ps(glm_vec4_fma(SinR, z, _mm_set1_ps(0.99999838540f)), r);
+	glm_vec4 CosR = glm_vec4_fma(_mm_set1_ps(-0.0013585908511f), z, _mm_set1_ps(0.041655026884f));
+	CosR = glm_vec4_fma(CosR, z, _mm_set1_ps(-0.49999856696f));
+	CosR = glm_vec4_fma(CosR, z, _mm_set1_ps(0.99999997242f));
+	glm_vec4_sincos_quadrant(q, SinR, CosR, s, c);
+}
+
+// atan of x in [0, +inf], NaN propagates
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_atan_positive(glm_vec4 x)
+{
+	// x > tan(3pi/8): atan(x) = pi/2 + atan(-1/x), x > tan(pi/8): atan(x) = pi/4 + atan((x-1)/(x+1))
+	glm_vec4 const One = _mm_set1_ps(1.0f);
+	glm_vec4 const Big = _mm_cmpgt_ps(x, _mm_set1_ps(2.414213562373095f));
+	glm_vec4 const Mid = _mm_andnot_ps(Big, _mm_cmpgt_ps(x, _mm_set1_ps(0.4142135623730950f)));
+
+	glm_vec4 const Num = _mm_or_ps(_mm_and_ps(Big, _mm_set1_ps(-1.0f)), _mm_andnot_ps(Big, _mm_or_ps(_mm_and_ps(Mid, _mm_sub_ps(x, One)), _mm_andnot_ps(Mid, x))));
+	glm_vec4 const Den = _mm_or_ps(_mm_and_ps(Big, x), _mm_andnot_ps(Big, _mm_or_ps(_mm_and_ps(Mid, _mm_add_ps(x, One)), _mm_andnot_ps(Mid, One))));
+	glm_vec4 const r = _mm_div_ps(Num, Den);
+	glm_vec4 const Offset = _mm_or_ps(_mm_and_ps(Big, _mm_set1_ps(1.57079632679489661923f)), _mm_and_ps(Mid, _mm_set1_ps(0.78539816339744830962f)));
+
+	glm_vec4 const z = _mm_mul_ps(r, r);
+	glm_vec4 p = glm_vec4_fma(_mm_set1_ps(8.05374449538e-2f), z, _mm_set1_ps(-1.38776856032e-1f));
+	p = glm_vec4_fma(p, z, _mm_set1_ps(1.99777106478e-1f));
+	p = glm_vec4_fma(p, z, _mm_set1_ps(-3.33329491539e-1f));
+	p = glm_vec4_fma(_mm_mul_ps(p, z), r, r);
+	return _mm_add_ps(Offset, p);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_atan(glm_vec4 x)
+{
+	glm_vec4 const SignMask = _mm_set1_ps(-0.0f);
+	glm_vec4 const SignX = _mm_and_ps(x, SignMask);
+	return _mm_xor_ps(glm_vec4_atan_positive(_mm_andnot_ps(SignMask, x)), SignX);
+}
+
+// Same special cases as std::atan2: signed zeros pick the half plane, both infinite give odd multiples of pi/4
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_atan2(glm_vec4 y, glm_vec4 x)
+{
+	glm_vec4 const SignMask = _mm_set1_ps(-0.0f);
+	glm_vec4 const Ax = _mm_andnot_ps(SignMask, x);
+	glm_vec4 const Ay = _mm_andnot_ps(SignMask, y);
+
+	// atan of the smaller over the larger magnitude keeps the argument in [0, 1]
+	glm_vec4 const Swap = _mm_cmpgt_ps(Ay, Ax);
+	glm_vec4 const Num = _mm_min_ps(Ax, Ay);
+	glm_vec4 const Den = _mm_max_ps(Ax, Ay);
+	glm_vec4 a = glm_vec4_atan_positive(_mm_div_ps(Num, Den));
+	a = _mm_andnot_ps(_mm_cmpeq_ps(Den, _mm_setzero_ps()), a);
+	glm_vec4 const BothInf = _mm_cmpeq_ps(Num, _mm_set1_ps(std::numeric_limits<float>::infinity()));
+	a = _mm_or_ps(_mm_and_ps(BothInf, _mm_set1_ps(0.78539816339744830962f)), _mm_andnot_ps(BothInf, a));
+
+	a = _mm_or_ps(_mm_and_ps(Swap, _mm_sub_ps(_mm_set1_ps(1.57079632679489661923f), a)), _mm_andnot_ps(Swap, a));
+	glm_vec4 const NegX = _mm_castsi128_ps(_mm_srai_epi32(_mm_castps_si128(x), 31));
+	a = _mm_or_ps(_mm_and_ps(NegX, _mm_sub_ps(_mm_set1_ps(3.14159265358979323846f), a)), _mm_andnot_ps(NegX, a));
+	a = _mm_xor_ps(a, _mm_and_ps(y, SignMask));
+
+	glm_vec4 const Nan = _mm_cmpunord_ps(x, y);
+	return _mm_or_ps(_mm_and_ps(Nan, _mm_add_ps(x, y)), _mm_andnot_ps(Nan, a));
+}
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -0,0 +1,255 @@
+#include "animation.h"
+
+#include <glm/gtx/quaternion_array.hpp>
+#include <glm/gtx/spline_array.hpp>
+
+#include <algorithm>
+
+namespace
+{
+    glm::quat decodeRotation(const glm::i16vec4 &key)
+    {
+        glm::vec4 q = glm::vec4(key) * (1.0f / 32767.0f);
+        return glm::quat(q.w, q.x, q.y, q.z);
+    }
+
+    glm::vec3 decodeCurve(const glm::vec3 &origin, const glm::vec3 &extent, const glm::u16vec3 &key)
+    {
+        return origin + extent * (glm::vec3(key) * (1.0f / 65535.0f));
+    }
+}
+
+AnimationClip::AnimationClip(std::size_t jointCount)
+    : rotationTracks(jointCount, Track{0, 1, glm::easing_linear}),
+      rotationTimes(1, 0.0f), rotationKeys(1, glm::i16vec4(0, 0, 0, 32767)),
+      curveTimes(1, 0.0f), curveKeys(1, glm::u16vec3(0))
+{
+    CurveTrack translation;
+    translation.firstKey = 0;
+    translation.keyCount = 1;
+    translation.easing = glm::easing_linear;
+    translation.origin = glm::vec3(0.0f);
+    translation.extent = glm::vec3(0.0f);
+    translation.interpolation = CurveInterpolation::Linear;
+    CurveTrack scale = translation;
+    scale.origin = glm::vec3(1.0f);
+    curveTracks.resize(jointCount, translation);
+    curveTracks.resize(2 * jointCount, scale);
+}
+
+void AnimationClip::setRotationKeys(std::size_t joint, const float *times, const glm::quat *rotations, std::size_t count,
+                                    glm::easing_function easing)
+{
+    Track &track = rotationTracks[joint];
+    track.firstKey = static_cast<std::uint32_t>(rotationKeys.size());
+    track.keyCount = static_cast<std::uint32_t>(count);
+    track.easing = easing;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        glm::quat q = glm::normalize(rotations[i]);
+        rotationTimes.push_back(times[i]);
+        rotationKeys.push_back(glm::i16vec4(glm::round(glm::vec4(q.x, q.y, q.z, q.w) * 32767.0f)));
+    }
+    length = std::max(length, times[count - 1]);
+}
+
+void AnimationClip::setTranslationKeys(std::size_t joint, const float *times, const glm::vec3 *translations, std::size_t count,
+                                       CurveInterpolation interpolation, glm::easing_function easing)
+{
+    setCurveKeys(curveTracks[joint], times, translations, count, interpolation, easing);
+}
+
+void AnimationClip::setScaleKeys(std::size_t joint, const float *times, const glm::vec3 *scales, std::size_t count,
+                                 CurveInterpolation interpolation, glm::easing_function easing)
+{
+    setCurveKeys(curveTracks[jointCount() + joint], times, scales, count, interpolation, easing);
+}
+
+void AnimationClip::setCurveKeys(CurveTrack &track, const float *times, const glm::vec3 *values, std::size_t count,
+                                 CurveInterpolation interpolation, glm::easing_function easing)
+{
+    glm::vec3 lower = values[0], upper = values[0];
+    for (std::size_t i = 1; i < count; i++)
+    {
+        lower = glm::min(lower, values[i]);
+        upper = glm::max(upper, values[i]);
+    }
+
+    track.firstKey = static_cast<std::uint32_t>(curveKeys.size());
+    track.keyCount = static_cast<std::uint32_t>(count);
+    track.easing = easing;
+    track.origin = lower;
+    track.extent = upper - lower;
+    track.interpolation = interpolation;
+
+    // a component that never changes keeps an extent of 0 and encodes as 0
+    glm::vec3 scale = glm::vec3(65535.0f) / glm::max(track.extent, glm::vec3(1e-30f));
+    for (std::size_t i = 0; i < count; i++)
+    {
+        curveTimes.push_back(times[i]);
+        curveKeys.push_back(glm::u16vec3(glm::round(glm::min((values[i] - lower) * scale, glm::vec3(65535.0f)))));
+    }
+    length = std::max(length, times[count - 1]);
+}
+
+std::size_t AnimationClip::keyBytes() const
+{
+    return (rotationTimes.size() + curveTimes.size()) * sizeof(float) +
+           rotationKeys.size() * sizeof(glm::i16vec4) + curveKeys.size() * sizeof(glm::u16vec3);
+}
+
+std::size_t AnimationClip::rawKeyBytes() const
+{
+    return (rotationTimes.size() + curveTimes.size()) * sizeof(float) +
+           rotationKeys.size() * sizeof(glm::quat) + curveKeys.size() * sizeof(glm::vec3);
+}
+
+void Pose::resize(std::size_t jointCount)
+{
+    rotations.resize(jointCount, glm::quat(1.0f, 0.0f, 0.0f, 0.0f));
+    translations.resize(jointCount, glm::vec3(0.0f));
+    scales.resize(jointCount, glm::vec3(1.0f));
+}
+
+AnimationSampler::AnimationSampler(const AnimationClip &clip)
+    : clip(clip), rotationCursors(clip.rotationTracks.size(), 0), curveCursors(clip.curveTracks.size(), 0)
+{
+    // runs of the same interpolation and easing turn into one kernel call each
+    auto groupBy = [](std::vector<std::uint32_t> &order, std::size_t count, std::vector<Group> &groups, auto &&key)
+    {
+        order.resize(count);
+        for (std::size_t i = 0; i < count; i++)
+            order[i] = static_cast<std::uint32_t>(i);
+        std::stable_sort(order.begin(), order.end(), [&](std::uint32_t a, std::uint32_t b) { return key(a) < key(b); });
+        for (std::size_t i = 0; i < count; i++)
+            if (groups.empty() || key(order[i]) != key(order[groups.back().begin]))
+                groups.push_back(Group{static_cast<std::uint32_t>(i), static_cast<std::uint32_t>(i + 1), glm::easing_linear});
+            else
+                groups.back().end = static_cast<std::uint32_t>(i + 1);
+    };
+    groupBy(rotationOrder, clip.rotationTracks.size(), rotationGroups,
+            [&](std::uint32_t t) { return int(clip.rotationTracks[t].easing); });
+    groupBy(curveOrder, clip.curveTracks.size(), curveGroups,
+            [&](std::uint32_t t) { return int(clip.curveTracks[t].interpolation) * 256 + int(clip.curveTracks[t].easing); });
+    for (Group &group : rotationGroups)
+        group.easing = clip.rotationTracks[rotationOrder[group.begin]].easing;
+    for (Group &group : curveGroups)
+        group.easing = clip.curveTracks[curveOrder[group.begin]].easing;
+    for (std::uint32_t t : curveOrder)
+        linearCurves += clip.curveTracks[t].interpolation == CurveInterpolation::Linear;
+}
+
+void AnimationSampler::locate(const AnimationClip::Track &track, const float *times, std::uint32_t &cursor, float time,
+                              std::uint32_t &key, float &fraction) const
+{
+    // the key at or before time. time moves forward by less than a key per frame in the common case, so the first
+    // step is taken without a branch and anything further searches the rest of the track
+    std::uint32_t last = track.keyCount - 1;
+    std::uint32_t k = cursor;
+    if (time < times[k])
+    {
+        k = static_cast<std::uint32_t>(std::upper_bound(times, times + k, time) - times);
+        k = k > 0 ? k - 1 : 0;
+    }
+    else
+    {
+        k += (k < last) & (times[std::min(k + 1, last)] <= time);
+        if (k < last && times[k + 1] <= time)
+            k = static_cast<std::uint32_t>(std::upper_bound(times + k + 1, times + last + 1, time) - times - 1);
+    }
+    cursor = k;
+    key = k;
+
+    float span = times[std::min(k + 1, last)] - times[k];
+    fraction = span > 0.0f ? glm::clamp((time - times[k]) / span, 0.0f, 1.0f) : 0.0f;
+}
+
+void AnimationSampler::ease(const std::vector<Group> &groups, float *fractions) const
+{
+    for (const Group &group : groups)
+        if (group.easing != glm::easing_linear)
+            glm::easeArray(group.easing, fractions + group.begin, fractions + group.begin, group.end - group.begin);
+}
+
+void AnimationSampler::sample(float time, Pose &pose, FrameArena &scratch)
+{
+    std::size_t jointCount = clip.jointCount();
+    if (pose.size() != jointCount)
+        pose.resize(jointCount);
+    FrameArena::Marker marker = scratch.mark();
+
+    // rotations: the two keys around time, eased fractions, nlerp
+    std::size_t rotationCount = rotationOrder.size();
+    float *fractions = scratch.allocateArray<float>(rotationCount);
+    glm::quat *from = scratch.allocateArray<glm::quat>(rotationCount);
+    glm::quat *to = scratch.allocateArray<glm::quat>(rotationCount);
+    for (std::size_t i = 0; i < rotationCount; i++)
+    {
+        std::uint32_t t = rotationOrder[i];
+        const AnimationClip::Track &track = clip.rotationTracks[t];
+        std::uint32_t key;
+        locate(track, &clip.rotationTimes[track.firstKey], rotationCursors[t], time, key, fractions[i]);
+        const glm::i16vec4 *keys = &clip.rotationKeys[track.firstKey];
+        from[i] = decodeRotation(keys[key]);
+        to[i] = decodeRotation(keys[std::min(key + 1, track.keyCount - 1)]);
+    }
+    ease(rotationGroups, fractions);
+    glm::nlerpArray(from, to, fractions, from, rotationCount);
+    for (std::size_t i = 0; i < rotationCount; i++)
+        pose.rotations[rotationOrder[i]] = from[i];
+    scratch.rewind(marker);
+
+    // translations and scales: the linear tracks need points 1 and 2, Catmull-Rom the keys on either side as well,
+    // repeating the first / last key past the ends of the track
+    std::size_t curveCount = curveOrder.size();
+    fractions = scratch.allocateArray<float>(curveCount);
+    glm::vec3 *points[4];
+    for (glm::vec3 *&p : points)
+        p = scratch.allocateArray<glm::vec3>(curveCount);
+    for (std::size_t i = 0; i < curveCount; i++)
+    {
+        std::uint32_t t = curveOrder[i];
+        const AnimationClip::CurveTrack &track = clip.curveTracks[t];
+        std::uint32_t key;
+        locate(track, &clip.curveTimes[track.firstKey], curveCursors[t], time, key, fractions[i]);
+        const glm::u16vec3 *keys = &clip.curveKeys[track.firstKey];
+        std::uint32_t last = track.keyCount - 1;
+        points[1][i] = decodeCurve(track.origin, track.extent, keys[key]);
+        points[2][i] = decodeCurve(track.origin, track.extent, keys[std::min(key + 1, last)]);
+        if (i >= linearCurves)
+        {
+            points[0][i] = decodeCurve(track.origin, track.extent, keys[key > 0 ? key - 1 : 0]);
+            points[3][i] = decodeCurve(track.origin, track.extent, keys[std::min(key + 2, last)]);
+        }
+    }
+    ease(curveGroups, fractions);
+    std::size_t smooth = curveCount - linearCurves;
+    glm::mixArray(points[1], points[2], fractions, points[0], linearCurves);
+    glm::catmullRomArray(points[0] + linearCurves, points[1] + linearCurves, points[2] + linearCurves,
+                         points[3] + linearCurves, fractions + linearCurves, points[0] + linearCurves, smooth);
+    for (std::size_t i = 0; i < curveCount; i++)
+    {
+        std::uint32_t t = curveOrder[i];
+        if (t < jointCount)
+            pose.translations[t] = points[0][i];
+        else
+            pose.scales[t - jointCount] = points[0][i];
+    }
+    scratch.rewind(marker);
+}
+
+void blendPoses(const Pose &a, const Pose &b, float weight, Pose &out)
+{
+    out.resize(a.size());
+    glm::nlerpArray(a.rotations.data(), b.rotations.data(), weight, out.rotations.data(), a.size());
+    glm::mixArray(a.translations.data(), b.translations.data(), weight, out.translations.data(), a.size());
+    glm::mixArray(a.scales.data(), b.scales.data(), weight, out.scales.data(), a.size());
+}
+
+void blendPoses(const Pose &a, const Pose &b, const float *weights, Pose &out)
+{
+    out.resize(a.size());
+    glm::nlerpArray(a.rotations.data(), b.rotations.data(), weights, out.rotations.data(), a.size());
+    glm::mixArray(a.translations.data(), b.translations.data(), weights, out.translations.data(), a.size());
+    glm::mixArray(a.scales.data(), b.scales.data(), weights, out.scales.data(), a.size());
+}
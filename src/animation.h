@@ -0,0 +1,145 @@
+#ifndef ANIMATION_H
+#define ANIMATION_H
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#define GLM_ENABLE_EXPERIMENTAL
+#endif
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtx/easing_array.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "frame_arena.h"
+
+// keyframe animation: a clip holds a rotation, a translation and a scale track per joint, a sampler evaluates all of
+// them at one time into a pose.
+//
+// keys are stored compressed, rotations as four snorm16 components (8 bytes instead of 16) and translations / scales
+// as three unorm16 components within the bounds of their track (6 bytes instead of 12). the sampler keeps the key
+// it found last for every track, so sampling a clip forward frame by frame finds each key in a step or two, then
+// evaluates the tracks in groups of the same interpolation and easing with the batched glm kernels
+// (gtx/easing_array, gtx/spline_array, gtx/quaternion_array).
+
+enum class CurveInterpolation
+{
+    Linear,         // straight between two keys
+    CatmullRom      // through the keys with a smooth tangent, from the keys on either side
+};
+
+class AnimationClip
+{
+public:
+    // every track starts out as a single key at the bind pose: no rotation, no translation, scale 1
+    explicit AnimationClip(std::size_t jointCount);
+
+    std::size_t jointCount() const { return rotationTracks.size(); }
+
+    // the time of the last key over all tracks
+    float duration() const { return length; }
+
+    // times are increasing and count is at least 1. easing reshapes the fraction between two keys before the keys
+    // are interpolated. each call replaces the whole track; the keys it had before stay in the clip, unused
+    void setRotationKeys(std::size_t joint, const float *times, const glm::quat *rotations, std::size_t count,
+                         glm::easing_function easing = glm::easing_linear);
+    void setTranslationKeys(std::size_t joint, const float *times, const glm::vec3 *translations, std::size_t count,
+                            CurveInterpolation interpolation = CurveInterpolation::Linear,
+                            glm::easing_function easing = glm::easing_linear);
+    void setScaleKeys(std::size_t joint, const float *times, const glm::vec3 *scales, std::size_t count,
+                      CurveInterpolation interpolation = CurveInterpolation::Linear,
+                      glm::easing_function easing = glm::easing_linear);
+
+    // bytes of key times and values, as stored and as they would be with float keys
+    std::size_t keyBytes() const;
+    std::size_t rawKeyBytes() const;
+
+private:
+    friend class AnimationSampler;
+
+    struct Track
+    {
+        std::uint32_t firstKey;
+        std::uint32_t keyCount;
+        glm::easing_function easing;
+    };
+
+    // key values decode to origin + extent * key / 65535
+    struct CurveTrack : Track
+    {
+        glm::vec3 origin;
+        glm::vec3 extent;
+        CurveInterpolation interpolation;
+    };
+
+    void setCurveKeys(CurveTrack &track, const float *times, const glm::vec3 *values, std::size_t count,
+                      CurveInterpolation interpolation, glm::easing_function easing);
+
+    std::vector<Track> rotationTracks;
+    std::vector<CurveTrack> curveTracks;        // translations of every joint, then scales of every joint
+
+    // the keys of every track, one after the other; the first key of each pool is the shared bind pose key
+    std::vector<float> rotationTimes;
+    std::vector<glm::i16vec4> rotationKeys;     // x, y, z, w
+    std::vector<float> curveTimes;
+    std::vector<glm::u16vec3> curveKeys;
+
+    float length = 0.0f;
+};
+
+struct Pose
+{
+    std::vector<glm::quat> rotations;
+    std::vector<glm::vec3> translations;
+    std::vector<glm::vec3> scales;
+
+    void resize(std::size_t jointCount);
+    std::size_t size() const { return rotations.size(); }
+};
+
+// samples one clip for one animated instance; the clip must outlive the sampler and not gain keys while it is used.
+// sampling is fastest when time moves forward by less than a key per call, jumping anywhere costs a binary search
+// per track. the sampler itself only holds the key cursors, a few bytes per track, so thousands of instances stay
+// in cache; the working arrays of a call come from a frame arena. different samplers can run on different workers
+class AnimationSampler
+{
+public:
+    explicit AnimationSampler(const AnimationClip &clip);
+
+    // times outside [0, duration()] hold the first or last key; wrap the time first for a looping clip.
+    // scratch is rewound to where it was before the call, on the job system pass the arena of the current worker
+    void sample(float time, Pose &pose, FrameArena &scratch);
+
+private:
+    // a run of tracks with the same interpolation and easing, in the order the sampler evaluates them
+    struct Group
+    {
+        std::uint32_t begin;
+        std::uint32_t end;
+        glm::easing_function easing;
+    };
+
+    void locate(const AnimationClip::Track &track, const float *times, std::uint32_t &cursor, float time,
+                std::uint32_t &key, float &fraction) const;
+    void ease(const std::vector<Group> &groups, float *fractions) const;
+
+    const AnimationClip &clip;
+
+    // tracks sorted by interpolation, then easing; the cursors hold each track's last key, by track index
+    std::vector<std::uint32_t> rotationOrder;
+    std::vector<std::uint32_t> curveOrder;
+    std::vector<Group> rotationGroups;
+    std::vector<Group> curveGroups;
+    std::size_t linearCurves = 0;   // curveOrder starts with the linear tracks
+    std::vector<std::uint32_t> rotationCursors;
+    std::vector<std::uint32_t> curveCursors;
+};
+
+// out = a blended towards b by weight, rotations by nlerp and translations / scales linearly. out may be a or b
+void blendPoses(const Pose &a, const Pose &b, float weight, Pose &out);
+
+// with a weight per joint, to blend part of the skeleton (the upper body of a run towards a wave, say)
+void blendPoses(const Pose &a, const Pose &b, const float *weights, Pose &out);
+
+#endif
@@ -0,0 +1,118 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+
+// timing shared by the --*-bench modes. a result line reads "name: value unit (checksum sum)", the checksum adds up
+// what the kernel wrote so the work is not optimized away and runs of the same function can be compared.
+
+// average wall time of one call of run, in seconds, over repeats calls
+template <class Run>
+double benchSeconds(int repeats, Run &&run)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; r++)
+        run();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / repeats;
+}
+
+// value(0) + value(step) + value(2 * step) ... for the indices below count
+template <class Value>
+double benchChecksum(std::size_t count, Value &&value, std::size_t step = 1)
+{
+    double sum = 0.0;
+    for (std::size_t i = 0; i < count; i += step)
+        sum += value(i);
+    return sum;
+}
+
+inline void benchReport(const char *name, double value, const char *unit, double checksum)
+{
+    std::cout << name << ": " << value << " " << unit << " (checksum " << checksum << ")" << std::endl;
+}
+
+inline void benchReport(const char *name, double value, const char *unit)
+{
+    std::cout << name << ": " << value << " " << unit << std::endl;
+}
+
+// nanoseconds per item of kernels over count items, each timed over repeats passes. run() takes a kernel that does
+// the whole pass, each() one that does item i; checksum(i) is summed every checksumStep items after the last pass
+class BenchLoop
+{
+public:
+    BenchLoop(std::size_t count, int repeats, const char *unit, std::size_t checksumStep = 1)
+        : count(count), repeats(repeats), unit(unit), checksumStep(checksumStep)
+    {
+    }
+
+    template <class Kernel, class Checksum>
+    void run(const char *name, Kernel &&kernel, Checksum &&checksum) const
+    {
+        double ns = benchSeconds(repeats, kernel) * 1e9 / double(count);
+        benchReport(name, ns, unit, benchChecksum(count, checksum, checksumStep));
+    }
+
+    template <class Kernel, class Checksum>
+    void each(const char *name, Kernel &&kernel, Checksum &&checksum) const
+    {
+        run(name, [&]() { for (std::size_t i = 0; i < count; i++) kernel(i); }, checksum);
+    }
+
+private:
+    std::size_t count;
+    int repeats;
+    const char *unit;
+    std::size_t checksumStep;
+};
+
+// bench_math.cpp: glm kernels, scalar against batched / SIMD
+int runNoiseBenchmark();
+int runRandomBenchmark();
+int runTransformArrayBenchmark();
+int runMatrixBenchmark();
+int runDoubleBenchmark();
+int runAffineBenchmark();
+int runInverseBenchmark();
+int runTranscendentalBenchmark();
+int runFastMathBenchmark();
+int runGeometricArrayBenchmark();
+int runSoaBenchmark();
+int runQuaternionArrayBenchmark();
+int runPacketBenchmark();
+
+// bench_baseline.cpp: the packed scalar glm code the matrix, double, affine and inverse benchmarks measure the SIMD
+// kernels against, one whole pass per call. it has a translation unit of its own, built with GLM_FORCE_INLINE: in one
+// as big as bench_math.cpp GCC stops inlining the small glm operators, and calls the slow out of line mat4 product it
+// then emits, which is also the copy the linker keeps for the whole program
+void baselineMul(const glm::mat4 *a, const glm::mat4 *b, glm::mat4 *out, std::size_t count);
+void baselineInverse(const glm::mat4 *m, glm::mat4 *out, std::size_t count);
+void baselineTranspose(const glm::mat4 *m, glm::mat4 *out, std::size_t count);
+void baselineRigidInverse(const glm::mat4 *m, glm::mat4 *out, std::size_t count);
+void baselineAffineInverse(const glm::mat4 *m, glm::mat4 *out, std::size_t count);
+void baselineMul(const glm::dmat4 *a, const glm::dmat4 *b, glm::dmat4 *out, std::size_t count);
+void baselineInverse(const glm::dmat4 *m, glm::dmat4 *out, std::size_t count);
+void baselineTranspose(const glm::dmat4 *m, glm::dmat4 *out, std::size_t count);
+void baselineDot(const glm::dvec4 *a, const glm::dvec4 *b, glm::dvec4 *out, std::size_t count);
+void baselineNormalize(const glm::dvec4 *v, glm::dvec4 *out, std::size_t count);
+void baselineMul(const glm::dquat *a, const glm::dquat *b, glm::dquat *out, std::size_t count);
+
+// world = parent * local over nodes whose parents come first, ~0u for a root
+void baselineHierarchy(const std::uint32_t *parents, const glm::mat4 *locals, glm::mat4 *worlds, std::size_t count);
+void baselineHierarchy(const std::uint32_t *parents, const glm::mat3x4 *locals, glm::mat3x4 *worlds, std::size_t count);
+
+// bench_scene.cpp: the engine systems built on them
+int runTransformBenchmark();
+int runEcsBenchmark();
+int runPickBenchmark();
+int runVoxelBenchmark();
+int runSkinningBenchmark();
+int runAnimationBenchmark();
+
+#endif
@@ -0,0 +1,88 @@
+#define GLM_ENABLE_EXPERIMENTAL
+// every glm call inlined into its loop, as the SIMD kernels are in bench_math.cpp, and none left to the out of line
+// copies another translation unit emits
+#define GLM_FORCE_INLINE
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_inverse.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtx/matrix_affine.hpp>
+
+#include "bench.h"
+
+void baselineMul(const glm::mat4 *a, const glm::mat4 *b, glm::mat4 *out, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; i++)
+        out[i] = a[i] * b[i];
+}
+
+void baselineInverse(const glm::mat4 *m, glm::mat4 *out, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; i++)
+        out[i] = glm::inverse(m[i]);
+}
+
+void baselineTranspose(const glm::mat4 *m, glm::mat4 *out, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; i++)
+        out[i] = glm::transpose(m[i]);
+}
+
+void baselineRigidInverse(const glm::mat4 *m, glm::mat4 *out, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; i++)
+        out[i] = glm::rigidInverse(m[i]);
+}
+
+void baselineAffineInverse(const glm::mat4 *m, glm::mat4 *out, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; i++)
+        out[i] = glm::affineInverse(m[i]);
+}
+
+void baselineMul(const glm::dmat4 *a, const glm::dmat4 *b, glm::dmat4 *out, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; i++)
+        out[i] = a[i] * b[i];
+}
+
+void baselineInverse(const glm::dmat4 *m, glm::dmat4 *out, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; i++)
+        out[i] = glm::inverse(m[i]);
+}
+
+void baselineTranspose(const glm::dmat4 *m, glm::dmat4 *out, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; i++)
+        out[i] = glm::transpose(m[i]);
+}
+
+void baselineDot(const glm::dvec4 *a, const glm::dvec4 *b, glm::dvec4 *out, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; i++)
+        out[i] = glm::dvec4(glm::dot(a[i], b[i]));
+}
+
+void baselineNormalize(const glm::dvec4 *v, glm::dvec4 *out, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; i++)
+        out[i] = glm::normalize(v[i]);
+}
+
+void baselineMul(const glm::dquat *a, const glm::dquat *b, glm::dquat *out, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; i++)
+        out[i] = a[i] * b[i];
+}
+
+void baselineHierarchy(const std::uint32_t *parents, const glm::mat4 *locals, glm::mat4 *worlds, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; i++)
+        worlds[i] = parents[i] == ~0u ? locals[i] : worlds[parents[i]] * locals[i];
+}
+
+void baselineHierarchy(const std::uint32_t *parents, const glm::mat3x4 *locals, glm::mat3x4 *worlds, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; i++)
+        worlds[i] = parents[i] == ~0u ? locals[i] : glm::affineMul(worlds[parents[i]], locals[i]);
+}
@@ -0,0 +1,906 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/noise.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtc/type_aligned.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include <glm/gtx/fast_square_root.hpp>
+#include <glm/gtx/fast_trigonometry.hpp>
+#include <glm/gtx/geometric_array.hpp>
+#include <glm/gtx/intersect_packet.hpp>
+#include <glm/gtx/matrix_affine.hpp>
+#include <glm/gtx/quaternion_array.hpp>
+#include <glm/gtx/simd_dispatch.hpp>
+#include <glm/gtx/soa.hpp>
+#include <glm/gtx/tagged_matrix.hpp>
+#include <glm/gtx/transform_array.hpp>
+
+#include <algorithm>
+#include <bitset>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "bench.h"
+#include "job_system.h"
+#include "terrain.h"
+
+// noise benchmark: glm::simplex one point per call against the batched SIMD noise, then whole fractal fields
+// -----------------------------------------------------------------------------------------------------------
+int runNoiseBenchmark()
+{
+    const int size = 1024;
+    const std::size_t count = std::size_t(size) * size;
+    std::vector<float> xs(count), ys(count), out(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        xs[i] = (i % size) * 0.05f;
+        ys[i] = (i / size) * 0.05f;
+    }
+    auto time = [&](const char *name, std::size_t points, auto &&kernel)
+    {
+        double seconds = benchSeconds(1, kernel);
+        benchReport(name, points / seconds / 1e6, "Mpoints/s", benchChecksum(points, [&](std::size_t i) { return out[i]; }));
+    };
+
+    time("glm::simplex 2D loop", count, [&]()
+    {
+        for (std::size_t i = 0; i < count; i++)
+            out[i] = glm::simplex(glm::vec2(xs[i], ys[i]));
+    });
+    // the GLM_ARCH kernels first, then the AVX2 ones when the CPU has them
+    std::cout << "batched noise dispatches to " << glm::simdDispatchName(glm::simdDispatch()) << std::endl;
+    glm::simdDispatchLimit(glm::simd_dispatch_arch);
+    time("simplexBatch 2D, GLM_ARCH kernels", count, [&]() { glm::simplexBatch(count, xs.data(), ys.data(), out.data()); });
+    glm::simdDispatchLimit(glm::simd_dispatch_avx512);
+    time("simplexBatch 2D", count, [&]() { glm::simplexBatch(count, xs.data(), ys.data(), out.data()); });
+
+    time("glm::simplex 3D loop", count, [&]()
+    {
+        for (std::size_t i = 0; i < count; i++)
+            out[i] = glm::simplex(glm::vec3(xs[i], ys[i], 0.5f));
+    });
+    std::vector<float> zs(count, 0.5f);
+    time("simplexBatch 3D", count, [&]() { glm::simplexBatch(count, xs.data(), ys.data(), zs.data(), out.data()); });
+
+    // the same 5 octave fBm heightmap: a loop over glm::simplex against rows of batched noise on the job system
+    glm::noise_fractal hills(5, 1.0f / 64.0f);
+    time("fBm heightmap, glm::simplex loop", count, [&]()
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            glm::vec2 p(float(i % size), float(i / size));
+            float frequency = hills.frequency, amplitude = 1.0f, total = 0.0f, value = 0.0f;
+            for (int octave = 0; octave < hills.octaves; octave++)
+            {
+                value += amplitude * glm::simplex(p * frequency + glm::vec2(octave * 17.0f));
+                total += amplitude;
+                frequency *= hills.lacunarity;
+                amplitude *= hills.gain;
+            }
+            out[i] = value / total;
+        }
+    });
+    JobSystem jobs;
+    std::cout << "job system on " << jobs.threadCount() << " thread(s)" << std::endl;
+    time("fBm heightmap, fillHeightmap", count, [&]() { fillHeightmap(jobs, hills, glm::vec2(0.0f), 1.0f, size, size, out.data()); });
+    hills.period = 256.0f;
+    time("tileable fBm heightmap, fillHeightmap", count, [&]() { fillHeightmap(jobs, hills, glm::vec2(0.0f), 1.0f, size, size, out.data()); });
+
+    glm::noise_fractal caves(3, 1.0f / 24.0f);
+    caves.ridged = true;
+    glm::ivec3 volume(128, 64, 128);
+    time("ridged density volume 128x64x128, fillDensity", std::size_t(volume.x) * volume.y * volume.z, [&]()
+    {
+        fillDensity(jobs, caves, glm::vec3(0.0f), 1.0f, volume, out.data());
+    });
+    return 0;
+}
+
+// random benchmark: std::rand and <random> against the per-thread xoshiro engine of gtc/random, one value per
+// call and in bulk
+// -----------------------------------------------------------------------------------------------------------
+int runRandomBenchmark()
+{
+    const std::size_t count = 1 << 22;
+    std::vector<float> floats(count);
+    std::vector<glm::vec2> vec2s(count);
+    std::vector<glm::vec3> vec3s(count);
+    auto time = [&](const char *name, auto &&kernel, auto &&checksum)
+    {
+        double seconds = benchSeconds(1, kernel);
+        benchReport(name, count / seconds / 1e6, "M/s", benchChecksum(count, checksum));
+    };
+    auto float_sum = [&](std::size_t i) { return floats[i]; };
+    auto vec2_sum = [&](std::size_t i) { return vec2s[i].x + vec2s[i].y; };
+    auto vec3_sum = [&](std::size_t i) { return vec3s[i].x + vec3s[i].y + vec3s[i].z; };
+
+    // what linearRand cost before: four std::rand calls per 32 random bits
+    time("linear, std::rand bytes", [&]()
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            unsigned int bits = 0;
+            for (int byte = 0; byte < 4; byte++)
+                bits = (bits << 8) | (std::rand() % 255);
+            floats[i] = bits / 4294967295.0f;
+        }
+    }, float_sum);
+    std::mt19937 mt(1);
+    std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+    time("linear, std::mt19937", [&]() { for (std::size_t i = 0; i < count; i++) floats[i] = uniform(mt); }, float_sum);
+    glm::randSeed(1);
+    time("linear, glm::linearRand per value", [&]() { for (std::size_t i = 0; i < count; i++) floats[i] = glm::linearRand(0.0f, 1.0f); }, float_sum);
+    time("linear, glm::linearRand bulk", [&]() { glm::linearRand(0.0f, 1.0f, floats.data(), count); }, float_sum);
+
+    std::normal_distribution<float> normal(0.0f, 1.0f);
+    time("gauss, std::normal_distribution", [&]() { for (std::size_t i = 0; i < count; i++) floats[i] = normal(mt); }, float_sum);
+    time("gauss, glm::gaussRand per value", [&]() { for (std::size_t i = 0; i < count; i++) floats[i] = glm::gaussRand(0.0f, 1.0f); }, float_sum);
+    time("gauss, glm::gaussRand bulk", [&]() { glm::gaussRand(0.0f, 1.0f, floats.data(), count); }, float_sum);
+
+    time("sphere, glm::sphericalRand per value", [&]() { for (std::size_t i = 0; i < count; i++) vec3s[i] = glm::sphericalRand(1.0f); }, vec3_sum);
+    time("sphere, glm::sphericalRand bulk", [&]() { glm::sphericalRand(1.0f, vec3s.data(), count); }, vec3_sum);
+    time("ball, glm::ballRand per value", [&]() { for (std::size_t i = 0; i < count; i++) vec3s[i] = glm::ballRand(1.0f); }, vec3_sum);
+    time("ball, glm::ballRand bulk", [&]() { glm::ballRand(1.0f, vec3s.data(), count); }, vec3_sum);
+    time("disk, glm::diskRand per value", [&]() { for (std::size_t i = 0; i < count; i++) vec2s[i] = glm::diskRand(1.0f); }, vec2_sum);
+    time("disk, glm::diskRand bulk", [&]() { glm::diskRand(1.0f, vec2s.data(), count); }, vec2_sum);
+
+    // the same seed replays the same numbers, on any thread
+    double first = 0.0, second = 0.0;
+    std::thread([&]() { glm::randSeed(42); glm::gaussRand(0.0f, 1.0f, floats.data(), count); first = benchChecksum(count, float_sum); }).join();
+    std::thread([&]() { glm::randSeed(42); glm::gaussRand(0.0f, 1.0f, floats.data(), count); second = benchChecksum(count, float_sum); }).join();
+    std::cout << "reseeded runs " << (first == second ? "match" : "differ") << std::endl;
+    return 0;
+}
+
+// transform array benchmark: mat4 times every point of an array, one glm multiply per point against the bulk
+// transforms of gtx/transform_array, for an output that fits in the caches and one that is streamed past them.
+// The bulk transforms run once per kernel tier the CPU supports, see gtx/simd_dispatch
+// ----------------------------------------------------------------------------------------------------------------
+int runTransformArrayBenchmark()
+{
+    glm::mat4 model = glm::rotate(glm::translate(glm::mat4(1.0f), glm::vec3(1.0f, -2.0f, 3.0f)), 0.7f, glm::normalize(glm::vec3(1.0f, 1.0f, 0.0f)));
+    glm::mat4 projection = glm::perspective(glm::radians(45.0f), 1.0f, 0.1f, 100.0f);
+    glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 0.0f, 10.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    glm::mat4 clip = projection * view * model;
+
+    const glm::cpu_features &cpu = glm::cpuFeatures();
+    const glm::simd_dispatch detected = glm::simdDispatch();
+    std::cout << "cpu: sse4.1 " << cpu.sse41 << ", avx " << cpu.avx << ", avx2 " << cpu.avx2 << ", fma " << cpu.fma << ", avx512f " << cpu.avx512f
+              << "; bulk transforms dispatch to " << glm::simdDispatchName(detected) << std::endl;
+
+    for (std::size_t count : {std::size_t(1) << 14, std::size_t(1) << 22})
+    {
+        std::vector<glm::vec3> points(count);
+        glm::randSeed(1);
+        glm::ballRand(10.0f, points.data(), count);
+        std::vector<glm::vec3> out3(count);
+        std::vector<glm::vec4> out4(count);
+        // small arrays are repeated so every run moves about the same number of points
+        const int repeats = int((std::size_t(1) << 24) / count);
+
+        auto time = [&](const char *name, auto &&run, auto &&checksum)
+        {
+            double seconds = benchSeconds(repeats, run);
+            benchReport(name, count / seconds / 1e6, "Mpts/s", benchChecksum(count, checksum));
+        };
+        auto sum3 = [&](std::size_t i) { return out3[i].x + out3[i].y + out3[i].z; };
+        auto sum4 = [&](std::size_t i) { return out4[i].x + out4[i].y + out4[i].z + out4[i].w; };
+
+        std::cout << count << " points, " << count * sizeof(glm::vec4) / 1024 << " KiB of vec4 output" << std::endl;
+        time("  clip space, per point", [&]() { for (std::size_t i = 0; i < count; i++) out4[i] = clip * glm::vec4(points[i], 1.0f); }, sum4);
+        time("  world space, per point", [&]() { for (std::size_t i = 0; i < count; i++) out3[i] = glm::vec3(model * glm::vec4(points[i], 1.0f)); }, sum3);
+        time("  ndc, per point", [&]() { for (std::size_t i = 0; i < count; i++) { glm::vec4 p = clip * glm::vec4(points[i], 1.0f); out3[i] = glm::vec3(p) / p.w; } }, sum3);
+        // every kernel tier up to the one picked for this CPU
+        for (int tier = glm::simd_dispatch_arch; tier <= detected; tier++)
+        {
+            glm::simdDispatchLimit(glm::simd_dispatch(tier));
+            std::cout << "  " << glm::simdDispatchName(glm::simd_dispatch(tier)) << " kernels" << std::endl;
+            time("    clip space, transformArray", [&]() { glm::transformArray(clip, points.data(), out4.data(), count); }, sum4);
+            time("    world space, transformAffineArray", [&]() { glm::transformAffineArray(model, points.data(), out3.data(), count); }, sum3);
+            time("    ndc, transformProjectArray", [&]() { glm::transformProjectArray(clip, points.data(), out3.data(), count); }, sum3);
+        }
+        glm::simdDispatchLimit(glm::simd_dispatch_avx512);
+    }
+    return 0;
+}
+
+// matrix benchmark: mat4 multiply, inverse and transpose with the scalar glm code, then with the simd/matrix.h kernels
+// of each tier the build targets: SSE2, AVX2 with FMA (-mavx2 -mfma or GLM_FORCE_AVX2) and AVX-512 (-mavx512f or
+// GLM_FORCE_AVX512). aligned_mat4 products use the widest of them, inverse and transpose the SSE2 ones
+// --------------------------------------------------------------------------------------------------------------------
+int runMatrixBenchmark()
+{
+    const std::size_t count = 1024;
+    const int repeats = 2048;
+    std::vector<glm::mat4> a(count), b(count), out(count);
+    std::vector<glm::aligned_mat4> aligned_a(count), aligned_b(count), aligned_out(count);
+    glm::randSeed(1);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        glm::mat4 rotation = glm::rotate(glm::mat4(1.0f), glm::linearRand(0.0f, 6.28f), glm::sphericalRand(1.0f));
+        a[i] = glm::scale(glm::translate(glm::mat4(1.0f), glm::ballRand(10.0f)) * rotation, glm::linearRand(glm::vec3(0.5f), glm::vec3(2.0f)));
+        b[i] = glm::perspective(glm::linearRand(0.5f, 1.5f), 1.0f, 0.1f, 100.0f) * a[(i + 1) % count];
+        aligned_a[i] = glm::aligned_mat4(a[i]);
+        aligned_b[i] = glm::aligned_mat4(b[i]);
+    }
+
+    BenchLoop bench(count, repeats, "ns per matrix");
+    auto checksum = [&](std::size_t i) { return out[i][0][0] + out[i][3][2] + aligned_out[i][0][0] + aligned_out[i][3][2]; };
+    auto time = [&](const char *name, auto &&kernel) { bench.each(name, kernel, checksum); };
+
+    // the scalar lines run the bench_baseline.cpp passes
+    bench.run("mul, scalar", [&]() { baselineMul(a.data(), b.data(), out.data(), count); }, checksum);
+    bench.run("inverse, scalar", [&]() { baselineInverse(a.data(), out.data(), count); }, checksum);
+    bench.run("transpose, scalar", [&]() { baselineTranspose(a.data(), out.data(), count); }, checksum);
+    for (glm::mat4 &m : out)
+        m = glm::mat4(0.0f);
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+    time("mul, SSE2", [&](std::size_t i) { glm_mat4_mul(&aligned_a[i][0].data, &aligned_b[i][0].data, &aligned_out[i][0].data); });
+    time("inverse, SSE2", [&](std::size_t i) { glm_mat4_inverse(&aligned_a[i][0].data, &aligned_out[i][0].data); });
+    time("transpose, SSE2", [&](std::size_t i) { glm_mat4_transpose(&aligned_a[i][0].data, &aligned_out[i][0].data); });
+#endif
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+    time("mul, AVX2", [&](std::size_t i) { glm_mat4_mul_avx2(&aligned_a[i][0].data, &aligned_b[i][0].data, &aligned_out[i][0].data); });
+    time("inverse, AVX2", [&](std::size_t i) { glm_mat4_inverse_avx2(&aligned_a[i][0].data, &aligned_out[i][0].data); });
+    time("transpose, AVX2", [&](std::size_t i) { glm_mat4_transpose_avx2(&aligned_a[i][0].data, &aligned_out[i][0].data); });
+#endif
+#if GLM_ARCH & GLM_ARCH_AVX512_BIT
+    time("mul, AVX-512", [&](std::size_t i) { glm_mat4_mul_avx512(&aligned_a[i][0].data, &aligned_b[i][0].data, &aligned_out[i][0].data); });
+    time("inverse, AVX-512", [&](std::size_t i) { glm_mat4_inverse_avx512(&aligned_a[i][0].data, &aligned_out[i][0].data); });
+    time("transpose, AVX-512", [&](std::size_t i) { glm_mat4_transpose_avx512(&aligned_a[i][0].data, &aligned_out[i][0].data); });
+#endif
+    return 0;
+}
+
+// double benchmark: dmat4 multiply, inverse and transpose, dvec4 dot and normalize and dquat multiply, with the packed
+// types (scalar code, the bench_baseline.cpp passes) and then the aligned ones. The aligned types only get the simd/*.h
+// double kernels when the build targets AVX (-mavx, or -mavx2 -mfma for the cross product and the quaternion multiply);
+// the aligned dmat4 inverse stays on the scalar code, an AVX one built from broadcasts and blends came out slower than it
+// --------------------------------------------------------------------------------------------------------------------
+int runDoubleBenchmark()
+{
+    typedef glm::qua<double, glm::packed_highp> packed_dquat;
+    typedef glm::qua<double, glm::aligned_highp> aligned_dquat;
+
+    const std::size_t count = 1024;
+    const int repeats = 2048;
+    std::vector<glm::dmat4> a(count), b(count), out(count);
+    std::vector<glm::aligned_dmat4> aligned_a(count), aligned_b(count), aligned_out(count);
+    std::vector<glm::dvec4> v(count), w(count), v_out(count);
+    std::vector<glm::aligned_dvec4> aligned_v(count), aligned_w(count), aligned_v_out(count);
+    std::vector<packed_dquat> p(count), q(count), q_out(count);
+    std::vector<aligned_dquat> aligned_p(count), aligned_q(count), aligned_q_out(count);
+    glm::randSeed(1);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        glm::dmat4 rotation = glm::rotate(glm::dmat4(1.0), glm::linearRand(0.0, 6.28), glm::sphericalRand(1.0));
+        a[i] = glm::scale(glm::translate(glm::dmat4(1.0), glm::ballRand(10.0)) * rotation, glm::linearRand(glm::dvec3(0.5), glm::dvec3(2.0)));
+        b[i] = glm::perspective(glm::linearRand(0.5, 1.5), 1.0, 0.1, 100.0) * a[(i + 1) % count];
+        v[i] = glm::dvec4(glm::ballRand(10.0), glm::linearRand(-1.0, 1.0));
+        w[i] = glm::dvec4(glm::ballRand(10.0), glm::linearRand(-1.0, 1.0));
+        p[i] = glm::angleAxis(glm::linearRand(0.0, 6.28), glm::sphericalRand(1.0));
+        q[i] = glm::angleAxis(glm::linearRand(0.0, 6.28), glm::sphericalRand(1.0));
+        aligned_a[i] = glm::aligned_dmat4(a[i]);
+        aligned_b[i] = glm::aligned_dmat4(b[i]);
+        aligned_v[i] = glm::aligned_dvec4(v[i]);
+        aligned_w[i] = glm::aligned_dvec4(w[i]);
+        aligned_p[i] = aligned_dquat(p[i]);
+        aligned_q[i] = aligned_dquat(q[i]);
+    }
+
+    // the checksum only sums what the kernel wrote, so the packed and aligned lines of a kernel should match
+    BenchLoop bench(count, repeats, "ns per call");
+    auto time = [&](const char *name, auto &&kernel, auto &&checksum) { bench.each(name, kernel, checksum); };
+    auto matrix_sum = [&](std::size_t i) { return out[i][0][0] + out[i][3][2]; };
+    auto aligned_matrix_sum = [&](std::size_t i) { return aligned_out[i][0][0] + aligned_out[i][3][2]; };
+    auto vector_sum = [&](std::size_t i) { return v_out[i].x + v_out[i].w; };
+    auto aligned_vector_sum = [&](std::size_t i) { return aligned_v_out[i].x + aligned_v_out[i].w; };
+    auto quat_sum = [&](std::size_t i) { return q_out[i].x + q_out[i].w; };
+    auto aligned_quat_sum = [&](std::size_t i) { return aligned_q_out[i].x + aligned_q_out[i].w; };
+
+    bench.run("dmat4 mul, packed", [&]() { baselineMul(a.data(), b.data(), out.data(), count); }, matrix_sum);
+    time("dmat4 mul, aligned", [&](std::size_t i) { aligned_out[i] = aligned_a[i] * aligned_b[i]; }, aligned_matrix_sum);
+    bench.run("dmat4 inverse, packed", [&]() { baselineInverse(a.data(), out.data(), count); }, matrix_sum);
+    time("dmat4 inverse, aligned", [&](std::size_t i) { aligned_out[i] = glm::inverse(aligned_a[i]); }, aligned_matrix_sum);
+    bench.run("dmat4 transpose, packed", [&]() { baselineTranspose(a.data(), out.data(), count); }, matrix_sum);
+    time("dmat4 transpose, aligned", [&](std::size_t i) { aligned_out[i] = glm::transpose(aligned_a[i]); }, aligned_matrix_sum);
+    bench.run("dvec4 dot, packed", [&]() { baselineDot(v.data(), w.data(), v_out.data(), count); }, vector_sum);
+    time("dvec4 dot, aligned", [&](std::size_t i) { aligned_v_out[i] = glm::aligned_dvec4(glm::dot(aligned_v[i], aligned_w[i])); }, aligned_vector_sum);
+    bench.run("dvec4 normalize, packed", [&]() { baselineNormalize(v.data(), v_out.data(), count); }, vector_sum);
+    time("dvec4 normalize, aligned", [&](std::size_t i) { aligned_v_out[i] = glm::normalize(aligned_v[i]); }, aligned_vector_sum);
+    bench.run("dquat mul, packed", [&]() { baselineMul(p.data(), q.data(), q_out.data(), count); }, quat_sum);
+    time("dquat mul, aligned", [&](std::size_t i) { aligned_q_out[i] = aligned_p[i] * aligned_q[i]; }, aligned_quat_sum);
+    return 0;
+}
+
+// affine benchmark: the world = parent * local pass of a scene graph update, over nodes in depth order, with mat4 and
+// with the 3 rows of gtx/matrix_affine (48 instead of 64 bytes per matrix). The aligned types use simd/matrix.h
+// --------------------------------------------------------------------------------------------------------------------
+int runAffineBenchmark()
+{
+    const std::size_t node_count = 256 * 1024;
+    const std::size_t root_count = 64;
+    const int repeats = 64;
+    std::vector<std::uint32_t> parents(node_count);
+    std::vector<glm::mat4> locals(node_count), worlds(node_count);
+    std::vector<glm::aligned_mat4> aligned_locals(node_count), aligned_worlds(node_count);
+    std::vector<glm::mat3x4> affine_locals(node_count), affine_worlds(node_count);
+    std::vector<glm::aligned_mat3x4> aligned_affine_locals(node_count), aligned_affine_worlds(node_count);
+    glm::randSeed(1);
+    for (std::size_t i = 0; i < node_count; i++)
+    {
+        // parents always come first, like the breadth-first order of TransformHierarchy
+        parents[i] = i < root_count ? ~0u : (std::uint32_t)(glm::linearRand(0.0, 1.0) * double(i)) % (std::uint32_t)i;
+        glm::mat4 rotation = glm::mat4_cast(glm::angleAxis(glm::linearRand(0.0f, 6.28f), glm::sphericalRand(1.0f)));
+        locals[i] = glm::scale(glm::translate(glm::mat4(1.0f), glm::ballRand(1.0f)) * rotation, glm::vec3(glm::linearRand(0.9f, 1.1f)));
+        aligned_locals[i] = glm::aligned_mat4(locals[i]);
+        affine_locals[i] = glm::mat3x4_cast(locals[i]);
+        aligned_affine_locals[i] = glm::aligned_mat3x4(affine_locals[i]);
+    }
+
+    BenchLoop bench(node_count, repeats, "ns per node", 97);
+    auto time = [&](const char *name, std::size_t matrix_bytes, auto &&update, auto &&translation)
+    {
+        std::string label = std::string(name) + ", " + std::to_string(node_count * matrix_bytes * 2 / (1024 * 1024)) + " MiB of locals and worlds";
+        bench.run(label.c_str(), update, translation);
+    };
+
+    time("mat4", sizeof(glm::mat4), [&]() { baselineHierarchy(parents.data(), locals.data(), worlds.data(), node_count); }, [&](std::size_t i) { return worlds[i][3].x; });
+    time("aligned_mat4", sizeof(glm::aligned_mat4), [&]()
+    {
+        for (std::size_t i = 0; i < node_count; i++)
+            aligned_worlds[i] = parents[i] == ~0u ? aligned_locals[i] : aligned_worlds[parents[i]] * aligned_locals[i];
+    }, [&](std::size_t i) { return aligned_worlds[i][3].x; });
+    time("mat3x4 affine", sizeof(glm::mat3x4), [&]()
+    {
+        baselineHierarchy(parents.data(), affine_locals.data(), affine_worlds.data(), node_count);
+    }, [&](std::size_t i) { return affine_worlds[i][0].w; });
+    time("aligned_mat3x4 affine", sizeof(glm::aligned_mat3x4), [&]()
+    {
+        for (std::size_t i = 0; i < node_count; i++)
+            aligned_affine_worlds[i] = parents[i] == ~0u ? aligned_affine_locals[i] : glm::affineMul(aligned_affine_worlds[parents[i]], aligned_affine_locals[i]);
+    }, [&](std::size_t i) { return aligned_affine_worlds[i][0].w; });
+    return 0;
+}
+
+// inverse benchmark: glm::inverse on rigid and affine matrices against rigidInverse and affineInverse, packed and
+// aligned, then the model-view-projection products and inverses of a camera through gtx/tagged_matrix, which picks
+// those on its own
+// --------------------------------------------------------------------------------------------------------------------
+int runInverseBenchmark()
+{
+    const std::size_t count = 1024;
+    const int repeats = 2048;
+    std::vector<glm::mat4> rigid(count), affine(count), out(count);
+    std::vector<glm::aligned_mat4> aligned_rigid(count), aligned_affine(count), aligned_out(count);
+    std::vector<glm::aligned_tagged_mat4> tagged_views(count), tagged_models(count), tagged_out(count);
+    glm::aligned_tagged_mat4 tagged_projection(glm::aligned_mat4(glm::perspective(1.0f, 1.0f, 0.1f, 100.0f)), glm::matrix_class_general);
+    glm::randSeed(1);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        rigid[i] = glm::lookAt(glm::ballRand(10.0f), glm::ballRand(1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+        affine[i] = glm::scale(glm::rotate(glm::translate(glm::mat4(1.0f), glm::ballRand(10.0f)), glm::linearRand(0.0f, 6.28f), glm::sphericalRand(1.0f)),
+                               glm::linearRand(glm::vec3(0.5f), glm::vec3(2.0f)));
+        aligned_rigid[i] = glm::aligned_mat4(rigid[i]);
+        aligned_affine[i] = glm::aligned_mat4(affine[i]);
+        tagged_views[i] = glm::aligned_tagged_mat4(aligned_rigid[i], glm::matrix_class_rigid);
+        tagged_models[i] = glm::aligned_tagged_mat4(aligned_affine[i], glm::matrix_class_affine);
+    }
+
+    BenchLoop bench(count, repeats, "ns per matrix");
+    auto time = [&](const char *name, auto &&kernel, auto &&checksum) { bench.each(name, kernel, checksum); };
+    auto packed_sum = [&](std::size_t i) { return out[i][0][0] + out[i][3][2]; };
+    auto aligned_sum = [&](std::size_t i) { return aligned_out[i][0][0] + aligned_out[i][3][2]; };
+    auto tagged_sum = [&](std::size_t i) { return tagged_out[i].value[0][0] + tagged_out[i].value[3][2]; };
+
+    // the packed lines run the bench_baseline.cpp passes
+    bench.run("rigid, inverse", [&]() { baselineInverse(rigid.data(), out.data(), count); }, packed_sum);
+    bench.run("rigid, rigidInverse", [&]() { baselineRigidInverse(rigid.data(), out.data(), count); }, packed_sum);
+    time("rigid, aligned inverse", [&](std::size_t i) { aligned_out[i] = glm::inverse(aligned_rigid[i]); }, aligned_sum);
+    time("rigid, aligned rigidInverse", [&](std::size_t i) { aligned_out[i] = glm::rigidInverse(aligned_rigid[i]); }, aligned_sum);
+    bench.run("affine, inverse", [&]() { baselineInverse(affine.data(), out.data(), count); }, packed_sum);
+    bench.run("affine, affineInverse", [&]() { baselineAffineInverse(affine.data(), out.data(), count); }, packed_sum);
+    time("affine, aligned inverse", [&](std::size_t i) { aligned_out[i] = glm::inverse(aligned_affine[i]); }, aligned_sum);
+    time("affine, aligned affineInverse", [&](std::size_t i) { aligned_out[i] = glm::affineInverse(aligned_affine[i]); }, aligned_sum);
+
+    // inverse of the model-view matrix, as for normals and picking, then the full projection product
+    time("model-view inverse, aligned_mat4", [&](std::size_t i) { aligned_out[i] = glm::inverse(aligned_rigid[i] * aligned_affine[i]); }, aligned_sum);
+    time("model-view inverse, aligned_tagged_mat4", [&](std::size_t i) { tagged_out[i] = glm::inverse(tagged_views[i] * tagged_models[i]); }, tagged_sum);
+    time("projection * model-view, aligned_mat4", [&](std::size_t i)
+    {
+        aligned_out[i] = tagged_projection.value * (aligned_rigid[i] * aligned_affine[i]);
+    }, aligned_sum);
+    time("projection * model-view, aligned_tagged_mat4", [&](std::size_t i)
+    {
+        tagged_out[i] = tagged_projection * (tagged_views[i] * tagged_models[i]);
+    }, tagged_sum);
+    return 0;
+}
+
+// transcendental benchmark: the max error in ulp of the aligned_vec4 sin, cos, atan, atan2, exp, exp2, log, log2 and pow
+// against double precision libm over random inputs, then their time per vec4 against vec4, which calls libm per lane.
+// vec4 is the reference of the checksums, the aligned lines should match them to a few digits
+// --------------------------------------------------------------------------------------------------------------------
+int runTranscendentalBenchmark()
+{
+    const std::size_t count = 1024;
+    const int repeats = 2048;
+    const std::size_t samples = 1 << 20;
+
+    // error of a float result in units of the last place of the exact one, 1e9 when an inf or NaN is missed
+    auto ulp_error = [](float result, double exact)
+    {
+        if (std::isnan(exact) || std::isinf((float)exact))
+            return result == (float)exact || (std::isnan(exact) && std::isnan(result)) ? 0.0 : 1e9;
+        int exponent;
+        std::frexp(exact, &exponent);
+        double ulp = std::ldexp(1.0, std::max(exponent, -125) - 24);
+        return std::fabs((double)result - exact) / ulp;
+    };
+    std::mt19937 rng(1);
+    auto accuracy = [&](const char *name, float lo, float hi, auto &&simd, auto &&exact)
+    {
+        std::uniform_real_distribution<float> dist(lo, hi);
+        double max_error = 0.0;
+        float worst = 0.0f;
+        for (std::size_t i = 0; i < samples; i += 4)
+        {
+            glm::aligned_vec4 x(dist(rng), dist(rng), dist(rng), dist(rng));
+            glm::aligned_vec4 result = simd(x);
+            for (int k = 0; k < 4; k++)
+            {
+                double error = ulp_error(result[k], exact((double)x[k]));
+                if (error > max_error)
+                {
+                    max_error = error;
+                    worst = x[k];
+                }
+            }
+        }
+        std::cout << name << " on [" << lo << ", " << hi << "]: " << max_error << " ulp max (at " << worst << ")" << std::endl;
+    };
+    accuracy("sin", -3.2f, 3.2f, [](const glm::aligned_vec4 &x) { return glm::sin(x); }, [](double x) { return std::sin(x); });
+    accuracy("sin", -1e5f, 1e5f, [](const glm::aligned_vec4 &x) { return glm::sin(x); }, [](double x) { return std::sin(x); });
+    accuracy("cos", -3.2f, 3.2f, [](const glm::aligned_vec4 &x) { return glm::cos(x); }, [](double x) { return std::cos(x); });
+    accuracy("cos", -1e5f, 1e5f, [](const glm::aligned_vec4 &x) { return glm::cos(x); }, [](double x) { return std::cos(x); });
+    accuracy("atan", -10.0f, 10.0f, [](const glm::aligned_vec4 &x) { return glm::atan(x); }, [](double x) { return std::atan(x); });
+    accuracy("atan2(x, 1 - x)", -10.0f, 10.0f, [](const glm::aligned_vec4 &x) { return glm::atan(x, 1.0f - x); },
+             [](double x) { return std::atan2(x, (double)(1.0f - (float)x)); });
+    accuracy("exp", -100.0f, 88.0f, [](const glm::aligned_vec4 &x) { return glm::exp(x); }, [](double x) { return std::exp(x); });
+    accuracy("exp2", -140.0f, 127.0f, [](const glm::aligned_vec4 &x) { return glm::exp2(x); }, [](double x) { return std::exp2(x); });
+    accuracy("log", 0.0f, 4.0f, [](const glm::aligned_vec4 &x) { return glm::log(x); }, [](double x) { return std::log(x); });
+    accuracy("log", 0.0f, 1e30f, [](const glm::aligned_vec4 &x) { return glm::log(x); }, [](double x) { return std::log(x); });
+    accuracy("log2", 0.0f, 4.0f, [](const glm::aligned_vec4 &x) { return glm::log2(x); }, [](double x) { return std::log2(x); });
+    accuracy("pow(x, 2.2)", 0.0f, 100.0f, [](const glm::aligned_vec4 &x) { return glm::pow(x, glm::aligned_vec4(2.2f)); },
+             [](double x) { return std::pow(x, (double)2.2f); });
+    accuracy("pow(1.5, y)", -200.0f, 200.0f, [](const glm::aligned_vec4 &y) { return glm::pow(glm::aligned_vec4(1.5f), y); },
+             [](double y) { return std::pow(1.5, y); });
+
+    std::vector<glm::vec4> x(count), y(count), out(count);
+    std::vector<glm::aligned_vec4> aligned_x(count), aligned_y(count), aligned_out(count);
+    std::uniform_real_distribution<float> angle(-10.0f, 10.0f), positive(0.01f, 10.0f);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        x[i] = glm::vec4(angle(rng), angle(rng), angle(rng), angle(rng));
+        y[i] = glm::vec4(positive(rng), positive(rng), positive(rng), positive(rng));
+        aligned_x[i] = glm::aligned_vec4(x[i]);
+        aligned_y[i] = glm::aligned_vec4(y[i]);
+    }
+
+    BenchLoop bench(count, repeats, "ns per vec4");
+    auto time = [&](const char *name, auto &&kernel, auto &&checksum) { bench.each(name, kernel, checksum); };
+    auto packed_sum = [&](std::size_t i) { return out[i].x + out[i].w; };
+    auto aligned_sum = [&](std::size_t i) { return aligned_out[i].x + aligned_out[i].w; };
+
+    time("sin, vec4", [&](std::size_t i) { out[i] = glm::sin(x[i]); }, packed_sum);
+    time("sin, aligned_vec4", [&](std::size_t i) { aligned_out[i] = glm::sin(aligned_x[i]); }, aligned_sum);
+    time("cos, vec4", [&](std::size_t i) { out[i] = glm::cos(x[i]); }, packed_sum);
+    time("cos, aligned_vec4", [&](std::size_t i) { aligned_out[i] = glm::cos(aligned_x[i]); }, aligned_sum);
+    time("atan, vec4", [&](std::size_t i) { out[i] = glm::atan(x[i]); }, packed_sum);
+    time("atan, aligned_vec4", [&](std::size_t i) { aligned_out[i] = glm::atan(aligned_x[i]); }, aligned_sum);
+    time("atan2, vec4", [&](std::size_t i) { out[i] = glm::atan(x[i], y[i]); }, packed_sum);
+    time("atan2, aligned_vec4", [&](std::size_t i) { aligned_out[i] = glm::atan(aligned_x[i], aligned_y[i]); }, aligned_sum);
+    time("exp, vec4", [&](std::size_t i) { out[i] = glm::exp(x[i]); }, packed_sum);
+    time("exp, aligned_vec4", [&](std::size_t i) { aligned_out[i] = glm::exp(aligned_x[i]); }, aligned_sum);
+    time("exp2, vec4", [&](std::size_t i) { out[i] = glm::exp2(x[i]); }, packed_sum);
+    time("exp2, aligned_vec4", [&](std::size_t i) { aligned_out[i] = glm::exp2(aligned_x[i]); }, aligned_sum);
+    time("log, vec4", [&](std::size_t i) { out[i] = glm::log(y[i]); }, packed_sum);
+    time("log, aligned_vec4", [&](std::size_t i) { aligned_out[i] = glm::log(aligned_y[i]); }, aligned_sum);
+    time("log2, vec4", [&](std::size_t i) { out[i] = glm::log2(y[i]); }, packed_sum);
+    time("log2, aligned_vec4", [&](std::size_t i) { aligned_out[i] = glm::log2(aligned_y[i]); }, aligned_sum);
+    time("pow, vec4", [&](std::size_t i) { out[i] = glm::pow(y[i], x[i]); }, packed_sum);
+    time("pow, aligned_vec4", [&](std::size_t i) { aligned_out[i] = glm::pow(aligned_y[i], aligned_x[i]); }, aligned_sum);
+    return 0;
+}
+
+// fast math benchmark: error against double precision libm and time per float of the GLM_GTX_fast_square_root and
+// GLM_GTX_fast_trigonometry tiers, run over float arrays. "libm" is std:: per float, "vec4" the original scalar
+// approximations through a packed vec4, lowp / mediump / highp the *Array functions of that qualifier.
+// Square roots report the relative error, sin and cos the absolute one
+// ---------------------------------------------------------------------------------------------------------------------
+int runFastMathBenchmark()
+{
+    const std::size_t count = 4096;
+    const int repeats = 512;
+    const std::size_t samples = 1 << 20;
+
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> exponent(-20.0f, 20.0f), angle(-100.0f, 100.0f);
+    std::vector<float> positive(samples), angles(samples), out(samples);
+    for (std::size_t i = 0; i < samples; i++)
+    {
+        positive[i] = std::exp2(exponent(rng));
+        angles[i] = angle(rng);
+    }
+
+    std::printf("%-16s %-8s %12s %12s\n", "function", "tier", "max error", "ns/float");
+    auto row = [&](const char *name, const char *tier, const std::vector<float> &in, auto &&function, auto &&exact, bool relative)
+    {
+        function(in.data(), out.data(), samples);
+        double max_error = 0.0;
+        for (std::size_t i = 0; i < samples; i++)
+        {
+            double reference = exact((double)in[i]);
+            double error = std::fabs((double)out[i] - reference);
+            max_error = std::max(max_error, relative ? error / std::fabs(reference) : error);
+        }
+
+        double ns = benchSeconds(repeats, [&]() { function(in.data(), out.data(), count); }) * 1e9 / double(count);
+        std::printf("%-16s %-8s %12.3g %12.3f\n", name, tier, max_error, ns);
+    };
+    // vec4 runs fastSqrt and the others on a packed vec4, whose lanes use the scalar approximations
+    auto packed = [](auto &&function, float const *in, float *out, std::size_t n)
+    {
+        for (std::size_t i = 0; i + 4 <= n; i += 4)
+        {
+            glm::vec4 v = function(glm::make_vec4(in + i));
+            std::memcpy(out + i, &v, sizeof(v));
+        }
+    };
+
+    auto exact_sqrt = [](double x) { return std::sqrt(x); };
+    auto exact_inversesqrt = [](double x) { return 1.0 / std::sqrt(x); };
+    auto exact_sin = [](double x) { return std::sin(x); };
+    auto exact_cos = [](double x) { return std::cos(x); };
+
+    row("fastSqrt", "libm", positive, [](float const *in, float *o, std::size_t n) { for (std::size_t i = 0; i < n; i++) o[i] = std::sqrt(in[i]); }, exact_sqrt, true);
+    row("fastSqrt", "vec4", positive, [&](float const *in, float *o, std::size_t n) { packed([](const glm::vec4 &v) { return glm::fastSqrt(v); }, in, o, n); }, exact_sqrt, true);
+    row("fastSqrt", "lowp", positive, glm::fastSqrtArray<glm::lowp>, exact_sqrt, true);
+    row("fastSqrt", "mediump", positive, glm::fastSqrtArray<glm::mediump>, exact_sqrt, true);
+    row("fastSqrt", "highp", positive, glm::fastSqrtArray<glm::highp>, exact_sqrt, true);
+
+    row("fastInverseSqrt", "libm", positive, [](float const *in, float *o, std::size_t n) { for (std::size_t i = 0; i < n; i++) o[i] = 1.0f / std::sqrt(in[i]); }, exact_inversesqrt, true);
+    row("fastInverseSqrt", "vec4", positive, [&](float const *in, float *o, std::size_t n) { packed([](const glm::vec4 &v) { return glm::fastInverseSqrt(v); }, in, o, n); }, exact_inversesqrt, true);
+    row("fastInverseSqrt", "lowp", positive, glm::fastInverseSqrtArray<glm::lowp>, exact_inversesqrt, true);
+    row("fastInverseSqrt", "mediump", positive, glm::fastInverseSqrtArray<glm::mediump>, exact_inversesqrt, true);
+    row("fastInverseSqrt", "highp", positive, glm::fastInverseSqrtArray<glm::highp>, exact_inversesqrt, true);
+
+    row("fastSin", "libm", angles, [](float const *in, float *o, std::size_t n) { for (std::size_t i = 0; i < n; i++) o[i] = std::sin(in[i]); }, exact_sin, false);
+    row("fastSin", "vec4", angles, [&](float const *in, float *o, std::size_t n) { packed([](const glm::vec4 &v) { return glm::fastSin(v); }, in, o, n); }, exact_sin, false);
+    row("fastSin", "lowp", angles, glm::fastSinArray<glm::lowp>, exact_sin, false);
+    row("fastSin", "mediump", angles, glm::fastSinArray<glm::mediump>, exact_sin, false);
+    row("fastSin", "highp", angles, glm::fastSinArray<glm::highp>, exact_sin, false);
+
+    row("fastCos", "libm", angles, [](float const *in, float *o, std::size_t n) { for (std::size_t i = 0; i < n; i++) o[i] = std::cos(in[i]); }, exact_cos, false);
+    row("fastCos", "vec4", angles, [&](float const *in, float *o, std::size_t n) { packed([](const glm::vec4 &v) { return glm::fastCos(v); }, in, o, n); }, exact_cos, false);
+    row("fastCos", "lowp", angles, glm::fastCosArray<glm::lowp>, exact_cos, false);
+    row("fastCos", "mediump", angles, glm::fastCosArray<glm::mediump>, exact_cos, false);
+    row("fastCos", "highp", angles, glm::fastCosArray<glm::highp>, exact_cos, false);
+    return 0;
+}
+
+// geometric array benchmark: normalize, length, distance2, dot and cross over 4096 vectors, as a loop calling the core
+// function per element, then through GLM_GTX_geometric_array on the same vec3 / vec4 arrays and on the same data split
+// in one array per component. Checksums of one function should agree to about 6 digits
+// ----------------------------------------------------------------------------------------------------------------------
+int runGeometricArrayBenchmark()
+{
+    const std::size_t count = 4096;
+    const int repeats = 1024;
+
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> coordinate(-10.0f, 10.0f);
+    std::vector<glm::vec3> a(count), b(count), out(count);
+    std::vector<glm::vec4> a4(count), out4(count);
+    std::vector<float> ax(count), ay(count), az(count), bx(count), by(count), bz(count), ox(count), oy(count), oz(count), scalars(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        a[i] = glm::vec3(coordinate(rng), coordinate(rng), coordinate(rng));
+        b[i] = glm::vec3(coordinate(rng), coordinate(rng), coordinate(rng));
+        a4[i] = glm::vec4(a[i], coordinate(rng));
+        ax[i] = a[i].x;
+        ay[i] = a[i].y;
+        az[i] = a[i].z;
+        bx[i] = b[i].x;
+        by[i] = b[i].y;
+        bz[i] = b[i].z;
+    }
+
+    std::cout << "kernels: " << glm::simdDispatchName(glm::simdDispatch()) << std::endl;
+    BenchLoop bench(count, repeats, "ns per vector");
+    auto time = [&](const char *name, auto &&kernel, auto &&checksum) { bench.run(name, kernel, checksum); };
+    auto vec3_sum = [&](std::size_t i) { return out[i].x + out[i].y + out[i].z; };
+    auto vec4_sum = [&](std::size_t i) { return out4[i].x + out4[i].w; };
+    auto soa_sum = [&](std::size_t i) { return ox[i] + oy[i] + oz[i]; };
+    auto scalar_sum = [&](std::size_t i) { return scalars[i]; };
+
+    time("normalize vec3, per element", [&] { for (std::size_t i = 0; i < count; i++) out[i] = glm::normalize(a[i]); }, vec3_sum);
+    time("normalize vec3, normalizeArray", [&] { glm::normalizeArray(a.data(), out.data(), count); }, vec3_sum);
+    time("normalize vec3, normalizeSoA", [&] { glm::normalizeSoA(count, ax.data(), ay.data(), az.data(), ox.data(), oy.data(), oz.data()); }, soa_sum);
+    time("normalize vec4, per element", [&] { for (std::size_t i = 0; i < count; i++) out4[i] = glm::normalize(a4[i]); }, vec4_sum);
+    time("normalize vec4, normalizeArray", [&] { glm::normalizeArray(a4.data(), out4.data(), count); }, vec4_sum);
+    time("length vec3, per element", [&] { for (std::size_t i = 0; i < count; i++) scalars[i] = glm::length(a[i]); }, scalar_sum);
+    time("length vec3, lengthArray", [&] { glm::lengthArray(a.data(), scalars.data(), count); }, scalar_sum);
+    time("length vec3, lengthSoA", [&] { glm::lengthSoA(count, ax.data(), ay.data(), az.data(), scalars.data()); }, scalar_sum);
+    time("distance2 vec3, per element", [&] { for (std::size_t i = 0; i < count; i++) scalars[i] = glm::distance2(a[i], b[i]); }, scalar_sum);
+    time("distance2 vec3, distance2Array", [&] { glm::distance2Array(a.data(), b.data(), scalars.data(), count); }, scalar_sum);
+    time("distance2 vec3, distance2SoA", [&] { glm::distance2SoA(count, ax.data(), ay.data(), az.data(), bx.data(), by.data(), bz.data(), scalars.data()); }, scalar_sum);
+    time("dot vec3, per element", [&] { for (std::size_t i = 0; i < count; i++) scalars[i] = glm::dot(a[i], b[i]); }, scalar_sum);
+    time("dot vec3, dotArray", [&] { glm::dotArray(a.data(), b.data(), scalars.data(), count); }, scalar_sum);
+    time("dot vec3, dotSoA", [&] { glm::dotSoA(count, ax.data(), ay.data(), az.data(), bx.data(), by.data(), bz.data(), scalars.data()); }, scalar_sum);
+    time("cross vec3, per element", [&] { for (std::size_t i = 0; i < count; i++) out[i] = glm::cross(a[i], b[i]); }, vec3_sum);
+    time("cross vec3, crossArray", [&] { glm::crossArray(a.data(), b.data(), out.data(), count); }, vec3_sum);
+    time("cross vec3, crossSoA", [&] { glm::crossSoA(count, ax.data(), ay.data(), az.data(), bx.data(), by.data(), bz.data(), ox.data(), oy.data(), oz.data()); }, soa_sum);
+    return 0;
+}
+
+// soa benchmark: dot, cross, normalize and transform over 4096 vectors and normalize over 4096 quaternions, as a loop
+// over vec3 / quat arrays calling the core function per element, through the GLM_GTX_geometric_array and
+// GLM_GTX_transform_array array functions, and on GLM_GTX_soa containers. Also times the conversions between the two
+// layouts and a per element loop through soa iterators. Checksums of one function should agree to about 6 digits
+// ----------------------------------------------------------------------------------------------------------------------
+int runSoaBenchmark()
+{
+    const std::size_t count = 4096;
+    const int repeats = 1024;
+
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> coordinate(-10.0f, 10.0f);
+    std::vector<glm::vec3> a(count), b(count), out(count);
+    std::vector<glm::quat> q(count), out_q(count);
+    std::vector<float> scalars(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        a[i] = glm::vec3(coordinate(rng), coordinate(rng), coordinate(rng));
+        b[i] = glm::vec3(coordinate(rng), coordinate(rng), coordinate(rng));
+        q[i] = glm::quat(coordinate(rng), coordinate(rng), coordinate(rng), coordinate(rng));
+    }
+    glm::soa_vec3 soa_a(a.data(), count), soa_b(b.data(), count), soa_out(count);
+    glm::soa_quat soa_q(q.data(), count), soa_out_q(count);
+    glm::mat4 model = glm::translate(glm::rotate(glm::mat4(1.0f), 0.7f, glm::vec3(0.3f, 1.0f, 0.2f)), glm::vec3(1.0f, 2.0f, 3.0f));
+
+    std::cout << "kernels: " << glm::simdDispatchName(glm::simdDispatch()) << std::endl;
+    BenchLoop bench(count, repeats, "ns per element");
+    auto time = [&](const char *name, auto &&kernel, auto &&checksum) { bench.run(name, kernel, checksum); };
+    auto vec3_sum = [&](std::size_t i) { return out[i].x + out[i].y + out[i].z; };
+    auto quat_sum = [&](std::size_t i) { return out_q[i].x + out_q[i].w; };
+    auto soa_sum = [&](std::size_t i) { return soa_out.x()[i] + soa_out.y()[i] + soa_out.z()[i]; };
+    auto soa_quat_sum = [&](std::size_t i) { return soa_out_q.x()[i] + soa_out_q.w()[i]; };
+    auto scalar_sum = [&](std::size_t i) { return scalars[i]; };
+
+    time("dot vec3, per element", [&] { for (std::size_t i = 0; i < count; i++) scalars[i] = glm::dot(a[i], b[i]); }, scalar_sum);
+    time("dot vec3, dotArray", [&] { glm::dotArray(a.data(), b.data(), scalars.data(), count); }, scalar_sum);
+    time("dot vec3, soa_vec3", [&] { glm::dot(soa_a, soa_b, scalars.data()); }, scalar_sum);
+    time("cross vec3, per element", [&] { for (std::size_t i = 0; i < count; i++) out[i] = glm::cross(a[i], b[i]); }, vec3_sum);
+    time("cross vec3, crossArray", [&] { glm::crossArray(a.data(), b.data(), out.data(), count); }, vec3_sum);
+    time("cross vec3, soa_vec3", [&] { glm::cross(soa_a, soa_b, soa_out); }, soa_sum);
+    time("normalize vec3, per element", [&] { for (std::size_t i = 0; i < count; i++) out[i] = glm::normalize(a[i]); }, vec3_sum);
+    time("normalize vec3, normalizeArray", [&] { glm::normalizeArray(a.data(), out.data(), count); }, vec3_sum);
+    time("normalize vec3, soa_vec3", [&] { glm::normalize(soa_a, soa_out); }, soa_sum);
+    time("normalize quat, per element", [&] { for (std::size_t i = 0; i < count; i++) out_q[i] = glm::normalize(q[i]); }, quat_sum);
+    time("normalize quat, soa_quat", [&] { glm::normalize(soa_q, soa_out_q); }, soa_quat_sum);
+    time("transform point, per element", [&] { for (std::size_t i = 0; i < count; i++) out[i] = glm::vec3(model * glm::vec4(a[i], 1.0f)); }, vec3_sum);
+    time("transform point, transformAffineArray", [&] { glm::transformAffineArray(model, a.data(), out.data(), count); }, vec3_sum);
+    time("transform point, soa_vec3", [&] { glm::transform(model, soa_a, soa_out); }, soa_sum);
+    time("vec3 array to soa_vec3", [&] { soa_out.assign(a.data(), count); }, soa_sum);
+    time("soa_vec3 to vec3 array", [&] { soa_a.copyTo(out.data()); }, vec3_sum);
+    time("scale soa_vec3 through iterators", [&] { std::copy(soa_a.begin(), soa_a.end(), soa_out.begin()); for (glm::soa_vec3::iterator it = soa_out.begin(); it != soa_out.end(); ++it) *it *= 0.5f; }, soa_sum);
+    return 0;
+}
+
+// quaternion array benchmark: slerp, nlerp, product, vector rotation and mat4 / mat3x4 casts of 4096 joint orientations,
+// as a loop calling the core function per element, through GLM_GTX_quaternion_array on quat arrays, and on soa_quat
+// containers where there is an overload. Checksums of one function should agree to about 6 digits
+// ----------------------------------------------------------------------------------------------------------------------
+int runQuaternionArrayBenchmark()
+{
+    const std::size_t count = 4096;
+    const int repeats = 1024;
+
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> component(-1.0f, 1.0f);
+    std::vector<glm::quat> a(count), b(count), out(count);
+    std::vector<glm::vec3> v(count), out_v(count);
+    std::vector<glm::mat4> out_m4(count);
+    std::vector<glm::mat3x4> out_m34(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        a[i] = glm::normalize(glm::quat(component(rng), component(rng), component(rng), component(rng)));
+        // the next key of an animation: a small rotation away
+        b[i] = glm::normalize(a[i] * glm::angleAxis(0.2f * component(rng), glm::normalize(glm::vec3(component(rng), component(rng), component(rng)))));
+        v[i] = glm::vec3(component(rng), component(rng), component(rng)) * 10.0f;
+    }
+    glm::soa_quat soa_a(a.data(), count), soa_b(b.data(), count), soa_out(count);
+    glm::soa_vec3 soa_v(v.data(), count), soa_out_v(count);
+    const float t = 0.3f;
+
+    std::cout << "kernels: " << glm::simdDispatchName(glm::simdDispatch()) << std::endl;
+    BenchLoop bench(count, repeats, "ns per quaternion");
+    auto time = [&](const char *name, auto &&kernel, auto &&checksum) { bench.run(name, kernel, checksum); };
+    auto quat_sum = [&](std::size_t i) { return out[i].x + out[i].w; };
+    auto soa_quat_sum = [&](std::size_t i) { return soa_out.x()[i] + soa_out.w()[i]; };
+    auto vec3_sum = [&](std::size_t i) { return out_v[i].x + out_v[i].y + out_v[i].z; };
+    auto soa_vec3_sum = [&](std::size_t i) { return soa_out_v.x()[i] + soa_out_v.y()[i] + soa_out_v.z()[i]; };
+    auto mat4_sum = [&](std::size_t i) { return out_m4[i][0][1] + out_m4[i][2][0]; };
+    auto mat3x4_sum = [&](std::size_t i) { return out_m34[i][1][0] + out_m34[i][0][2] + out_m34[i][2][3]; };
+
+    time("slerp, per element", [&] { for (std::size_t i = 0; i < count; i++) out[i] = glm::slerp(a[i], b[i], t); }, quat_sum);
+    time("slerp, slerpArray", [&] { glm::slerpArray(a.data(), b.data(), t, out.data(), count); }, quat_sum);
+    time("slerp, soa_quat", [&] { glm::slerp(soa_a, soa_b, t, soa_out); }, soa_quat_sum);
+    time("nlerp, per element", [&] { for (std::size_t i = 0; i < count; i++) out[i] = glm::normalize(glm::lerp(a[i], glm::dot(a[i], b[i]) < 0.0f ? -b[i] : b[i], t)); }, quat_sum);
+    time("nlerp, nlerpArray", [&] { glm::nlerpArray(a.data(), b.data(), t, out.data(), count); }, quat_sum);
+    time("nlerp, soa_quat", [&] { glm::nlerp(soa_a, soa_b, t, soa_out); }, soa_quat_sum);
+    time("multiply, per element", [&] { for (std::size_t i = 0; i < count; i++) out[i] = a[i] * b[i]; }, quat_sum);
+    time("multiply, mulArray", [&] { glm::mulArray(a.data(), b.data(), out.data(), count); }, quat_sum);
+    time("multiply, soa_quat", [&] { glm::mul(soa_a, soa_b, soa_out); }, soa_quat_sum);
+    time("rotate vec3, per element", [&] { for (std::size_t i = 0; i < count; i++) out_v[i] = a[i] * v[i]; }, vec3_sum);
+    time("rotate vec3, rotateArray", [&] { glm::rotateArray(a.data(), v.data(), out_v.data(), count); }, vec3_sum);
+    time("rotate vec3, soa_quat", [&] { glm::rotate(soa_a, soa_v, soa_out_v); }, soa_vec3_sum);
+    time("mat4_cast, per element", [&] { for (std::size_t i = 0; i < count; i++) out_m4[i] = glm::mat4_cast(a[i]); }, mat4_sum);
+    time("mat4_cast, mat4_castArray", [&] { glm::mat4_castArray(a.data(), out_m4.data(), count); }, mat4_sum);
+    time("mat3x4 pose, per element", [&]
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            glm::mat4 pose = glm::mat4_cast(a[i]);
+            pose[3] = glm::vec4(v[i], 1.0f);
+            out_m34[i] = glm::mat3x4_cast(pose);
+        }
+    }, mat3x4_sum);
+    time("mat3x4 pose, mat3x4_castArray", [&] { glm::mat3x4_castArray(a.data(), v.data(), out_m34.data(), count); }, mat3x4_sum);
+    return 0;
+}
+
+// packet intersection benchmark: 4096 rays from a pinhole camera against 256 triangles and 256 boxes scattered in front
+// of it, every ray against every primitive. The scalar GLM_GTX_intersect functions run one ray and one primitive per
+// call, GLM_GTX_intersect_packet 4 or 8 rays against one primitive and one ray against 4 or 8 primitives. Rates are
+// rays through all 256 primitives per second; the checksum counts the hits and should agree between widths
+// ----------------------------------------------------------------------------------------------------------------------
+int runPacketBenchmark()
+{
+    const int side = 64;
+    const std::size_t ray_count = std::size_t(side) * side;
+    const std::size_t primitive_count = 256;
+    const int repeats = 8;
+
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f), extent(0.1f, 0.5f);
+    const glm::vec3 eye(0.0f, 0.0f, 5.0f);
+    std::vector<glm::vec3> dirs(ray_count), dir_invs(ray_count);
+    for (std::size_t i = 0; i < ray_count; i++)
+    {
+        glm::vec2 film = (glm::vec2(float(i % side), float(i / side)) + 0.5f) / float(side) * 2.0f - 1.0f;
+        dirs[i] = glm::normalize(glm::vec3(film, -2.0f));
+        dir_invs[i] = 1.0f / dirs[i];
+    }
+    std::vector<glm::vec3> v0(primitive_count), v1(primitive_count), v2(primitive_count);
+    std::vector<glm::vec3> box_min(primitive_count), box_max(primitive_count);
+    for (std::size_t i = 0; i < primitive_count; i++)
+    {
+        glm::vec3 center(4.0f * unit(rng), 4.0f * unit(rng), 2.0f * unit(rng) - 2.0f);
+        v0[i] = center + 0.5f * glm::vec3(unit(rng), unit(rng), unit(rng));
+        v1[i] = center + 0.5f * glm::vec3(unit(rng), unit(rng), unit(rng));
+        v2[i] = center + 0.5f * glm::vec3(unit(rng), unit(rng), unit(rng));
+        glm::vec3 half(extent(rng), extent(rng), extent(rng));
+        box_min[i] = center - half;
+        box_max[i] = center + half;
+    }
+
+    // 8 lanes fall back to the scalar functions per lane unless the build targets AVX (-mavx or wider)
+    std::cout << "4 lanes: " << (GLM_ARCH & GLM_ARCH_SSE2_BIT ? "SSE2" : "scalar") << ", 8 lanes: "
+              << (GLM_ARCH & GLM_ARCH_AVX_BIT ? "AVX" : "scalar") << std::endl;
+    auto time = [&](const char *name, auto &&pass)
+    {
+        std::size_t hits = 0;
+        double seconds = benchSeconds(repeats, [&]() { hits = pass(); });
+        benchReport(name, ray_count / seconds / 1e6, "M rays/s", double(hits));
+    };
+    auto lane_hits = [](int mask) { return std::bitset<32>(unsigned(mask)).count(); };
+
+    time("ray/triangle, scalar", [&]()
+    {
+        std::size_t hits = 0;
+        for (std::size_t r = 0; r < ray_count; r++)
+            for (std::size_t t = 0; t < primitive_count; t++)
+            {
+                glm::vec2 bary;
+                float distance;
+                hits += glm::intersectRayTriangle(eye, dirs[r], v0[t], v1[t], v2[t], bary, distance);
+            }
+        return hits;
+    });
+    time("ray/AABB, scalar", [&]()
+    {
+        std::size_t hits = 0;
+        for (std::size_t r = 0; r < ray_count; r++)
+            for (std::size_t b = 0; b < primitive_count; b++)
+            {
+                float distance;
+                hits += glm::intersectRayAABB(eye, dir_invs[r], box_min[b], box_max[b], distance);
+            }
+        return hits;
+    });
+
+    // the same rays and primitives repacked L to a packet
+    auto packets = [&](auto lanes, const char *ray_triangle, const char *ray_box, const char *triangle_packet, const char *box_packet)
+    {
+        const glm::length_t L = decltype(lanes)::value;
+        std::vector<glm::vec3_packet<L>> origins(ray_count / L), directions(ray_count / L), inverses(ray_count / L);
+        for (std::size_t r = 0; r < ray_count; r++)
+        {
+            origins[r / L].set(glm::length_t(r % L), eye);
+            directions[r / L].set(glm::length_t(r % L), dirs[r]);
+            inverses[r / L].set(glm::length_t(r % L), dir_invs[r]);
+        }
+        std::vector<glm::vec3_packet<L>> p0(primitive_count / L), p1(primitive_count / L), p2(primitive_count / L);
+        std::vector<glm::vec3_packet<L>> packet_min(primitive_count / L), packet_max(primitive_count / L);
+        for (std::size_t t = 0; t < primitive_count; t++)
+        {
+            p0[t / L].set(glm::length_t(t % L), v0[t]);
+            p1[t / L].set(glm::length_t(t % L), v1[t]);
+            p2[t / L].set(glm::length_t(t % L), v2[t]);
+            packet_min[t / L].set(glm::length_t(t % L), box_min[t]);
+            packet_max[t / L].set(glm::length_t(t % L), box_max[t]);
+        }
+
+        time(ray_triangle, [&]()
+        {
+            std::size_t hits = 0;
+            glm::triangle_hit_packet<L> hit = {};
+            for (std::size_t r = 0; r < origins.size(); r++)
+                for (std::size_t t = 0; t < primitive_count; t++)
+                    hits += lane_hits(glm::intersectRayTriangle(origins[r], directions[r], v0[t], v1[t], v2[t], hit));
+            return hits;
+        });
+        time(ray_box, [&]()
+        {
+            std::size_t hits = 0;
+            float distance[L];
+            for (std::size_t r = 0; r < origins.size(); r++)
+                for (std::size_t b = 0; b < primitive_count; b++)
+                    hits += lane_hits(glm::intersectRayAABB(origins[r], inverses[r], box_min[b], box_max[b], distance));
+            return hits;
+        });
+        time(triangle_packet, [&]()
+        {
+            std::size_t hits = 0;
+            glm::triangle_hit_packet<L> hit = {};
+            for (std::size_t r = 0; r < ray_count; r++)
+                for (std::size_t t = 0; t < p0.size(); t++)
+                    hits += lane_hits(glm::intersectRayTriangle(eye, dirs[r], p0[t], p1[t], p2[t], hit));
+            return hits;
+        });
+        time(box_packet, [&]()
+        {
+            std::size_t hits = 0;
+            float distance[L];
+            for (std::size_t r = 0; r < ray_count; r++)
+                for (std::size_t b = 0; b < packet_min.size(); b++)
+                    hits += lane_hits(glm::intersectRayAABB(eye, dir_invs[r], packet_min[b], packet_max[b], distance));
+            return hits;
+        });
+    };
+    packets(std::integral_constant<glm::length_t, 4>(), "ray/triangle, 4 rays per call", "ray/AABB, 4 rays per call",
+            "ray/triangle, 4 triangles per call", "ray/AABB, 4 boxes per call");
+    packets(std::integral_constant<glm::length_t, 8>(), "ray/triangle, 8 rays per call", "ray/AABB, 8 rays per call",
+            "ray/triangle, 8 triangles per call", "ray/AABB, 8 boxes per call");
+    return 0;
+}
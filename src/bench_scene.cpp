@@ -0,0 +1,563 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_aligned.hpp>
+#include <glm/gtx/easing.hpp>
+#include <glm/gtx/intersect.hpp>
+#include <glm/gtx/simd_dispatch.hpp>
+#include <glm/gtx/spline.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "animation.h"
+#include "bench.h"
+#include "bvh.h"
+#include "ecs.h"
+#include "frame_arena.h"
+#include "job_system.h"
+#include "scene.h"
+#include "skinning.h"
+#include "terrain.h"
+#include "transform_hierarchy.h"
+#include "voxel_mesher.h"
+#include "voxel_world.h"
+
+// transform benchmark: a million node hierarchy with random parents, updated with 1% of the nodes
+// changed and then with all of them changed, on 1, 2, 4 ... threads and on all of them
+// -------------------------------------------------------------------------------------------
+int runTransformBenchmark()
+{
+    const std::size_t node_count = 1000000;
+    const std::size_t root_count = 1000;
+    const int frames = 10;
+    std::mt19937 rng(1);
+
+    TransformHierarchy hierarchy;
+    hierarchy.reserve(node_count);
+    for (std::size_t i = 0; i < node_count; i++)
+    {
+        TransformHierarchy::Node parent = i < root_count ? TransformHierarchy::NO_PARENT : (TransformHierarchy::Node)(rng() % i);
+        hierarchy.add(parent, glm::vec3((float)(i % 7), 0.5f, 0.0f), glm::angleAxis(0.01f * i, glm::vec3(0.0f, 1.0f, 0.0f)));
+    }
+    hierarchy.update();
+
+    unsigned int maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    // powers of two, then maxThreads itself when it is not one
+    for (unsigned int threads = 1; threads <= maxThreads; threads = threads < maxThreads ? std::min(threads * 2, maxThreads) : threads + 1)
+    {
+        JobSystem jobs(threads);
+        for (std::size_t changed : {node_count / 100, node_count})
+        {
+            double total = 0.0;
+            std::size_t updated = 0;
+            for (int frame = 0; frame < frames; frame++)
+            {
+                glm::quat rotation = glm::angleAxis(0.1f * frame, glm::vec3(0.0f, 0.0f, 1.0f));
+                for (std::size_t i = 0; i < changed; i++)
+                    hierarchy.setRotation(changed == node_count ? (TransformHierarchy::Node)i : (TransformHierarchy::Node)(rng() % node_count), rotation);
+
+                auto start = std::chrono::steady_clock::now();
+                hierarchy.update(&jobs);
+                total += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+                updated += hierarchy.updatedCount();
+            }
+            std::cout << threads << " thread(s), " << changed << " nodes changed: " << total / frames << " ms/update, "
+                      << updated / frames << " world matrices recomputed" << std::endl;
+        }
+    }
+    return 0;
+}
+
+// ECS benchmark: the same scene objects once as an array of structs and once as entities, timed over two
+// systems, one reading and writing two small components and one touching three including the transform
+// -------------------------------------------------------------------------------------------
+int runEcsBenchmark()
+{
+    struct SceneObject
+    {
+        Transform transform;
+        Spin spin;
+        Bounds bounds;
+        Renderable renderable;
+    };
+    const std::size_t object_count = 500000;
+    const int passes = 10;
+
+    std::vector<SceneObject> objects(object_count);
+    World world;
+    for (std::size_t i = 0; i < object_count; i++)
+    {
+        SceneObject &object = objects[i];
+        object.transform = Transform();
+        object.spin = {glm::aligned_vec4((float)(i % 1000), (float)(i / 1000), 0.0f, 0.0f), glm::aligned_vec4(0.0f, 1.0f, 0.0f, 0.001f * i)};
+        object.bounds = {glm::aligned_vec4(object.spin.position.x, object.spin.position.y, 0.0f, 0.52f)};
+        object.renderable = {nullptr, nullptr, 6};     // never drawn, only carried along
+        world.create(object.transform, object.spin, object.bounds, object.renderable);
+    }
+
+    auto time_passes = [&](const char *name, auto &&pass)
+    {
+        benchReport(name, object_count / benchSeconds(passes, pass) / 1e6, "M entities/s");
+    };
+
+    const float dt = 0.01f;
+    time_passes("drift, array of structs", [&]()
+    {
+        for (SceneObject &object : objects)
+            object.bounds.sphere += object.spin.axisPhase * dt;
+    });
+    time_passes("drift, ECS chunks", [&]()
+    {
+        world.each<Spin, Bounds>([&](std::size_t count, const Entity *, Spin *spins, Bounds *bounds)
+        {
+            for (std::size_t i = 0; i < count; i++)
+                bounds[i].sphere += spins[i].axisPhase * dt;
+        });
+    });
+
+    auto animate = [](const Spin &spin, Transform &transform, Bounds &bounds)
+    {
+        glm::mat4 model = glm::translate(glm::mat4(1.0f), glm::vec3(spin.position));
+        model = glm::rotate(model, spin.axisPhase.w, glm::vec3(spin.axisPhase));
+        transform.model = glm::aligned_mat4(model);
+        bounds.sphere = glm::aligned_vec4(glm::vec3(model[3]), bounds.sphere.w);
+    };
+    time_passes("animate, array of structs", [&]()
+    {
+        for (SceneObject &object : objects)
+            animate(object.spin, object.transform, object.bounds);
+    });
+    time_passes("animate, ECS chunks", [&]()
+    {
+        world.each<Spin, Transform, Bounds>([&](std::size_t count, const Entity *, Spin *spins, Transform *transforms, Bounds *bounds)
+        {
+            for (std::size_t i = 0; i < count; i++)
+                animate(spins[i], transforms[i], bounds[i]);
+        });
+    });
+
+    // keep the results alive, both layouts ran the same math so the sums agree
+    double ecs_sum = 0.0, aos_sum = 0.0;
+    world.each<Bounds>([&](std::size_t count, const Entity *, Bounds *bounds)
+    {
+        for (std::size_t i = 0; i < count; i++)
+            ecs_sum += bounds[i].sphere.x;
+    });
+    for (const SceneObject &object : objects)
+        aos_sum += object.bounds.sphere.x;
+    std::cout << "checksum " << ecs_sum << " / " << aos_sum << std::endl;
+    return 0;
+}
+
+
+// pick benchmark: mouse picking on a 2M triangle terrain, a 1000 x 1000 quad grid displaced by fractal noise, with
+// rays from a camera over one edge through random pixels of an 800 x 800 view, unprojected as the viewer does. Times
+// the BVH build, then every pick on its own for the mean and the slowest, and checks the first few against a loop
+// over every triangle
+// ---------------------------------------------------------------------------------------------------------------------
+int runPickBenchmark()
+{
+    const int cells = 1000;
+    const int side = cells + 1;
+    const int ray_count = 10000;
+    const int brute_force_count = 16;
+
+    JobSystem jobs;
+    glm::noise_fractal hills(5, 1.0f / 64.0f);
+    std::vector<float> heights(std::size_t(side) * side);
+    fillHeightmap(jobs, hills, glm::vec2(0.0f), 1.0f, side, side, heights.data());
+    std::vector<float> vertices(heights.size() * 3);
+    for (std::size_t i = 0; i < heights.size(); i++)
+    {
+        vertices[i * 3] = float(i % side);
+        vertices[i * 3 + 1] = 40.0f * heights[i];
+        vertices[i * 3 + 2] = float(i / side);
+    }
+    std::vector<unsigned int> indices;
+    indices.reserve(std::size_t(cells) * cells * 6);
+    for (int z = 0; z < cells; z++)
+        for (int x = 0; x < cells; x++)
+        {
+            unsigned int a = z * side + x, b = a + 1, c = a + side, d = c + 1;
+            indices.insert(indices.end(), {a, c, b, b, c, d});
+        }
+    const std::size_t triangle_count = indices.size() / 3;
+
+    Bvh bvh;
+    double build_seconds = benchSeconds(1, [&]() { bvh.build(vertices.data(), heights.size(), indices.data(), triangle_count); });
+    std::cout << triangle_count << " triangles, " << bvh.nodeCount() << " nodes" << std::endl;
+    benchReport("build", build_seconds * 1000.0, "ms");
+
+    glm::mat4 view = glm::lookAt(glm::vec3(cells * 0.5f, 150.0f, -100.0f), glm::vec3(cells * 0.5f, 0.0f, cells * 0.5f), glm::vec3(0.0f, 1.0f, 0.0f));
+    glm::mat4 projection = glm::perspective(glm::radians(45.0f), 1.0f, 0.1f, 5000.0f);
+    glm::vec4 viewport(0.0f, 0.0f, 800.0f, 800.0f);
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> pixel(0.0f, 800.0f);
+    std::vector<glm::vec3> origins(ray_count), dirs(ray_count);
+    for (int i = 0; i < ray_count; i++)
+    {
+        glm::vec2 win(pixel(rng), pixel(rng));
+        origins[i] = glm::unProject(glm::vec3(win, 0.0f), view, projection, viewport);
+        dirs[i] = glm::unProject(glm::vec3(win, 1.0f), view, projection, viewport) - origins[i];
+    }
+
+    std::vector<BvhHit> hits(ray_count);
+    double total = 0.0, slowest = 0.0;
+    int hit_count = 0;
+    for (int i = 0; i < ray_count; i++)
+    {
+        double seconds = benchSeconds(1, [&]() { hit_count += bvh.intersect(origins[i], dirs[i], hits[i]); });
+        total += seconds;
+        slowest = std::max(slowest, seconds);
+    }
+    double distances = benchChecksum(ray_count, [&](std::size_t i) { return hits[i].distance; });
+    std::cout << hit_count << " of " << ray_count << " rays hit" << std::endl;
+    benchReport("BVH pick, mean", total / ray_count * 1e6, "us", distances);
+    benchReport("BVH pick, slowest", slowest * 1000.0, "ms");
+
+    // the same closest hit, by distance: rays through a shared edge may report either triangle
+    int agree = 0;
+    double brute_force_seconds = benchSeconds(brute_force_count, [&, ray = 0]() mutable
+    {
+        float best = std::numeric_limits<float>::max();
+        for (std::size_t t = 0; t < triangle_count; t++)
+        {
+            const glm::vec3 *p = reinterpret_cast<const glm::vec3 *>(vertices.data());
+            const unsigned int *tri = &indices[t * 3];
+            glm::vec2 bary;
+            float distance;
+            if (glm::intersectRayTriangle(origins[ray], dirs[ray], p[tri[0]], p[tri[1]], p[tri[2]], bary, distance)
+                && distance > 0.0f && distance < best)
+                best = distance;
+        }
+        bool missed = best == std::numeric_limits<float>::max();
+        agree += missed ? hits[ray].triangle < 0 : std::abs(best - hits[ray].distance) <= 1e-5f * best;
+        ray++;
+    });
+    benchReport("brute force pick, mean", brute_force_seconds * 1000.0, "ms");
+    std::cout << "BVH and brute force agree on " << agree << " of " << brute_force_count << " rays" << std::endl;
+    return 0;
+}
+
+// voxel benchmark: meshes every chunk of the terrain with the greedy mesher and with the per-cube baselines,
+// then carves a crater and remeshes only the chunks it dirtied
+// -------------------------------------------------------------------------------------------
+int runVoxelBenchmark()
+{
+    JobSystem jobs;
+    VoxelWorld world;
+    buildVoxelTerrain(world, jobs, 8, 8);
+    std::vector<ChunkCoord> coords;
+    world.takeDirty(coords);
+    std::vector<ChunkSnapshot> snapshots(coords.size());
+    for (std::size_t i = 0; i < coords.size(); i++)
+        world.snapshot(coords[i], snapshots[i]);
+
+    std::vector<std::vector<VoxelVertex>> meshes(coords.size());
+    std::vector<double> chunk_ms(coords.size());
+    auto mesh_all = [&](const char *name, int mode)
+    {
+        auto start = std::chrono::steady_clock::now();
+        jobs.parallelFor(coords.size(), 1, [&](std::size_t begin, std::size_t end)
+        {
+            for (std::size_t i = begin; i < end; i++)
+            {
+                auto chunk_start = std::chrono::steady_clock::now();
+                meshes[i].clear();
+                if (mode == 0)
+                    greedyMesh(snapshots[i], meshes[i]);
+                else
+                    naiveMesh(snapshots[i], mode == 1, meshes[i]);
+                chunk_ms[i] = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - chunk_start).count();
+            }
+        });
+        double wall = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        double sum = 0.0;
+        std::size_t triangles = 0;
+        for (std::size_t i = 0; i < coords.size(); i++)
+        {
+            sum += chunk_ms[i];
+            triangles += meshes[i].size() / 3;
+        }
+        std::cout << name << ": " << sum / coords.size() << " ms/chunk, " << wall << " ms for " << coords.size()
+                  << " chunks on " << jobs.threadCount() << " thread(s), " << triangles << " triangles" << std::endl;
+    };
+    mesh_all("naive, every cube face", 2);
+    mesh_all("naive, hidden faces culled", 1);
+    mesh_all("greedy", 0);
+
+    carveVoxelSphere(world, glm::ivec3(100, 20, 100), 10);
+    coords.clear();
+    world.takeDirty(coords);
+    auto start = std::chrono::steady_clock::now();
+    jobs.parallelFor(coords.size(), 1, [&](std::size_t begin, std::size_t end)
+    {
+        for (std::size_t i = begin; i < end; i++)
+        {
+            world.snapshot(coords[i], snapshots[i]);
+            meshes[i].clear();
+            greedyMesh(snapshots[i], meshes[i]);
+        }
+    });
+    std::cout << "crater: " << coords.size() << " of " << world.chunkCount() << " chunks remeshed in "
+              << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() << " ms" << std::endl;
+    return 0;
+}
+
+// skinning benchmark: a 1M vertex tube bent and twisted by a chain of 64 joints, every vertex weighted between the four
+// joints nearest along the tube. Each mode is skinned per vertex with the glm dualquat / mat3x4 operators, in one call
+// of the batched gtx/skinning kernels on this thread, and split over the job system as SkinnedMeshRenderer does.
+// Checksums of one mode should agree to about 5 digits; linear blending comes out lower, it shrinks the twisted tube
+// ---------------------------------------------------------------------------------------------------------------------
+int runSkinningBenchmark()
+{
+    const int joint_count = 64;
+    const int rings = 4096, ring_size = 256;
+    const std::size_t count = std::size_t(rings) * ring_size;
+    const float length = 16.0f;
+    const int repeats = 8;
+
+    SkinnedMesh mesh;
+    buildSkinnedTube(joint_count, rings, ring_size, length, mesh);
+
+    // every joint bends a little and twists a lot about its own position on the tube
+    std::vector<glm::quat> rotations(joint_count);
+    std::vector<glm::vec3> translations(joint_count);
+    poseSkinnedTube(joint_count, length, 0.05f, 0.3f, rotations.data(), translations.data());
+    SkinningPalette palette;
+    palette.build(rotations.data(), translations.data(), joint_count);
+
+    JobSystem jobs;
+    std::vector<glm::vec3> positions(count), normals(count);
+    std::cout << "kernels: " << glm::simdDispatchName(glm::simdDispatch()) << ", " << jobs.threadCount() << " thread(s)" << std::endl;
+    auto time = [&](const char *name, auto &&kernel)
+    {
+        kernel();
+        double seconds = benchSeconds(repeats, kernel);
+        benchReport(name, count / seconds / 1e6, "M vertices/s", benchChecksum(count, [&](std::size_t i)
+        {
+            return glm::dot(positions[i], positions[i]) + normals[i].y;
+        }, 97));
+    };
+
+    time("dual quaternion, per vertex", [&]
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            glm::dualquat blend = palette.dualQuats[mesh.joints[i].x] * mesh.weights[i].x;
+            for (int k = 1; k < 4; k++)
+            {
+                const glm::dualquat &joint = palette.dualQuats[mesh.joints[i][k]];
+                blend = blend + joint * (glm::dot(joint.real, blend.real) < 0.0f ? -mesh.weights[i][k] : mesh.weights[i][k]);
+            }
+            blend = glm::normalize(blend);
+            positions[i] = blend * mesh.positions[i];
+            normals[i] = blend.real * mesh.normals[i];
+        }
+    });
+    time("dual quaternion, skinDualQuatArray", [&]
+    {
+        glm::skinDualQuatArray(palette.dualQuats.data(), mesh.joints.data(), mesh.weights.data(), mesh.positions.data(),
+                               mesh.normals.data(), positions.data(), normals.data(), count);
+    });
+    time("dual quaternion, job system", [&] { skinMesh(jobs, SkinningMode::DualQuaternion, palette, mesh, positions.data(), normals.data()); });
+    time("linear blend, per vertex", [&]
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            glm::mat3x4 blend = palette.matrices[mesh.joints[i].x] * mesh.weights[i].x;
+            for (int k = 1; k < 4; k++)
+                blend += palette.matrices[mesh.joints[i][k]] * mesh.weights[i][k];
+            positions[i] = glm::vec4(mesh.positions[i], 1.0f) * blend;
+            normals[i] = glm::normalize(glm::vec4(mesh.normals[i], 0.0f) * blend);
+        }
+    });
+    time("linear blend, skinLinearArray", [&]
+    {
+        glm::skinLinearArray(palette.matrices.data(), mesh.joints.data(), mesh.weights.data(), mesh.positions.data(),
+                             mesh.normals.data(), positions.data(), normals.data(), count);
+    });
+    time("linear blend, job system", [&] { skinMesh(jobs, SkinningMode::Linear, palette, mesh, positions.data(), normals.data()); });
+    return 0;
+}
+
+// animation benchmark: a 128 joint clip of 4 seconds with a key every 1/30 s or so, rotations eased or linear,
+// translations on Catmull-Rom curves, scales linear. 256 instances at different times advance by 1/60 s per frame.
+// The per track loop samples the uncompressed keys the clip was built from with a binary search and the glm easing,
+// mix and catmullRom functions per track, the sampler runs the same on the compressed keys with a cached key per track
+// and the batched kernels, the scratch of each call on a frame arena. The errors are the key compression: 1 / 65535 of
+// a track's range for translations and scales, 1 / 32767 per quaternion component
+// ---------------------------------------------------------------------------------------------------------------------
+int runAnimationBenchmark()
+{
+    const int joint_count = 128;
+    const int instance_count = 256;
+    const int frames = 60;
+    const float clip_length = 4.0f;
+
+    // the source keys: irregular times, every joint swinging about its own axis
+    struct SourceTrack
+    {
+        std::vector<float> times;
+        std::vector<glm::quat> rotations;
+        std::vector<glm::vec3> values;
+        glm::easing_function easing;
+        CurveInterpolation interpolation;
+    };
+    std::vector<SourceTrack> rotation_tracks(joint_count), translation_tracks(joint_count), scale_tracks(joint_count);
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    auto key_times = [&](float spacing)
+    {
+        std::vector<float> times(1, 0.0f);
+        while (times.back() < clip_length)
+            times.push_back(std::min(times.back() + spacing * (0.5f + unit(rng)), clip_length));
+        return times;
+    };
+    AnimationClip clip(joint_count);
+    for (int j = 0; j < joint_count; j++)
+    {
+        SourceTrack &r = rotation_tracks[j];
+        r.times = key_times(1.0f / 30.0f);
+        r.easing = j % 3 == 0 ? glm::easing_cubic_in_out : glm::easing_linear;
+        glm::vec3 axis = glm::normalize(glm::vec3(unit(rng), unit(rng), unit(rng)) - 0.5f);
+        for (float t : r.times)
+            r.rotations.push_back(glm::angleAxis(1.5f * std::sin(3.0f * t + j), axis));
+        clip.setRotationKeys(j, r.times.data(), r.rotations.data(), r.times.size(), r.easing);
+
+        SourceTrack &p = translation_tracks[j];
+        p.times = key_times(1.0f / 15.0f);
+        p.easing = glm::easing_linear;
+        p.interpolation = CurveInterpolation::CatmullRom;
+        for (float t : p.times)
+            p.values.push_back(glm::vec3(0.0f, 0.2f, 0.0f) + 0.05f * glm::vec3(std::sin(2.0f * t), std::cos(5.0f * t + j), 0.0f));
+        clip.setTranslationKeys(j, p.times.data(), p.values.data(), p.times.size(), p.interpolation, p.easing);
+
+        SourceTrack &s = scale_tracks[j];
+        s.times = key_times(0.5f);
+        s.easing = glm::easing_sine_in_out;
+        s.interpolation = CurveInterpolation::Linear;
+        for (float t : s.times)
+            s.values.push_back(glm::vec3(1.0f + 0.1f * std::sin(t + j)));
+        clip.setScaleKeys(j, s.times.data(), s.values.data(), s.times.size(), s.interpolation, s.easing);
+    }
+
+    auto ease = [](glm::easing_function easing, float a)
+    {
+        switch (easing)
+        {
+        case glm::easing_cubic_in_out: return glm::cubicEaseInOut(a);
+        case glm::easing_sine_in_out: return glm::sineEaseInOut(a);
+        default: return a;
+        }
+    };
+    // the key at or before time and the eased fraction to the next one
+    auto locate = [&](const SourceTrack &track, float time, std::size_t &key, std::size_t &next)
+    {
+        std::size_t last = track.times.size() - 1;
+        key = std::upper_bound(track.times.begin(), track.times.end(), time) - track.times.begin();
+        key = key > 0 ? key - 1 : 0;
+        next = std::min(key + 1, last);
+        float span = track.times[next] - track.times[key];
+        return ease(track.easing, span > 0.0f ? glm::clamp((time - track.times[key]) / span, 0.0f, 1.0f) : 0.0f);
+    };
+    auto sample_curve = [&](const SourceTrack &track, float time)
+    {
+        std::size_t key, next;
+        float f = locate(track, time, key, next);
+        if (track.interpolation == CurveInterpolation::Linear)
+            return glm::mix(track.values[key], track.values[next], f);
+        std::size_t last = track.values.size() - 1;
+        return glm::catmullRom(track.values[key > 0 ? key - 1 : 0], track.values[key], track.values[next],
+                               track.values[std::min(key + 2, last)], f);
+    };
+    auto sample_tracks = [&](float time, Pose &pose)
+    {
+        for (int j = 0; j < joint_count; j++)
+        {
+            std::size_t key, next;
+            float f = locate(rotation_tracks[j], time, key, next);
+            glm::quat a = rotation_tracks[j].rotations[key], b = rotation_tracks[j].rotations[next];
+            if (glm::dot(a, b) < 0.0f)
+                b = -b;
+            pose.rotations[j] = glm::normalize(glm::lerp(a, b, f));
+            pose.translations[j] = sample_curve(translation_tracks[j], time);
+            pose.scales[j] = sample_curve(scale_tracks[j], time);
+        }
+    };
+
+    std::vector<float> phases(instance_count);
+    for (float &phase : phases)
+        phase = clip_length * unit(rng);
+    std::vector<Pose> poses(instance_count), reference(instance_count);
+    for (int i = 0; i < instance_count; i++)
+    {
+        poses[i].resize(joint_count);
+        reference[i].resize(joint_count);
+    }
+    std::vector<AnimationSampler> samplers(instance_count, AnimationSampler(clip));
+    auto time_of = [&](int instance, int frame) { return std::fmod(phases[instance] + frame / 60.0f, clip_length); };
+
+    JobSystem jobs;
+    FrameArenas arenas(jobs.threadCount());
+    std::cout << "kernels: " << glm::simdDispatchName(glm::simdDispatch()) << ", " << jobs.threadCount() << " thread(s), "
+              << clip.keyBytes() / 1024 << " KB of keys (" << clip.rawKeyBytes() / 1024 << " KB uncompressed)" << std::endl;
+    const double tracks = 3.0 * joint_count * instance_count * frames;
+    auto time = [&](const char *name, auto &&kernel)
+    {
+        int frame = 0;
+        double seconds = benchSeconds(frames, [&]() { kernel(frame++); });
+        benchReport(name, tracks / (seconds * frames * 1000.0), "tracks/ms");
+    };
+
+    time("per track", [&](int f)
+    {
+        for (int i = 0; i < instance_count; i++)
+            sample_tracks(time_of(i, f), reference[i]);
+    });
+    time("AnimationSampler", [&](int f)
+    {
+        for (int i = 0; i < instance_count; i++)
+            samplers[i].sample(time_of(i, f), poses[i], arenas.arena(0));
+    });
+    time("AnimationSampler, job system", [&](int f)
+    {
+        jobs.parallelFor(instance_count, 16, [&](std::size_t begin, std::size_t end)
+        {
+            FrameArena &scratch = arenas.arena(jobs.currentWorker());
+            for (std::size_t i = begin; i < end; i++)
+                samplers[i].sample(time_of(int(i), frames + f), poses[i], scratch);
+        });
+    });
+
+    // both end on the same frame of every instance
+    for (int i = 0; i < instance_count; i++)
+        sample_tracks(time_of(i, 2 * frames - 1), reference[i]);
+    float rotation_error = 0.0f, translation_error = 0.0f, scale_error = 0.0f;
+    for (int i = 0; i < instance_count; i++)
+        for (int j = 0; j < joint_count; j++)
+        {
+            rotation_error = std::max(rotation_error, 1.0f - std::abs(glm::dot(poses[i].rotations[j], reference[i].rotations[j])));
+            translation_error = std::max(translation_error, glm::distance(poses[i].translations[j], reference[i].translations[j]));
+            scale_error = std::max(scale_error, glm::distance(poses[i].scales[j], reference[i].scales[j]));
+        }
+    std::cout << "max error: rotation 1 - |dot| " << rotation_error << ", translation " << translation_error
+              << ", scale " << scale_error << std::endl;
+
+    Pose blended;
+    double seconds = benchSeconds(frames, [&]()
+    {
+        for (int i = 0; i + 1 < instance_count; i++)
+            blendPoses(poses[i], poses[i + 1], 0.25f, blended);
+    });
+    benchReport("blendPoses", double(joint_count) * (instance_count - 1) / (seconds * 1000.0), "joints/ms",
+                blended.rotations[0].w + blended.translations[0].y + blended.scales[0].x);
+    return 0;
+}
@@ -0,0 +1,274 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include "bvh.h"
+
+#include <glm/gtx/intersect.hpp>
+
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+    const int BIN_COUNT = 16;
+    const unsigned int MAX_LEAF_SIZE = 8;
+
+    // nodes this deep are forced to be leaves, whatever their size, which bounds the traversal stack: it holds at
+    // most one pending sibling per level plus the two children of the deepest inner node. skewed input, where the SAH
+    // peels a triangle or two off per split, does get this deep
+    const unsigned int MAX_DEPTH = 63;
+
+    struct Bounds
+    {
+        glm::vec3 bmin = glm::vec3(std::numeric_limits<float>::max());
+        glm::vec3 bmax = glm::vec3(-std::numeric_limits<float>::max());
+
+        void grow(const glm::vec3 &p)
+        {
+            bmin = glm::min(bmin, p);
+            bmax = glm::max(bmax, p);
+        }
+        void grow(const Bounds &b)
+        {
+            bmin = glm::min(bmin, b.bmin);
+            bmax = glm::max(bmax, b.bmax);
+        }
+        float area() const
+        {
+            glm::vec3 e = bmax - bmin;
+            return e.x < 0.0f ? 0.0f : e.x * e.y + e.y * e.z + e.z * e.x;
+        }
+    };
+
+    // slab test, returns the entry distance or +inf on a miss
+    inline float intersectBox(const glm::vec3 &origin, const glm::vec3 &invDir, const glm::vec3 &bmin, const glm::vec3 &bmax, float tmax)
+    {
+        glm::vec3 t0 = (bmin - origin) * invDir;
+        glm::vec3 t1 = (bmax - origin) * invDir;
+        glm::vec3 tnear = glm::min(t0, t1);
+        glm::vec3 tfar = glm::max(t0, t1);
+        float enter = std::max(std::max(tnear.x, tnear.y), std::max(tnear.z, 0.0f));
+        float exit = std::min(std::min(tfar.x, tfar.y), std::min(tfar.z, tmax));
+        return enter <= exit ? enter : std::numeric_limits<float>::infinity();
+    }
+}
+
+void Bvh::build(const float *vertices, std::size_t vertexCount, const unsigned int *triangleIndices, std::size_t triangleCount)
+{
+    positions.assign(reinterpret_cast<const glm::vec3 *>(vertices), reinterpret_cast<const glm::vec3 *>(vertices) + vertexCount);
+    indices.assign(triangleIndices, triangleIndices + triangleCount * 3);
+
+    std::vector<Primitive> primitives(triangleCount);
+    triangles.resize(triangleCount);
+    for (std::size_t i = 0; i < triangleCount; i++)
+    {
+        const glm::vec3 &v0 = positions[indices[i * 3]];
+        const glm::vec3 &v1 = positions[indices[i * 3 + 1]];
+        const glm::vec3 &v2 = positions[indices[i * 3 + 2]];
+        triangles[i] = static_cast<unsigned int>(i);
+        primitives[i].bmin = glm::min(v0, glm::min(v1, v2));
+        primitives[i].bmax = glm::max(v0, glm::max(v1, v2));
+        primitives[i].centroid = (v0 + v1 + v2) * (1.0f / 3.0f);
+    }
+
+    nodes.clear();
+    if (triangleCount == 0)
+        return;
+    nodes.reserve(triangleCount * 2);
+    Node root;
+    root.first = 0;
+    root.count = static_cast<unsigned int>(triangleCount);
+    nodes.push_back(root);
+    updateBounds(0);
+    subdivide(0, 0, primitives);
+}
+
+void Bvh::updateBounds(unsigned int nodeIndex)
+{
+    Node &node = nodes[nodeIndex];
+    Bounds b;
+    for (unsigned int i = node.first; i < node.first + node.count; i++)
+    {
+        const unsigned int *tri = &indices[triangles[i] * 3];
+        b.grow(positions[tri[0]]);
+        b.grow(positions[tri[1]]);
+        b.grow(positions[tri[2]]);
+    }
+    node.bmin = b.bmin;
+    node.bmax = b.bmax;
+}
+
+void Bvh::subdivide(unsigned int nodeIndex, unsigned int depth, const std::vector<Primitive> &primitives)
+{
+    const unsigned int first = nodes[nodeIndex].first;
+    const unsigned int count = nodes[nodeIndex].count;
+    if (count <= 2 || depth == MAX_DEPTH)
+        return;
+
+    Bounds centroidBounds;
+    for (unsigned int i = first; i < first + count; i++)
+        centroidBounds.grow(primitives[triangles[i]].centroid);
+
+    // evaluate the SAH at every bin boundary on all three axes
+    int bestAxis = -1;
+    int bestSplit = 0;
+    float bestCost = std::numeric_limits<float>::max();
+    for (int axis = 0; axis < 3; axis++)
+    {
+        float lo = centroidBounds.bmin[axis];
+        float extent = centroidBounds.bmax[axis] - lo;
+        if (extent <= 0.0f)
+            continue;
+
+        Bounds bins[BIN_COUNT];
+        unsigned int binCounts[BIN_COUNT] = {};
+        float scale = BIN_COUNT / extent;
+        for (unsigned int i = first; i < first + count; i++)
+        {
+            const Primitive &prim = primitives[triangles[i]];
+            int bin = std::min(BIN_COUNT - 1, static_cast<int>((prim.centroid[axis] - lo) * scale));
+            binCounts[bin]++;
+            bins[bin].grow(prim.bmin);
+            bins[bin].grow(prim.bmax);
+        }
+
+        float leftArea[BIN_COUNT - 1];
+        unsigned int leftCount[BIN_COUNT - 1];
+        Bounds sweep;
+        unsigned int sum = 0;
+        for (int i = 0; i < BIN_COUNT - 1; i++)
+        {
+            sweep.grow(bins[i]);
+            sum += binCounts[i];
+            leftArea[i] = sweep.area();
+            leftCount[i] = sum;
+        }
+        sweep = Bounds();
+        sum = 0;
+        for (int i = BIN_COUNT - 1; i > 0; i--)
+        {
+            sweep.grow(bins[i]);
+            sum += binCounts[i];
+            float cost = leftCount[i - 1] * leftArea[i - 1] + sum * sweep.area();
+            if (leftCount[i - 1] > 0 && sum > 0 && cost < bestCost)
+            {
+                bestCost = cost;
+                bestAxis = axis;
+                bestSplit = i;
+            }
+        }
+    }
+
+    Bounds nodeBounds;
+    nodeBounds.bmin = nodes[nodeIndex].bmin;
+    nodeBounds.bmax = nodes[nodeIndex].bmax;
+    float leafCost = count * nodeBounds.area();
+    if (bestAxis < 0 || (bestCost >= leafCost && count <= MAX_LEAF_SIZE))
+        return;
+
+    float lo = centroidBounds.bmin[bestAxis];
+    float scale = BIN_COUNT / (centroidBounds.bmax[bestAxis] - lo);
+    unsigned int *begin = &triangles[first];
+    unsigned int *middle = std::partition(begin, begin + count, [&](unsigned int tri)
+    {
+        return std::min(BIN_COUNT - 1, static_cast<int>((primitives[tri].centroid[bestAxis] - lo) * scale)) < bestSplit;
+    });
+    unsigned int leftCount = static_cast<unsigned int>(middle - begin);
+
+    unsigned int left = static_cast<unsigned int>(nodes.size());
+    Node child;
+    child.first = first;
+    child.count = leftCount;
+    nodes.push_back(child);
+    child.first = first + leftCount;
+    child.count = count - leftCount;
+    nodes.push_back(child);
+
+    nodes[nodeIndex].first = left;
+    nodes[nodeIndex].count = Node::INNER;
+    updateBounds(left);
+    updateBounds(left + 1);
+    subdivide(left, depth + 1, primitives);
+    subdivide(left + 1, depth + 1, primitives);
+}
+
+void Bvh::refit(const float *vertices)
+{
+    std::copy(reinterpret_cast<const glm::vec3 *>(vertices), reinterpret_cast<const glm::vec3 *>(vertices) + positions.size(), positions.begin());
+
+    // children are always allocated after their parent, so a reverse sweep visits them first
+    for (std::size_t i = nodes.size(); i-- > 0;)
+    {
+        Node &node = nodes[i];
+        if (node.isLeaf())
+        {
+            updateBounds(static_cast<unsigned int>(i));
+        }
+        else
+        {
+            const Node &left = nodes[node.first];
+            const Node &right = nodes[node.first + 1];
+            node.bmin = glm::min(left.bmin, right.bmin);
+            node.bmax = glm::max(left.bmax, right.bmax);
+        }
+    }
+}
+
+bool Bvh::intersect(const glm::vec3 &origin, const glm::vec3 &dir, BvhHit &hit) const
+{
+    if (nodes.empty())
+        return false;
+
+    glm::vec3 invDir = 1.0f / dir;
+    float best = std::numeric_limits<float>::max();
+    int bestTriangle = -1;
+    glm::vec2 bestBary(0.0f);
+
+    unsigned int stack[MAX_DEPTH + 1];
+    int top = 0;
+    if (intersectBox(origin, invDir, nodes[0].bmin, nodes[0].bmax, best) == std::numeric_limits<float>::infinity())
+        return false;
+    stack[top++] = 0;
+
+    while (top > 0)
+    {
+        const Node &node = nodes[stack[--top]];
+        if (node.isLeaf())
+        {
+            for (unsigned int i = node.first; i < node.first + node.count; i++)
+            {
+                const unsigned int *tri = &indices[triangles[i] * 3];
+                glm::vec2 bary;
+                float distance;
+                if (glm::intersectRayTriangle(origin, dir, positions[tri[0]], positions[tri[1]], positions[tri[2]], bary, distance)
+                    && distance > 0.0f && distance < best)
+                {
+                    best = distance;
+                    bestTriangle = static_cast<int>(triangles[i]);
+                    bestBary = bary;
+                }
+            }
+            continue;
+        }
+
+        // visit the nearer child first so the far one is usually culled by the shrinking best distance
+        unsigned int left = node.first;
+        unsigned int right = node.first + 1;
+        float tleft = intersectBox(origin, invDir, nodes[left].bmin, nodes[left].bmax, best);
+        float tright = intersectBox(origin, invDir, nodes[right].bmin, nodes[right].bmax, best);
+        if (tleft > tright)
+        {
+            std::swap(tleft, tright);
+            std::swap(left, right);
+        }
+        if (tright != std::numeric_limits<float>::infinity())
+            stack[top++] = right;
+        if (tleft != std::numeric_limits<float>::infinity())
+            stack[top++] = left;
+    }
+
+    if (bestTriangle < 0)
+        return false;
+    hit.triangle = bestTriangle;
+    hit.distance = best;
+    hit.bary = bestBary;
+    return true;
+}
@@ -0,0 +1,66 @@
+#ifndef BVH_H
+#define BVH_H
+
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <vector>
+
+// result of a ray query: triangle index into the original index buffer (index / 3),
+// distance along the ray and barycentric coordinates as returned by glm::intersectRayTriangle
+struct BvhHit
+{
+    int triangle = -1;
+    float distance = 0.0f;
+    glm::vec2 bary = glm::vec2(0.0f);
+};
+
+// bounding volume hierarchy over an indexed triangle list, built with the binned surface area heuristic.
+// the tree keeps its own copy of the vertex positions so refit() can follow animated meshes without a rebuild.
+class Bvh
+{
+public:
+    // vertices are tightly packed xyz floats, the same layout that goes into the VBO
+    void build(const float *vertices, std::size_t vertexCount, const unsigned int *indices, std::size_t triangleCount);
+
+    // update the vertex positions (same count and topology as build) and recompute every node bound bottom-up
+    void refit(const float *vertices);
+
+    // closest hit along origin + t * dir for t > 0; dir does not need to be normalized. an empty tree never hits
+    bool intersect(const glm::vec3 &origin, const glm::vec3 &dir, BvhHit &hit) const;
+
+    std::size_t nodeCount() const { return nodes.size(); }
+    std::size_t triangleCount() const { return triangles.size(); }
+
+private:
+    // 32 bytes: a leaf stores [first, first + count) into triangles, an inner node stores its left child
+    // in first, the right child is always first + 1, and INNER in count
+    struct Node
+    {
+        glm::vec3 bmin;
+        unsigned int first;
+        glm::vec3 bmax;
+        unsigned int count;
+
+        static const unsigned int INNER = ~0u;
+        bool isLeaf() const { return count != INNER; }
+    };
+
+    // per-triangle bounds and centroid, only alive during build()
+    struct Primitive
+    {
+        glm::vec3 bmin;
+        glm::vec3 bmax;
+        glm::vec3 centroid;
+    };
+
+    void updateBounds(unsigned int nodeIndex);
+    void subdivide(unsigned int nodeIndex, unsigned int depth, const std::vector<Primitive> &primitives);
+
+    std::vector<Node> nodes;
+    std::vector<unsigned int> triangles;   // triangle ids, reordered so every leaf is a contiguous range
+    std::vector<unsigned int> indices;
+    std::vector<glm::vec3> positions;
+};
+
+#endif
@@ -0,0 +1,132 @@
+#include "command_buffer.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+    std::size_t alignUp(std::size_t value, std::size_t alignment)
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    void countChange(unsigned int &counter, std::uint32_t &current, std::uint32_t next)
+    {
+        if (next != current)
+        {
+            current = next;
+            counter++;
+        }
+    }
+}
+
+void CommandList::draw(const DrawItem &item, const void *data, std::uint32_t uniformSize)
+{
+    std::size_t offset = alignUp(uniforms.size(), alignment);
+    uniforms.resize(offset + uniformSize);
+    std::memcpy(&uniforms[offset], data, uniformSize);
+
+    DrawPacket packet;
+    packet.key = makeSortKey(item.layer, item.program, item.material, item.vao, item.depth);
+    packet.program = item.program;
+    packet.vao = item.vao;
+    packet.material = item.material;
+    packet.uniformOffset = static_cast<std::uint32_t>(offset);
+    packet.uniformSize = uniformSize;
+    packet.firstIndex = item.firstIndex;
+    packet.indexCount = item.indexCount;
+    packet.instanceCount = item.instanceCount;
+    packets.push_back(packet);
+}
+
+void CommandList::reset()
+{
+    // the vectors' buffers live in the arena, let go of them before it is rewound
+    std::size_t packetCount = packets.size();
+    std::size_t uniformBytes = uniforms.size();
+    std::pmr::vector<DrawPacket>(&arena).swap(packets);
+    std::pmr::vector<unsigned char>(&arena).swap(uniforms);
+    arena.reset();
+    packets.reserve(packetCount);
+    uniforms.reserve(uniformBytes);
+}
+
+CommandBuffer::CommandBuffer(unsigned int listCount, GLuint blockBinding)
+    : lists(listCount), binding(blockBinding)
+{
+    GLint offsetAlignment = 256;
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &offsetAlignment);
+    alignment = static_cast<std::uint32_t>(std::max(offsetAlignment, 16));
+    for (CommandList &list : lists)
+        list.alignment = alignment;
+    glGenBuffers(1, &uniformBuffer);
+}
+
+CommandBuffer::~CommandBuffer()
+{
+    glDeleteBuffers(1, &uniformBuffer);
+}
+
+void CommandBuffer::submit()
+{
+    // merge: every list's arena goes into one staging block, packets are rebased onto it
+    merged.clear();
+    staging.clear();
+    for (CommandList &list : lists)
+    {
+        std::size_t base = alignUp(staging.size(), alignment);
+        staging.resize(base);
+        staging.insert(staging.end(), list.uniforms.begin(), list.uniforms.end());
+        for (DrawPacket packet : list.packets)
+        {
+            packet.uniformOffset += static_cast<std::uint32_t>(base);
+            merged.push_back(packet);
+        }
+        list.reset();
+    }
+    frameStats = RenderStats();
+    frameStats.draws = static_cast<unsigned int>(merged.size());
+    if (merged.empty())
+        return;
+
+    std::uint32_t program = 0, vao = 0, material = ~0u;
+    order.resize(merged.size());
+    for (std::size_t i = 0; i < merged.size(); i++)
+    {
+        const DrawPacket &packet = merged[i];
+        order[i].key = packet.key;
+        order[i].index = static_cast<std::uint32_t>(i);
+        countChange(frameStats.unsorted.programs, program, packet.program);
+        countChange(frameStats.unsorted.vaos, vao, packet.vao);
+        countChange(frameStats.unsorted.materials, material, packet.material);
+    }
+    radixSort(order, scratch);
+
+    // orphan and refill, the driver hands back fresh storage instead of waiting on last frame's draws
+    glBindBuffer(GL_UNIFORM_BUFFER, uniformBuffer);
+    glBufferData(GL_UNIFORM_BUFFER, staging.size(), nullptr, GL_STREAM_DRAW);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, staging.size(), staging.data());
+
+    program = 0;
+    vao = 0;
+    material = ~0u;
+    for (const SortItem &item : order)
+    {
+        const DrawPacket &packet = merged[item.index];
+        if (packet.program != program)
+            glUseProgram(packet.program);
+        if (packet.vao != vao)
+            glBindVertexArray(packet.vao);
+        countChange(frameStats.sorted.programs, program, packet.program);
+        countChange(frameStats.sorted.vaos, vao, packet.vao);
+        // materials own no GL objects yet (their color travels in the uniform block), the switch is only counted
+        countChange(frameStats.sorted.materials, material, packet.material);
+
+        glBindBufferRange(GL_UNIFORM_BUFFER, binding, uniformBuffer, packet.uniformOffset, packet.uniformSize);
+        const void *offset = (const void *)(packet.firstIndex * sizeof(unsigned int));
+        if (packet.instanceCount == 1)
+            glDrawElements(GL_TRIANGLES, packet.indexCount, GL_UNSIGNED_INT, offset);
+        else
+            glDrawElementsInstanced(GL_TRIANGLES, packet.indexCount, GL_UNSIGNED_INT, offset, packet.instanceCount);
+    }
+}
@@ -0,0 +1,93 @@
+#ifndef COMMAND_BUFFER_H
+#define COMMAND_BUFFER_H
+
+#include <glad/glad.h>
+
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+#include "frame_arena.h"
+#include "render_queue.h"
+
+// what a draw needs, as handed to CommandList::draw()
+struct DrawItem
+{
+    unsigned int layer = 0;         // pass, drawn in increasing order
+    GLuint program = 0;
+    unsigned int material = 0;
+    GLuint vao = 0;
+    float depth = 0.0f;             // normalized view depth, see makeSortKey()
+    std::uint32_t firstIndex = 0;
+    std::uint32_t indexCount = 0;
+    std::uint32_t instanceCount = 1;
+};
+
+// one recorded draw: which program and VAO, where its uniform block lives and which index range to draw
+struct DrawPacket
+{
+    std::uint64_t key;              // makeSortKey() of the item, smaller keys are drawn first
+    GLuint program;
+    GLuint vao;
+    std::uint32_t material;
+    std::uint32_t uniformOffset;    // byte offset of the draw's uniform block data
+    std::uint32_t uniformSize;
+    std::uint32_t firstIndex;
+    std::uint32_t indexCount;
+    std::uint32_t instanceCount;
+};
+
+// draws recorded by one thread. recording touches no GL state, so any worker can fill its own list
+class alignas(64) CommandList
+{
+public:
+    // uniforms is copied into the list's arena and later bound with glBindBufferRange at the block binding
+    void draw(const DrawItem &item, const void *uniforms, std::uint32_t uniformSize);
+
+    std::size_t size() const { return packets.size(); }
+
+private:
+    friend class CommandBuffer;
+
+    // drops the frame's packets and uniforms and rewinds the arena, with room for as many again
+    void reset();
+
+    FrameArena arena;
+    std::pmr::vector<DrawPacket> packets{&arena};
+    std::pmr::vector<unsigned char> uniforms{&arena};
+    std::uint32_t alignment = 256;
+};
+
+// one CommandList per job system worker; the render thread merges them, radix sorts by key and submits
+// with only the binds that actually change. the lists' arenas and the merge buffers keep their memory between frames
+class CommandBuffer
+{
+public:
+    // needs a current GL context; blockBinding is the uniform buffer binding point the programs' block is bound to
+    CommandBuffer(unsigned int listCount, GLuint blockBinding);
+    ~CommandBuffer();
+
+    CommandBuffer(const CommandBuffer &) = delete;
+    CommandBuffer &operator=(const CommandBuffer &) = delete;
+
+    CommandList &list(unsigned int index) { return lists[index]; }
+
+    // render thread only: upload every recorded uniform block in one go, issue the draws in key order
+    // and empty the lists for the next frame
+    void submit();
+
+    // draws and state changes of the last submit(), in recording order versus key order
+    const RenderStats &stats() const { return frameStats; }
+
+private:
+    std::vector<CommandList> lists;
+    std::vector<DrawPacket> merged;
+    std::vector<SortItem> order, scratch;
+    std::vector<unsigned char> staging;
+    RenderStats frameStats;
+    GLuint uniformBuffer = 0;
+    GLuint binding;
+    std::uint32_t alignment;
+};
+
+#endif
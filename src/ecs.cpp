@@ -0,0 +1,275 @@
+#include "ecs.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+
+namespace
+{
+    // fixed storage so lookups need no lock while another thread registers a new type
+    std::mutex registryLock;
+    ComponentInfo registry[MAX_COMPONENTS];
+    std::atomic<ComponentId> registryCount{0};
+
+    std::size_t alignUp(std::size_t value, std::size_t alignment)
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+}
+
+ComponentId registerComponent(std::size_t size, std::size_t alignment)
+{
+    std::lock_guard<std::mutex> lock(registryLock);
+    ComponentId id = registryCount.load();
+    if (id >= MAX_COMPONENTS)
+        throw std::length_error("registerComponent: more than MAX_COMPONENTS component types");
+    registry[id] = {size, alignment};
+    registryCount.store(id + 1);
+    return id;
+}
+
+const ComponentInfo &componentInfo(ComponentId id)
+{
+    return registry[id];
+}
+
+void DeferredCommands::push(Kind kind, Entity entity, ComponentMask mask, ComponentId component, const void *value)
+{
+    Command command;
+    command.kind = kind;
+    command.entity = entity;
+    command.mask = mask;
+    command.component = component;
+    command.dataOffset = data.size();
+    if (value)
+    {
+        std::size_t size = componentInfo(component).size;
+        data.resize(data.size() + size);
+        std::memcpy(&data[command.dataOffset], value, size);
+    }
+    commands.push_back(command);
+}
+
+World::World(unsigned int workerCount)
+    : recorders(std::max(workerCount, 1u))
+{
+}
+
+World::~World() = default;
+
+World::Archetype &World::archetype(ComponentMask mask)
+{
+    auto found = archetypeByMask.find(mask);
+    if (found != archetypeByMask.end())
+        return *found->second;
+
+    std::unique_ptr<Archetype> created(new Archetype());
+    created->mask = mask;
+    std::size_t rowBytes = sizeof(Entity);
+    for (ComponentId id = 0; id < MAX_COMPONENTS; id++)
+    {
+        created->offsets[id] = 0;
+        if (mask & (ComponentMask(1) << id))
+        {
+            created->components.push_back(id);
+            rowBytes += componentInfo(id).size;
+        }
+    }
+
+    // as many rows as fit once every array is rounded up to a cache line
+    std::uint32_t capacity = static_cast<std::uint32_t>(CHUNK_BYTES / rowBytes);
+    for (;; capacity--)
+    {
+        std::size_t offset = alignUp(capacity * sizeof(Entity), 64);
+        for (ComponentId id : created->components)
+        {
+            created->offsets[id] = offset;
+            offset = alignUp(offset + capacity * componentInfo(id).size, 64);
+        }
+        if (offset <= CHUNK_BYTES)
+            break;
+    }
+    if (capacity == 0)
+        throw std::length_error("World: an entity with these components does not fit in a chunk");
+    created->capacity = capacity;
+
+    Archetype *result = created.get();
+    archetypes.push_back(std::move(created));
+    archetypeByMask[mask] = result;
+    return *result;
+}
+
+Entity World::createEmpty(ComponentMask mask)
+{
+    Archetype &target = archetype(mask);
+    Entity entity;
+    if (!freeIndices.empty())
+    {
+        entity.index = freeIndices.back();
+        freeIndices.pop_back();
+    }
+    else
+    {
+        entity.index = static_cast<std::uint32_t>(records.size());
+        records.emplace_back();
+    }
+    entity.generation = records[entity.index].generation;
+    appendRow(entity, target);
+    return entity;
+}
+
+bool World::alive(Entity entity) const
+{
+    return entity.index < records.size() && records[entity.index].archetype
+        && records[entity.index].generation == entity.generation;
+}
+
+void World::destroy(Entity entity)
+{
+    if (!alive(entity))
+        return;
+    Record &record = records[entity.index];
+    removeRow(*record.archetype, record.chunk, record.row);
+    record.archetype = nullptr;
+    record.generation++;
+    freeIndices.push_back(entity.index);
+}
+
+void *World::component(Entity entity, ComponentId id)
+{
+    if (!alive(entity))
+        return nullptr;
+    Record &record = records[entity.index];
+    if (!(record.archetype->mask & (ComponentMask(1) << id)))
+        return nullptr;
+    return record.archetype->chunks[record.chunk]->bytes + record.archetype->offsets[id] + record.row * componentInfo(id).size;
+}
+
+void World::setComponent(Entity entity, ComponentId id, const void *value)
+{
+    if (void *target = component(entity, id))
+        std::memcpy(target, value, componentInfo(id).size);
+}
+
+void World::addComponent(Entity entity, ComponentId id, const void *value)
+{
+    if (!alive(entity))
+        return;
+    Archetype &current = *records[entity.index].archetype;
+    if (!(current.mask & (ComponentMask(1) << id)))
+        moveTo(entity, archetype(current.mask | (ComponentMask(1) << id)));
+    setComponent(entity, id, value);
+}
+
+void World::removeComponent(Entity entity, ComponentId id)
+{
+    if (!alive(entity))
+        return;
+    Archetype &current = *records[entity.index].archetype;
+    if (current.mask & (ComponentMask(1) << id))
+        moveTo(entity, archetype(current.mask & ~(ComponentMask(1) << id)));
+}
+
+void World::appendRow(Entity entity, Archetype &target)
+{
+    if (target.chunks.empty() || target.counts.back() == target.capacity)
+    {
+        target.chunks.emplace_back(new ChunkStorage());
+        target.counts.push_back(0);
+    }
+    Record &record = records[entity.index];
+    record.archetype = &target;
+    record.chunk = static_cast<std::uint32_t>(target.chunks.size() - 1);
+    record.row = target.counts.back()++;
+    entities(target, record.chunk)[record.row] = entity;
+}
+
+void World::removeRow(Archetype &source, std::uint32_t chunk, std::uint32_t row)
+{
+    // keep chunks dense: the archetype's last row fills the hole
+    std::uint32_t lastChunk = static_cast<std::uint32_t>(source.chunks.size() - 1);
+    std::uint32_t lastRow = source.counts[lastChunk] - 1;
+    if (chunk != lastChunk || row != lastRow)
+    {
+        Entity moved = entities(source, lastChunk)[lastRow];
+        entities(source, chunk)[row] = moved;
+        for (ComponentId id : source.components)
+        {
+            std::size_t size = componentInfo(id).size;
+            unsigned char *column = source.chunks[chunk]->bytes + source.offsets[id];
+            unsigned char *lastColumn = source.chunks[lastChunk]->bytes + source.offsets[id];
+            std::memcpy(column + row * size, lastColumn + lastRow * size, size);
+        }
+        records[moved.index].chunk = chunk;
+        records[moved.index].row = row;
+    }
+    if (--source.counts[lastChunk] == 0)
+    {
+        source.chunks.pop_back();
+        source.counts.pop_back();
+    }
+}
+
+void World::moveTo(Entity entity, Archetype &target)
+{
+    Record &record = records[entity.index];
+    Archetype &source = *record.archetype;
+    std::uint32_t chunk = record.chunk;
+    std::uint32_t row = record.row;
+
+    appendRow(entity, target);
+    for (ComponentId id : source.components)
+    {
+        if (!(target.mask & (ComponentMask(1) << id)))
+            continue;
+        std::size_t size = componentInfo(id).size;
+        std::memcpy(target.chunks[record.chunk]->bytes + target.offsets[id] + record.row * size,
+                    source.chunks[chunk]->bytes + source.offsets[id] + row * size, size);
+    }
+    removeRow(source, chunk, row);
+}
+
+void World::flush()
+{
+    for (DeferredCommands &recorder : recorders)
+    {
+        Entity created;
+        for (const DeferredCommands::Command &command : recorder.commands)
+        {
+            const void *value = recorder.data.data() + command.dataOffset;
+            switch (command.kind)
+            {
+            case DeferredCommands::CREATE:
+                created = createEmpty(command.mask);
+                break;
+            case DeferredCommands::SET:
+                setComponent(created, command.component, value);
+                break;
+            case DeferredCommands::DESTROY:
+                destroy(command.entity);
+                break;
+            case DeferredCommands::ADD:
+                addComponent(command.entity, command.component, value);
+                break;
+            case DeferredCommands::REMOVE:
+                removeComponent(command.entity, command.component);
+                break;
+            }
+        }
+        recorder.commands.clear();
+        recorder.data.clear();
+    }
+}
+
+void World::gatherChunks(ComponentMask mask)
+{
+    queryChunks.clear();
+    for (const std::unique_ptr<Archetype> &candidate : archetypes)
+    {
+        if ((candidate->mask & mask) != mask)
+            continue;
+        for (std::size_t chunk = 0; chunk < candidate->chunks.size(); chunk++)
+            queryChunks.push_back({candidate.get(), chunk});
+    }
+}
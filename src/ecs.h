@@ -0,0 +1,235 @@
+#ifndef ECS_H
+#define ECS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "job_system.h"
+
+// entity component storage grouped by archetype: all entities with exactly the same set of components share
+// an archetype, which keeps them in 16 KB chunks. inside a chunk every component type is one contiguous array
+// starting on a cache line, so a system touches only the arrays it asks for and walks them front to back.
+//
+// components are plain data (trivially copyable, moved around with memcpy); use the glm aligned_* types for
+// fields the SIMD paths load. adding or removing components moves an entity to another archetype, which
+// must not happen while a query runs over it: record such changes in deferred() and apply them with flush().
+
+typedef std::uint32_t ComponentId;
+typedef std::uint64_t ComponentMask;
+const unsigned int MAX_COMPONENTS = 64;
+
+struct Entity
+{
+    std::uint32_t index = ~0u;
+    std::uint32_t generation = 0;
+
+    bool operator==(const Entity &other) const { return index == other.index && generation == other.generation; }
+    bool operator!=(const Entity &other) const { return !(*this == other); }
+};
+
+struct ComponentInfo
+{
+    std::size_t size;
+    std::size_t alignment;
+};
+
+// ids are handed out in order of first use, at most MAX_COMPONENTS types per program; one more throws
+// std::length_error
+ComponentId registerComponent(std::size_t size, std::size_t alignment);
+const ComponentInfo &componentInfo(ComponentId id);
+
+template <class T>
+ComponentId componentId()
+{
+    static_assert(std::is_trivially_copyable<T>::value, "components are moved with memcpy");
+    static const ComponentId id = registerComponent(sizeof(T), alignof(T));
+    return id;
+}
+
+template <class... Ts>
+ComponentMask componentMask()
+{
+    ComponentMask mask = 0;
+    for (ComponentId id : {componentId<Ts>()...})
+        mask |= ComponentMask(1) << id;
+    return mask;
+}
+
+// structural changes recorded while queries run, one recorder per job system worker
+class DeferredCommands
+{
+public:
+    template <class... Ts>
+    void create(const Ts &... components)
+    {
+        push(CREATE, Entity(), componentMask<Ts...>(), 0, nullptr);
+        // expands to one SET per component, applied to the entity the CREATE above makes
+        int expand[] = {0, (push(SET, Entity(), 0, componentId<Ts>(), &components), 0)...};
+        (void)expand;
+    }
+
+    void destroy(Entity entity) { push(DESTROY, entity, 0, 0, nullptr); }
+
+    template <class T>
+    void add(Entity entity, const T &component) { push(ADD, entity, 0, componentId<T>(), &component); }
+
+    template <class T>
+    void remove(Entity entity) { push(REMOVE, entity, 0, componentId<T>(), nullptr); }
+
+private:
+    friend class World;
+
+    enum Kind { CREATE, SET, DESTROY, ADD, REMOVE };
+
+    struct Command
+    {
+        Kind kind;
+        Entity entity;
+        ComponentMask mask;
+        ComponentId component;
+        std::size_t dataOffset;
+    };
+
+    void push(Kind kind, Entity entity, ComponentMask mask, ComponentId component, const void *value);
+
+    std::vector<Command> commands;
+    std::vector<unsigned char> data;   // component values of SET and ADD, copied out again by flush()
+};
+
+class World
+{
+public:
+    explicit World(unsigned int workerCount = 1);
+    ~World();
+
+    World(const World &) = delete;
+    World &operator=(const World &) = delete;
+
+    // create and add throw std::length_error, changing nothing, if one entity's components together are too big
+    // for a chunk
+    template <class... Ts>
+    Entity create(const Ts &... components)
+    {
+        Entity entity = createEmpty(componentMask<Ts...>());
+        int expand[] = {0, (setComponent(entity, componentId<Ts>(), &components), 0)...};
+        (void)expand;
+        return entity;
+    }
+
+    void destroy(Entity entity);
+    bool alive(Entity entity) const;
+    std::size_t entityCount() const { return records.size() - freeIndices.size(); }
+
+    template <class T>
+    void add(Entity entity, const T &component) { addComponent(entity, componentId<T>(), &component); }
+
+    template <class T>
+    void remove(Entity entity) { removeComponent(entity, componentId<T>()); }
+
+    // nullptr when the entity is dead or lacks the component; valid until the next structural change
+    template <class T>
+    T *get(Entity entity) { return static_cast<T *>(component(entity, componentId<T>())); }
+
+    // inside jobs use deferred(jobs.currentWorker()); flush() applies the recorders in worker order
+    DeferredCommands &deferred(unsigned int worker = 0) { return recorders[worker]; }
+    void flush();
+
+    // call f(count, entities, Ts *...) for every chunk holding all of Ts
+    template <class... Ts, class F>
+    void each(F &&f)
+    {
+        ComponentMask mask = componentMask<Ts...>();
+        for (const std::unique_ptr<Archetype> &archetype : archetypes)
+        {
+            if ((archetype->mask & mask) != mask)
+                continue;
+            for (std::size_t chunk = 0; chunk < archetype->chunks.size(); chunk++)
+                if (archetype->counts[chunk] > 0)
+                    f(std::size_t(archetype->counts[chunk]), entities(*archetype, chunk), column<Ts>(*archetype, chunk)...);
+        }
+    }
+
+    // same as each() with the chunks spread over the job system; f must not make structural changes directly
+    template <class... Ts, class F>
+    void each(JobSystem &jobs, const F &f)
+    {
+        gatherChunks(componentMask<Ts...>());
+        jobs.parallelFor(queryChunks.size(), 1, [&](std::size_t begin, std::size_t end)
+        {
+            for (std::size_t i = begin; i < end; i++)
+            {
+                Archetype &archetype = *queryChunks[i].archetype;
+                std::size_t chunk = queryChunks[i].chunk;
+                f(std::size_t(archetype.counts[chunk]), entities(archetype, chunk), column<Ts>(archetype, chunk)...);
+            }
+        });
+    }
+
+private:
+    static const std::size_t CHUNK_BYTES = 16 * 1024;
+
+    struct alignas(64) ChunkStorage
+    {
+        unsigned char bytes[CHUNK_BYTES];
+    };
+
+    struct Archetype
+    {
+        ComponentMask mask;
+        std::uint32_t capacity;                             // entities per chunk
+        std::size_t offsets[MAX_COMPONENTS];                // byte offset of each component array in a chunk
+        std::vector<ComponentId> components;
+        std::vector<std::unique_ptr<ChunkStorage>> chunks;
+        std::vector<std::uint32_t> counts;                  // live entities per chunk, only the last one is partly full
+    };
+
+    struct Record
+    {
+        Archetype *archetype = nullptr;
+        std::uint32_t chunk = 0;
+        std::uint32_t row = 0;
+        std::uint32_t generation = 0;
+    };
+
+    struct QueryChunk
+    {
+        Archetype *archetype;
+        std::size_t chunk;
+    };
+
+    Archetype &archetype(ComponentMask mask);
+    Entity createEmpty(ComponentMask mask);
+    void setComponent(Entity entity, ComponentId id, const void *value);
+    void addComponent(Entity entity, ComponentId id, const void *value);
+    void removeComponent(Entity entity, ComponentId id);
+    void *component(Entity entity, ComponentId id);
+    void moveTo(Entity entity, Archetype &target);
+    void appendRow(Entity entity, Archetype &target);
+    void removeRow(Archetype &source, std::uint32_t chunk, std::uint32_t row);
+    void gatherChunks(ComponentMask mask);
+
+    static Entity *entities(Archetype &archetype, std::size_t chunk)
+    {
+        return reinterpret_cast<Entity *>(archetype.chunks[chunk]->bytes);
+    }
+
+    template <class T>
+    static T *column(Archetype &archetype, std::size_t chunk)
+    {
+        return reinterpret_cast<T *>(archetype.chunks[chunk]->bytes + archetype.offsets[componentId<T>()]);
+    }
+
+    std::vector<std::unique_ptr<Archetype>> archetypes;
+    std::unordered_map<ComponentMask, Archetype *> archetypeByMask;
+    std::vector<Record> records;                // indexed by Entity::index
+    std::vector<std::uint32_t> freeIndices;
+    std::vector<DeferredCommands> recorders;
+    std::vector<QueryChunk> queryChunks;        // scratch of the parallel each(), keeps its capacity
+};
+
+#endif
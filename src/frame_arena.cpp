@@ -0,0 +1,78 @@
+#include "frame_arena.h"
+
+#include <algorithm>
+#include <cstdint>
+
+FrameArena::FrameArena(std::size_t blockSize)
+    : blockSize(blockSize)
+{
+}
+
+void *FrameArena::do_allocate(std::size_t size, std::size_t alignment)
+{
+    while (current < blocks.size())
+    {
+        Block &block = blocks[current];
+        std::uintptr_t base = reinterpret_cast<std::uintptr_t>(block.data.get());
+        std::size_t start = static_cast<std::size_t>((base + offset + alignment - 1) / alignment * alignment - base);
+        if (start + size <= block.size)
+        {
+            offset = start + size;
+            return block.data.get() + start;
+        }
+        // the tail of this block is wasted until the next reset
+        current++;
+        offset = 0;
+    }
+
+    // out of blocks: add one that is big enough for this request whatever the alignment
+    Block block;
+    block.size = std::max(blockSize, size + alignment);
+    block.data.reset(new unsigned char[block.size]);
+    blocks.push_back(std::move(block));
+    current = blocks.size() - 1;
+    offset = 0;
+    return do_allocate(size, alignment);
+}
+
+void FrameArena::rewind(const Marker &marker)
+{
+    current = marker.block;
+    offset = marker.offset;
+}
+
+std::size_t FrameArena::bytesUsed() const
+{
+    std::size_t used = offset;
+    for (std::size_t i = 0; i < current && i < blocks.size(); i++)
+        used += blocks[i].size;
+    return used;
+}
+
+std::size_t FrameArena::bytesReserved() const
+{
+    std::size_t reserved = 0;
+    for (const Block &block : blocks)
+        reserved += block.size;
+    return reserved;
+}
+
+FrameArenas::FrameArenas(unsigned int threadCount, std::size_t blockSize)
+{
+    for (unsigned int i = 0; i < std::max(threadCount, 1u); i++)
+        arenas.emplace_back(new FrameArena(blockSize));
+}
+
+void FrameArenas::reset()
+{
+    for (std::unique_ptr<FrameArena> &arena : arenas)
+        arena->reset();
+}
+
+std::size_t FrameArenas::bytesUsed() const
+{
+    std::size_t used = 0;
+    for (const std::unique_ptr<FrameArena> &arena : arenas)
+        used += arena->bytesUsed();
+    return used;
+}
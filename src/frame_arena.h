@@ -0,0 +1,76 @@
+#ifndef FRAME_ARENA_H
+#define FRAME_ARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+// linear allocator for data that lives at most one frame: allocate() bumps an offset, there is no per-object
+// free, reset() hands everything back at once. blocks are kept across resets, so once a frame has needed
+// as much as it ever will the arena stops touching the heap.
+//
+// it is also a std::pmr::memory_resource, so standard containers can live in it:
+//     std::pmr::vector<unsigned int> visible(&arena);
+// they must be done with before the next reset(). deallocate() is a no-op, a growing vector leaves its
+// old buffers behind until then.
+class alignas(64) FrameArena : public std::pmr::memory_resource
+{
+public:
+    // position to rewind() to, for scratch memory with a shorter life than the frame
+    struct Marker
+    {
+        std::size_t block;
+        std::size_t offset;
+    };
+
+    explicit FrameArena(std::size_t blockSize = 64 * 1024);
+
+    FrameArena(const FrameArena &) = delete;
+    FrameArena &operator=(const FrameArena &) = delete;
+
+    // uninitialized room for count objects of T; constructing and destroying them is up to the caller
+    template <class T>
+    T *allocateArray(std::size_t count) { return static_cast<T *>(allocate(count * sizeof(T), alignof(T))); }
+
+    Marker mark() const { return {current, offset}; }
+    void rewind(const Marker &marker);
+    void reset() { rewind({0, 0}); }
+
+    std::size_t bytesUsed() const;
+    std::size_t bytesReserved() const;
+
+private:
+    struct Block
+    {
+        std::unique_ptr<unsigned char[]> data;
+        std::size_t size;
+    };
+
+    void *do_allocate(std::size_t size, std::size_t alignment) override;
+    void do_deallocate(void *, std::size_t, std::size_t) override {}
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override { return this == &other; }
+
+    std::vector<Block> blocks;
+    std::size_t blockSize;
+    std::size_t current = 0;    // block being bumped, blocks.size() when all are used up
+    std::size_t offset = 0;
+};
+
+// one arena per job system worker, so tasks allocate without locking: inside a task use
+// arena(jobs.currentWorker()). the render thread calls reset() once the frame's work has finished
+class FrameArenas
+{
+public:
+    explicit FrameArenas(unsigned int threadCount, std::size_t blockSize = 64 * 1024);
+
+    FrameArena &arena(unsigned int worker) { return *arenas[worker]; }
+    void reset();
+
+    std::size_t bytesUsed() const;
+
+private:
+    std::vector<std::unique_ptr<FrameArena>> arenas;
+};
+
+#endif
@@ -0,0 +1,11 @@
+#ifndef HEAP_COUNTER_H
+#define HEAP_COUNTER_H
+
+#include <cstddef>
+
+// heap_counter.cpp replaces the global operator new and delete with versions that count calls before handing
+// them to malloc. every std container, std::function and make_unique goes through them, so sampling the
+// count around a frame shows whether it allocated. C allocations (GLFW, the GL driver) are not seen.
+std::size_t heapAllocationCount();
+
+#endif
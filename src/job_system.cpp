@@ -0,0 +1,245 @@
+#include "job_system.h"
+
+#include <algorithm>
+#include <new>
+
+namespace
+{
+    // index of the worker deque owned by this thread; threads the JobSystem did not start use deque 0
+    thread_local unsigned int workerIndex = 0;
+}
+
+JobSystem::JobSystem(unsigned int threadCount)
+{
+    threadCount = std::max(threadCount, 1u);
+    for (unsigned int i = 0; i < threadCount; i++)
+        workers.emplace_back(new Worker());
+    for (unsigned int i = 1; i < threadCount; i++)
+        threads.emplace_back(&JobSystem::workerLoop, this, i);
+}
+
+JobSystem::~JobSystem()
+{
+    {
+        std::lock_guard<std::mutex> lock(sleepLock);
+        quit = true;
+    }
+    sleep.notify_all();
+    for (std::thread &thread : threads)
+        thread.join();
+}
+
+void JobSystem::addDependency(Task &before, Task &after)
+{
+    before.dependents.push_back(&after);
+    after.pendingDependencies++;
+}
+
+void JobSystem::submit(Task &task)
+{
+    if (--task.pendingDependencies == 0)
+        push(&task);
+}
+
+void JobSystem::wait(const Task &task)
+{
+    unsigned int self = currentWorker();
+    while (!task.finished.load(std::memory_order_acquire))
+    {
+        if (!runOne(self))
+            std::this_thread::yield();
+    }
+}
+
+void JobSystem::forChunks(std::size_t count, std::size_t grain, RangeFunction run, const void *context)
+{
+    if (count == 0)
+        return;
+    if (grain == 0)
+        grain = std::max<std::size_t>(1, count / (workers.size() * 4));
+    std::size_t chunks = (count + grain - 1) / grain;
+    if (chunks == 1 || workers.size() == 1)
+    {
+        run(context, 0, count);
+        return;
+    }
+
+    // nested calls on this worker (from tasks run while waiting) allocate above us and rewind before we do
+    struct Chunk
+    {
+        RangeFunction run;
+        const void *context;
+        std::size_t begin, end;
+    };
+    FrameArena &scratch = workers[currentWorker()]->scratch;
+    FrameArena::Marker marker = scratch.mark();
+    Chunk *ranges = scratch.allocateArray<Chunk>(chunks);
+    Task *tasks = static_cast<Task *>(scratch.allocate(chunks * sizeof(Task), alignof(Task)));
+    for (std::size_t i = 0; i < chunks; i++)
+    {
+        Chunk *chunk = &ranges[i];
+        chunk->run = run;
+        chunk->context = context;
+        chunk->begin = i * grain;
+        chunk->end = std::min(count, chunk->begin + grain);
+        // a single pointer capture fits std::function's inline storage
+        Task *task = new (&tasks[i]) Task();
+        task->work = [chunk]() { chunk->run(chunk->context, chunk->begin, chunk->end); };
+        submit(*task);
+    }
+    for (std::size_t i = 0; i < chunks; i++)
+        wait(tasks[i]);
+    for (std::size_t i = 0; i < chunks; i++)
+        tasks[i].~Task();
+    scratch.rewind(marker);
+}
+
+void JobSystem::TaskRing::pushBack(Task *task)
+{
+    if (count == slots.size())
+    {
+        // unroll into a ring twice the size, oldest first
+        std::vector<Task *> grown(std::max<std::size_t>(64, slots.size() * 2));
+        for (std::size_t i = 0; i < count; i++)
+            grown[i] = slots[(head + i) % slots.size()];
+        slots.swap(grown);
+        head = 0;
+    }
+    slots[(head + count) % slots.size()] = task;
+    count++;
+}
+
+JobSystem::Task *JobSystem::TaskRing::popBack()
+{
+    count--;
+    return slots[(head + count) % slots.size()];
+}
+
+JobSystem::Task *JobSystem::TaskRing::popFront()
+{
+    Task *task = slots[head];
+    head = (head + 1) % slots.size();
+    count--;
+    return task;
+}
+
+void JobSystem::push(Task *task)
+{
+    Worker &worker = *workers[currentWorker()];
+    {
+        std::lock_guard<std::mutex> lock(worker.lock);
+        worker.tasks.pushBack(task);
+    }
+    queued++;
+    {
+        // taking the lock orders this wakeup after a sleeper's predicate check
+        std::lock_guard<std::mutex> lock(sleepLock);
+    }
+    sleep.notify_one();
+}
+
+JobSystem::Task *JobSystem::pop(unsigned int self)
+{
+    // newest local work first, it is the most likely to still be in cache
+    {
+        Worker &worker = *workers[self];
+        std::lock_guard<std::mutex> lock(worker.lock);
+        if (worker.tasks.count > 0)
+        {
+            queued--;
+            return worker.tasks.popBack();
+        }
+    }
+    // then steal the oldest work of the others, which tends to be the biggest
+    for (std::size_t i = 1; i < workers.size(); i++)
+    {
+        Worker &victim = *workers[(self + i) % workers.size()];
+        std::lock_guard<std::mutex> lock(victim.lock);
+        if (victim.tasks.count > 0)
+        {
+            queued--;
+            return victim.tasks.popFront();
+        }
+    }
+    return nullptr;
+}
+
+bool JobSystem::runOne(unsigned int self)
+{
+    Task *task = pop(self);
+    if (!task)
+        return false;
+    execute(task);
+    return true;
+}
+
+void JobSystem::execute(Task *task)
+{
+    task->work();
+    for (Task *dependent : task->dependents)
+    {
+        if (--dependent->pendingDependencies == 0)
+            push(dependent);
+    }
+    // last touch: a waiter may destroy the task as soon as it sees this
+    task->finished.store(true, std::memory_order_release);
+}
+
+void JobSystem::workerLoop(unsigned int index)
+{
+    workerIndex = index;
+    for (;;)
+    {
+        if (runOne(index))
+            continue;
+        std::unique_lock<std::mutex> lock(sleepLock);
+        sleep.wait(lock, [this] { return quit || queued > 0; });
+        if (quit)
+            return;
+    }
+}
+
+unsigned int JobSystem::currentWorker() const
+{
+    return workerIndex < workers.size() ? workerIndex : 0;
+}
+
+int TaskGraph::add(std::function<void()> work, std::initializer_list<int> dependencies)
+{
+    Node node;
+    node.work = std::move(work);
+    node.dependencies.assign(dependencies.begin(), dependencies.end());
+    nodes.push_back(std::move(node));
+    return static_cast<int>(nodes.size()) - 1;
+}
+
+void TaskGraph::run(JobSystem &jobs)
+{
+    if (tasks.size() != nodes.size())
+    {
+        tasks.clear();
+        for (const Node &node : nodes)
+        {
+            // call through the node instead of copying its closure, which may be too big for inline storage
+            const Node *source = &node;
+            tasks.emplace_back();
+            tasks.back().work = [source]() { source->work(); };
+        }
+        for (std::size_t i = 0; i < nodes.size(); i++)
+            for (int dependency : nodes[i].dependencies)
+                JobSystem::addDependency(tasks[dependency], tasks[i]);
+    }
+    else
+    {
+        // same graph as last run: keep the dependent lists, rearm the counters
+        for (std::size_t i = 0; i < nodes.size(); i++)
+        {
+            tasks[i].pendingDependencies = 1 + static_cast<int>(nodes[i].dependencies.size());
+            tasks[i].finished = false;
+        }
+    }
+    for (JobSystem::Task &task : tasks)
+        jobs.submit(task);
+    for (JobSystem::Task &task : tasks)
+        jobs.wait(task);
+}
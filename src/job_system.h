@@ -0,0 +1,130 @@
+#ifndef JOB_SYSTEM_H
+#define JOB_SYSTEM_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "frame_arena.h"
+
+// work-stealing scheduler: every thread owns a deque, pushes and pops its own work at the back and
+// steals from the front of the others when it runs dry. the thread that created the JobSystem counts
+// as worker 0 and only runs tasks while it waits, so threadCount = 1 means everything runs inline.
+//
+// this is the place to go wide on CPU work (transforms, culling, mesh processing, rasterization);
+// parallelFor() covers flat loops and TaskGraph covers a frame's worth of dependent steps.
+class JobSystem
+{
+public:
+    // caller-owned unit of work, must stay alive until it has finished
+    struct Task
+    {
+        std::function<void()> work;
+        std::vector<Task *> dependents;           // released when this task finishes
+        std::atomic<int> pendingDependencies{1};  // unfinished dependencies, plus one until submit() is called
+        std::atomic<bool> finished{false};
+    };
+
+    explicit JobSystem(unsigned int threadCount = std::thread::hardware_concurrency());
+    ~JobSystem();
+
+    JobSystem(const JobSystem &) = delete;
+    JobSystem &operator=(const JobSystem &) = delete;
+
+    unsigned int threadCount() const { return static_cast<unsigned int>(workers.size()); }
+
+    // index in [0, threadCount()) of the calling thread, for picking per-thread storage inside a task.
+    // the creating thread is 0; threads the JobSystem knows nothing about also get 0, so they must not share it
+    unsigned int currentWorker() const;
+
+    // 'after' will not start before 'before' has finished; both must be set up before either is submitted
+    static void addDependency(Task &before, Task &after);
+
+    // queue a task on the calling thread's deque; it runs as soon as its dependencies have finished
+    void submit(Task &task);
+
+    // run other tasks until 'task' has finished
+    void wait(const Task &task);
+
+    // run one queued task on the calling thread if there is any; lets a thread that polls background work
+    // help out, which is the only way that work makes progress when threadCount() is 1
+    bool tryRunOne() { return runOne(currentWorker()); }
+
+    // call body(begin, end) over [0, count) split into chunks of at most grain items (0 picks one), returns when all are done.
+    // takes any callable so no std::function is built, and the chunk tasks live on the worker's scratch arena
+    template <class Body>
+    void parallelFor(std::size_t count, std::size_t grain, const Body &body)
+    {
+        forChunks(count, grain, [](const void *context, std::size_t begin, std::size_t end)
+        {
+            (*static_cast<const Body *>(context))(begin, end);
+        }, &body);
+    }
+
+private:
+    typedef void (*RangeFunction)(const void *context, std::size_t begin, std::size_t end);
+
+    // growable ring of task pointers; unlike std::deque it does not allocate and free blocks as work streams through
+    struct TaskRing
+    {
+        std::vector<Task *> slots;
+        std::size_t head = 0;
+        std::size_t count = 0;
+
+        void pushBack(Task *task);
+        Task *popBack();
+        Task *popFront();
+    };
+
+    struct Worker
+    {
+        std::mutex lock;
+        TaskRing tasks;
+        FrameArena scratch{16 * 1024};   // parallelFor chunk tasks, rewound when the call returns
+    };
+
+    void forChunks(std::size_t count, std::size_t grain, RangeFunction run, const void *context);
+
+    void push(Task *task);
+    Task *pop(unsigned int self);
+    bool runOne(unsigned int self);
+    void execute(Task *task);
+    void workerLoop(unsigned int index);
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::vector<std::thread> threads;
+
+    std::atomic<int> queued{0};
+    std::mutex sleepLock;
+    std::condition_variable sleep;
+    bool quit = false;
+};
+
+// a fixed set of dependent steps that is built once and run every frame. the tasks are created on the
+// first run() and only rearmed after that, so running a graph does not allocate
+class TaskGraph
+{
+public:
+    // returns the node id to use in later dependency lists
+    int add(std::function<void()> work, std::initializer_list<int> dependencies = {});
+
+    // run every node once, respecting dependencies, and return when all have finished
+    void run(JobSystem &jobs);
+
+private:
+    struct Node
+    {
+        std::function<void()> work;
+        std::vector<int> dependencies;
+    };
+    std::vector<Node> nodes;
+    std::deque<JobSystem::Task> tasks;
+};
+
+#endif
@@ -1,14 +1,43 @@
+#define GLM_ENABLE_EXPERIMENTAL
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_aligned.hpp>
 #include <glm/gtc/type_ptr.hpp>
+#include <glm/gtx/transform_array.hpp>
 #include <algorithm>
 
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
 #include <iostream>
+#include <memory_resource>
+#include <random>
+#include <new>
+#include <thread>
+#include <vector>
+
+#include "bench.h"
+#include "bvh.h"
+#include "command_buffer.h"
+#include "ecs.h"
+#include "frame_arena.h"
+#include "heap_counter.h"
+#include "job_system.h"
+#include "scene.h"
+#include "skinning.h"
+#include "soft_rasterizer.h"
+#include "terrain.h"
+#include "voxel_renderer.h"
+#include "voxel_world.h"
 
 void framebuffer_size_callback(GLFWwindow* window, int width, int height);
 void processInput(GLFWwindow *window);
+int runSoftwareRenderer();
+int runVoxelViewer(GLFWwindow *window);
+int runSkinningViewer(GLFWwindow *window);
 
 // settings
 const unsigned int SCR_WIDTH = 800;
@@ -18,7 +47,11 @@ const char *vertexShaderSource = "#version 330 core\n"
     "layout (location = 0) in vec3 aPos;\n"
     "layout (location = 1) in vec2 aTexCoord;\n"
     "out vec2 TexCoord;\n"
-    "uniform mat4 model;\n"
+    "layout (std140) uniform DrawBlock\n"
+    "{\n"
+    "   mat4 model;\n"
+    "   vec4 ourColor;\n"
+    "};\n"
     "uniform mat4 view;\n"
     "uniform mat4 projection;\n"
     "void main()\n"
@@ -30,15 +63,169 @@ const char *vertexShaderSource = "#version 330 core\n"
 
 const char *fragmentShaderSource = "#version 330 core\n"
     "out vec4 FragColor;\n"
-    "uniform vec4 ourColor;\n"
+    "layout (std140) uniform DrawBlock\n"
+    "{\n"
+    "   mat4 model;\n"
+    "   vec4 ourColor;\n"
+    "};\n"
     "void main()\n"
     "{\n"
     "   FragColor = ourColor;\n"
     "}\n\0";
 
+// voxel world: chunk local positions plus a per-chunk origin, colors come with their face light in alpha
+const char *voxelVertexShaderSource = "#version 330 core\n"
+    "layout (location = 0) in vec3 aPos;\n"
+    "layout (location = 1) in vec4 aColor;\n"
+    "out vec3 faceColor;\n"
+    "uniform mat4 viewProjection;\n"
+    "uniform vec3 chunkOrigin;\n"
+    "void main()\n"
+    "{\n"
+    "   gl_Position = viewProjection * vec4(chunkOrigin + aPos, 1.0);\n"
+    "   faceColor = aColor.rgb * aColor.a;\n"
+    "}\0";
 
-int main()
+const char *voxelFragmentShaderSource = "#version 330 core\n"
+    "in vec3 faceColor;\n"
+    "out vec4 FragColor;\n"
+    "void main()\n"
+    "{\n"
+    "   FragColor = vec4(faceColor, 1.0);\n"
+    "}\n\0";
+
+// skinned mesh: positions and normals already posed on the CPU, lit from one direction on both sides
+const char *skinnedVertexShaderSource = "#version 330 core\n"
+    "layout (location = 0) in vec3 aPos;\n"
+    "layout (location = 1) in vec3 aNormal;\n"
+    "out vec3 normal;\n"
+    "uniform mat4 viewProjection;\n"
+    "void main()\n"
+    "{\n"
+    "   gl_Position = viewProjection * vec4(aPos, 1.0);\n"
+    "   normal = aNormal;\n"
+    "}\0";
+
+const char *skinnedFragmentShaderSource = "#version 330 core\n"
+    "in vec3 normal;\n"
+    "out vec4 FragColor;\n"
+    "void main()\n"
+    "{\n"
+    "   float light = 0.25 + 0.75 * abs(dot(normalize(normal), normalize(vec3(0.3, 1.0, 0.5))));\n"
+    "   FragColor = vec4(vec3(0.9, 0.6, 0.3) * light, 1.0);\n"
+    "}\n\0";
+
+// cube vertex data, shared by the GL path, the picking BVH and the software renderer
+// -----------------------------------------------------------------------------------
+const float vertices[] = {
+    0.3f, 0.3f, 0.3f,
+    0.3f, 0.3f, -0.3f,
+    0.3f, -0.3f, 0.3f,
+    0.3f, -0.3f, -0.3f,
+    -0.3f, 0.3f, 0.3f,
+    -0.3f, 0.3f, -0.3f,
+    -0.3f, -0.3f, 0.3f,
+    -0.3f, -0.3f, -0.3f,
+};
+const unsigned int indices[] = {  // note that we start from 0!
+    0, 1, 2,  // first Triangle
+    1, 2, 3,
+    0, 1, 4,
+    1, 4, 5,
+    4, 5, 6,
+    5, 6, 7,
+    2, 6, 7,
+    2, 3, 7,
+    0, 2, 6,
+    0, 4, 6,
+    1, 3, 7,
+    1, 5, 7
+};
+
+// one draw of 6 indices per face, in index buffer order
+const glm::vec4 face_colors[] = {
+    glm::vec4(1.0f, 0.0f, 0.0f, 1.0f),
+    glm::vec4(0.0f, 1.0f, 0.0f, 1.0f),
+    glm::vec4(1.0f, 0.7f, 0.0f, 1.0f),
+    glm::vec4(0.0f, 0.0f, 1.0f, 1.0f),
+    glm::vec4(1.0f, 1.0f, 1.0f, 1.0f),
+    glm::vec4(1.0f, 1.0f, 0.0f, 1.0f),
+};
+const char *face_names[] = {"red", "green", "orange", "blue", "white", "yellow"};
+
+// per-draw data, laid out like the std140 DrawBlock in the shaders
+struct DrawUniforms
+{
+    glm::mat4 model;
+    glm::vec4 ourColor;
+};
+
+int main(int argc, char **argv)
 {
+    // --software renders offscreen on the CPU, for hosts without a GPU
+    if (argc > 1 && std::strcmp(argv[1], "--software") == 0)
+        return runSoftwareRenderer();
+    // --transforms times the scene graph update on its own
+    if (argc > 1 && std::strcmp(argv[1], "--transforms") == 0)
+        return runTransformBenchmark();
+    // --ecs compares system iteration over archetype chunks with a plain array of structs
+    if (argc > 1 && std::strcmp(argv[1], "--ecs") == 0)
+        return runEcsBenchmark();
+    // --pick-bench builds a BVH over a 2M triangle terrain and times mouse picking rays against it
+    if (argc > 1 && std::strcmp(argv[1], "--pick-bench") == 0)
+        return runPickBenchmark();
+    // --voxel-bench meshes a voxel terrain on the CPU, --voxels opens it in the window instead of the cube
+    if (argc > 1 && std::strcmp(argv[1], "--voxel-bench") == 0)
+        return runVoxelBenchmark();
+    // --noise-bench compares glm::simplex called per point with the batched SIMD noise
+    if (argc > 1 && std::strcmp(argv[1], "--noise-bench") == 0)
+        return runNoiseBenchmark();
+    // --random-bench compares std::rand and <random> with the gtc/random engines
+    if (argc > 1 && std::strcmp(argv[1], "--random-bench") == 0)
+        return runRandomBenchmark();
+    // --transform-array-bench compares a per point mat4 * vec4 loop with the gtx/transform_array bulk calls
+    if (argc > 1 && std::strcmp(argv[1], "--transform-array-bench") == 0)
+        return runTransformArrayBenchmark();
+    // --matrix-bench times mat4 multiply, inverse and transpose on every kernel tier the build has
+    if (argc > 1 && std::strcmp(argv[1], "--matrix-bench") == 0)
+        return runMatrixBenchmark();
+    // --double-bench compares the scalar dvec4, dmat4 and dquat code with their aligned AVX versions
+    if (argc > 1 && std::strcmp(argv[1], "--double-bench") == 0)
+        return runDoubleBenchmark();
+    // --affine-bench compares a hierarchy update on mat4 world matrices with the same update on mat3x4 affine rows
+    if (argc > 1 && std::strcmp(argv[1], "--affine-bench") == 0)
+        return runAffineBenchmark();
+    // --inverse-bench compares the general mat4 inverse with the affine and rigid ones, and with tagged matrices
+    if (argc > 1 && std::strcmp(argv[1], "--inverse-bench") == 0)
+        return runInverseBenchmark();
+    // --transcendental-bench checks the SIMD sin, cos, atan, exp, log and pow against libm and times them against it
+    if (argc > 1 && std::strcmp(argv[1], "--transcendental-bench") == 0)
+        return runTranscendentalBenchmark();
+    // --fast-math-bench prints the error and speed of each accuracy tier of fastSqrt, fastInverseSqrt, fastSin and fastCos
+    if (argc > 1 && std::strcmp(argv[1], "--fast-math-bench") == 0)
+        return runFastMathBenchmark();
+    // --geometric-array-bench times normalize, length, distance2, dot and cross over arrays against per-element loops
+    if (argc > 1 && std::strcmp(argv[1], "--geometric-array-bench") == 0)
+        return runGeometricArrayBenchmark();
+    // --soa-bench times dot, cross, normalize and transform on soa_vec3 / soa_quat containers against vec3 / quat arrays
+    if (argc > 1 && std::strcmp(argv[1], "--soa-bench") == 0)
+        return runSoaBenchmark();
+    // --quaternion-array-bench times slerp, nlerp, products, rotations and matrix casts over quat arrays and soa_quat
+    if (argc > 1 && std::strcmp(argv[1], "--quaternion-array-bench") == 0)
+        return runQuaternionArrayBenchmark();
+    // --packet-bench compares scalar ray/triangle and ray/AABB tests with the 4 and 8 lane gtx/intersect_packet ones
+    if (argc > 1 && std::strcmp(argv[1], "--packet-bench") == 0)
+        return runPacketBenchmark();
+    // --skinning-bench compares dual quaternion and linear blend skinning of a large mesh per vertex, batched and threaded,
+    // --skinning shows a smaller one twisting in the window instead of the cube
+    if (argc > 1 && std::strcmp(argv[1], "--skinning-bench") == 0)
+        return runSkinningBenchmark();
+    // --animation-bench samples many instances of a compressed clip per track and batched, and blends their poses
+    if (argc > 1 && std::strcmp(argv[1], "--animation-bench") == 0)
+        return runAnimationBenchmark();
+    bool voxel_mode = argc > 1 && std::strcmp(argv[1], "--voxels") == 0;
+    bool skinning_mode = argc > 1 && std::strcmp(argv[1], "--skinning") == 0;
+
     // glfw: initialize and configure
     // ------------------------------
     glfwInit();
@@ -69,7 +256,10 @@ int main()
         std::cout << "Failed to initialize GLAD" << std::endl;
         return -1;
     }
-
+    if (voxel_mode)
+        return runVoxelViewer(window);
+    if (skinning_mode)
+        return runSkinningViewer(window);
 
     // build and compile our shader program
     // ------------------------------------
@@ -110,33 +300,10 @@ int main()
     }
     glDeleteShader(vertexShader);
     glDeleteShader(fragmentShader);
+    glUniformBlockBinding(shaderProgram, glGetUniformBlockIndex(shaderProgram, "DrawBlock"), 0);
 
     // set up vertex data (and buffer(s)) and configure vertex attributes
     // ------------------------------------------------------------------
-    float vertices[] = {
-        0.3f, 0.3f, 0.3f,
-        0.3f, 0.3f, -0.3f,
-        0.3f, -0.3f, 0.3f,
-        0.3f, -0.3f, -0.3f,
-        -0.3f, 0.3f, 0.3f,
-        -0.3f, 0.3f, -0.3f,
-        -0.3f, -0.3f, 0.3f,
-        -0.3f, -0.3f, -0.3f,
-    };
-    unsigned int indices[] = {  // note that we start from 0!
-        0, 1, 2,  // first Triangle
-        1, 2, 3,
-        0, 1, 4,
-        1, 4, 5,
-        4, 5, 6,
-        5, 6, 7,
-        2, 6, 7,
-        2, 3, 7,
-        0, 2, 6,
-        0, 4, 6,
-        1, 3, 7,
-        1, 5, 7
-    };
     //glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
     unsigned int VBO, VAO, EBO;
     glGenVertexArrays(1, &VAO);
@@ -172,6 +339,20 @@ int main()
 	int side6 [] = {1, 3, 5, 7};
     glm::mat4 prev_transform = glm::mat4(1.0f);
 
+    // picking: the BVH is built once in object space, the cursor ray is unprojected into the same space every click
+    // ----------------------------------------------------------------------------------------------------------------
+    Bvh bvh;
+    bvh.build(vertices, sizeof(vertices) / (3 * sizeof(float)), indices, sizeof(indices) / (3 * sizeof(unsigned int)));
+    bool mouse_was_down = false;
+
+    // draws are recorded on the job system workers, one command list each, and submitted from this thread
+    // ------------------------------------------------------------------------------------------------------
+    JobSystem jobs;
+    CommandBuffer commands(jobs.threadCount(), 0);
+    FrameArenas frame_arenas(jobs.threadCount());
+    double last_stats_time = 0.0;
+    std::size_t frame_heap_allocations = 0;
+
     // uncomment this call to draw in wireframe polygons.
     //glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
 
@@ -183,6 +364,7 @@ int main()
         // input
         // -----
         processInput(window);
+        std::size_t heap_before = heapAllocationCount();
 
         // render
         // ------
@@ -193,7 +375,6 @@ int main()
         glUseProgram(shaderProgram);
         glBindVertexArray(VAO); // seeing as we only have a single VAO there's no need to bind it every time, but we'll do so to keep things a bit more organized
         //glDrawArrays(GL_TRIANGLES, 0, 6);
-		int vertexColorLocation = glGetUniformLocation(shaderProgram, "ourColor");
         glm::mat4 transform = prev_transform; // make sure to initialize matrix to identity matrix first
 
         if (glfwGetKey(window,GLFW_KEY_UP) == GLFW_PRESS)
@@ -233,51 +414,75 @@ int main()
 
         
         prev_transform = transform;
-		unsigned int transformLoc = glGetUniformLocation(shaderProgram, "model");
-        glUniformMatrix4fv(transformLoc, 1, GL_FALSE, glm::value_ptr(transform));
-        
-		glm::vec4 new1 = transform * glm::vec4(vertices[0], vertices[1], vertices[2], 1.0f);
-		glm::vec4 new2 = transform * glm::vec4(vertices[3], vertices[4], vertices[5], 1.0f);
-		glm::vec4 new3 = transform * glm::vec4(vertices[6], vertices[7], vertices[8], 1.0f);
-		glm::vec4 new4 = transform * glm::vec4(vertices[9], vertices[10], vertices[11], 1.0f);
-		glm::vec4 new5 = transform * glm::vec4(vertices[12], vertices[13], vertices[14], 1.0f);
-		glm::vec4 new6 = transform * glm::vec4(vertices[15], vertices[16], vertices[17], 1.0f);
-		glm::vec4 new7 = transform * glm::vec4(vertices[18], vertices[19], vertices[20], 1.0f);
-		glm::vec4 new8 = transform * glm::vec4(vertices[21], vertices[22], vertices[23], 1.0f);
-
-		glm::vec4 news [] = {new1, new2, new3, new4, new5, new6, new7, new8};
-
-		float zsum1 = news[side1[0]][2] + news[side1[1]][2] + news[side1[2]][2];
-		float zsum2 = news[side2[0]][2] + news[side2[1]][2] + news[side2[2]][2];
-		float zsum3 = news[side3[0]][2] + news[side3[1]][2] + news[side3[2]][2];
-		float zsum4 = news[side4[0]][2] + news[side4[1]][2] + news[side4[2]][2];
-		float zsum5 = news[side5[0]][2] + news[side5[1]][2] + news[side5[2]][2];
-		float zsum6 = news[side6[0]][2] + news[side6[1]][2] + news[side6[2]][2];
-
-		float zsums [] = {zsum1,zsum2,zsum3,zsum4,zsum5,zsum6};
-		std::sort(zsums, zsums + 6);
 
+        bool mouse_down = glfwGetMouseButton(window, GLFW_MOUSE_BUTTON_LEFT) == GLFW_PRESS;
+        if (mouse_down && !mouse_was_down)
+        {
+            double xpos, ypos;
+            int width, height;
+            glfwGetCursorPos(window, &xpos, &ypos);
+            glfwGetWindowSize(window, &width, &height);
+            glm::vec4 viewport(0.0f, 0.0f, (float)width, (float)height);
+            glm::vec3 win_near((float)xpos, (float)(height - ypos), 0.0f);
+            glm::vec3 win_far((float)xpos, (float)(height - ypos), 1.0f);
+            glm::vec3 ray_origin = glm::unProject(win_near, view * transform, projection, viewport);
+            glm::vec3 ray_dir = glm::unProject(win_far, view * transform, projection, viewport) - ray_origin;
+
+            BvhHit hit;
+            if (bvh.intersect(ray_origin, ray_dir, hit))
+                std::cout << "picked " << face_names[hit.triangle / 2] << " face (triangle " << hit.triangle << ")" << std::endl;
+        }
+        mouse_was_down = mouse_down;
         
-	
-        glUniform4f(vertexColorLocation, 1.0f, 0.0f, 0.0f, 1.0f);
-        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
-    
-        glUniform4f(vertexColorLocation, 0.0f, 1.0f, 0.0f, 1.0f);
-        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, (void*)(6 * sizeof(float)));
-    
-        glUniform4f(vertexColorLocation, 1.0f, 0.7f, 0.0f, 1.0f);
-        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, (void*)(12 * sizeof(float)));
-    
-        glUniform4f(vertexColorLocation, 0.0f, 0.0f, 1.0f, 1.0f);
-        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, (void*)(18 * sizeof(float)));
-    
-        glUniform4f(vertexColorLocation, 1.0f, 1.0f, 1.0f, 1.0f);
-        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, (void*)(24 * sizeof(float)));
-    
-        glUniform4f(vertexColorLocation, 1.0f, 1.0f, 0.0f, 1.0f);
-        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, (void*)(30 * sizeof(float)));
-			
-	    
+		// the cube's corners in world space, vertices holds them as packed xyz triples
+		glm::vec4 news [8];
+		glm::transformArray(transform, reinterpret_cast<const glm::vec3 *>(vertices), news, 8);
+
+		// per face view depth, mapped to [0, 1] over the far plane, feeds the depth bits of the sort key.
+		// faces turned away from the camera are culled, the visible list lives on this frame's arena
+		int *sides [] = {side1, side2, side3, side4, side5, side6};
+		float face_depths [6];
+		std::pmr::vector<int> visible_faces(&frame_arenas.arena(jobs.currentWorker()));
+		for (int face = 0; face < 6; face++)
+		{
+			glm::vec4 center = (news[sides[face][0]] + news[sides[face][1]] + news[sides[face][2]] + news[sides[face][3]]) * 0.25f;
+			glm::vec3 view_center = glm::vec3(view * center);
+			face_depths[face] = -view_center.z / 100.0f;
+			if (glm::dot(glm::vec3(center - transform[3]), -view_center) > 0.0f)
+				visible_faces.push_back(face);
+		}
+
+        jobs.parallelFor(visible_faces.size(), 1, [&](std::size_t begin, std::size_t end)
+        {
+            CommandList &list = commands.list(jobs.currentWorker());
+            for (std::size_t i = begin; i < end; i++)
+            {
+                int face = visible_faces[i];
+                DrawUniforms uniforms = {transform, face_colors[face]};
+                DrawItem item;
+                item.program = shaderProgram;
+                item.material = (unsigned int)face;
+                item.vao = VAO;
+                item.depth = face_depths[face];
+                item.firstIndex = (std::uint32_t)face * 6;
+                item.indexCount = 6;
+                list.draw(item, &uniforms, sizeof(uniforms));
+            }
+        });
+        commands.submit();
+        frame_arenas.reset();
+        frame_heap_allocations = heapAllocationCount() - heap_before;
+
+        // state changes the sort saved, refreshed in the title about once a second
+        if (timeValue - last_stats_time >= 1.0)
+        {
+            const RenderStats &stats = commands.stats();
+            char title[128];
+            snprintf(title, sizeof(title), "LearnOpenGL - %u draws, %u binds sorted / %u unsorted, %zu heap allocations",
+                     stats.draws, stats.sorted.total(), stats.unsorted.total(), frame_heap_allocations);
+            glfwSetWindowTitle(window, title);
+            last_stats_time = timeValue;
+        }
 
 
         // glBindVertexArray(0); // no need to unbind it every time 
@@ -318,6 +523,340 @@ void framebuffer_size_callback(GLFWwindow* window, int width, int height)
     glViewport(0, 0, width, height);
 }
 
+// software renderer: draws a grid of cubes with the same buffers and matrices as the GL path.
+// the cubes are ECS entities; each frame is a task graph (animate -> cull -> record -> bin and rasterize) on the
+// job system. the same frames are timed with 1, 2, 4 ... threads and with all of them, to report frame time and
+// triangle throughput
+// -------------------------------------------------------------------------------------------
+int runSoftwareRenderer()
+{
+    struct VisibleDraw
+    {
+        const Transform *transform;
+        const Renderable *renderable;
+    };
+    typedef std::pmr::vector<VisibleDraw> DrawList;
+    const int grid = 64;
+    const int frames = 10;
+    const std::size_t cube_count = grid * grid;
+    const float cube_radius = 0.3f * 1.7320508f;
+    glm::mat4 projection = glm::perspective(glm::radians(45.0f), (float)SCR_WIDTH / (float)SCR_HEIGHT, 0.1f, 100.0f);
+    glm::mat4 view = glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, -60.0f));
+    glm::aligned_mat4 view_projection = glm::aligned_mat4(projection * view);
+
+    // world space frustum planes taken from the rows of the matrix, normalized so they can be tested against a radius
+    glm::aligned_vec4 planes[6];
+    glm::aligned_vec4 row_w(view_projection[0][3], view_projection[1][3], view_projection[2][3], view_projection[3][3]);
+    for (int i = 0; i < 3; i++)
+    {
+        glm::aligned_vec4 row(view_projection[0][i], view_projection[1][i], view_projection[2][i], view_projection[3][i]);
+        planes[i * 2] = row_w + row;
+        planes[i * 2 + 1] = row_w - row;
+    }
+    for (glm::aligned_vec4 &plane : planes)
+        plane /= glm::length(glm::vec3(plane));
+
+    unsigned int maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    // powers of two, then maxThreads itself when it is not one
+    for (unsigned int threads = 1; threads <= maxThreads; threads = threads < maxThreads ? std::min(threads * 2, maxThreads) : threads + 1)
+    {
+        JobSystem jobs(threads);
+        FrameArenas arenas(threads);
+        World world(threads);
+        SoftRasterizer rasterizer(SCR_WIDTH, SCR_HEIGHT, jobs);
+        float angle = 0.0f;
+
+        // spawn the grid from the workers; the entities appear at flush()
+        jobs.parallelFor(cube_count, 256, [&](std::size_t begin, std::size_t end)
+        {
+            DeferredCommands &commands = world.deferred(jobs.currentWorker());
+            for (std::size_t i = begin; i < end; i++)
+            {
+                int x = (int)(i % grid) - grid / 2;
+                int y = (int)(i / grid) - grid / 2;
+                Spin spin = {glm::aligned_vec4(x * 0.8f, y * 0.8f, 0.0f, 0.0f), glm::aligned_vec4(1.0f, 1.0f, 0.0f, 0.05f * (x + y))};
+                Bounds bounds = {glm::aligned_vec4(spin.position.x, spin.position.y, 0.0f, cube_radius)};
+                Renderable renderable = {vertices, indices, 6};
+                commands.create(spin, Transform(), bounds, renderable);
+            }
+        });
+        world.flush();
+
+        // visible set, rebuilt on the arenas every frame: one list per worker
+        DrawList *visible = nullptr;
+
+        TaskGraph frameGraph;
+        int animate = frameGraph.add([&]()
+        {
+            world.each<Spin, Transform, Bounds>(jobs, [&](std::size_t count, const Entity *, Spin *spins, Transform *transforms, Bounds *bounds)
+            {
+                for (std::size_t i = 0; i < count; i++)
+                {
+                    glm::mat4 model = glm::translate(glm::mat4(1.0f), glm::vec3(spins[i].position));
+                    model = glm::rotate(model, angle + spins[i].axisPhase.w, glm::vec3(spins[i].axisPhase));
+                    transforms[i].model = glm::aligned_mat4(model);
+                    transforms[i].mvp = view_projection * transforms[i].model;
+                    bounds[i].sphere = glm::aligned_vec4(glm::vec3(model[3]), bounds[i].sphere.w);
+                }
+            });
+        });
+        int cull = frameGraph.add([&]()
+        {
+            FrameArena &frame = arenas.arena(jobs.currentWorker());
+            visible = frame.allocateArray<DrawList>(threads);
+            for (unsigned int worker = 0; worker < threads; worker++)
+                new (&visible[worker]) DrawList(&arenas.arena(worker));
+
+            world.each<Bounds, Transform, Renderable>(jobs, [&](std::size_t count, const Entity *, Bounds *bounds, Transform *transforms, Renderable *renderables)
+            {
+                DrawList &list = visible[jobs.currentWorker()];
+                for (std::size_t i = 0; i < count; i++)
+                {
+                    glm::aligned_vec4 center(glm::vec3(bounds[i].sphere), 1.0f);
+                    bool inside = true;
+                    for (const glm::aligned_vec4 &plane : planes)
+                        inside = inside && glm::dot(plane, center) >= -bounds[i].sphere.w;
+                    if (inside)
+                        list.push_back({&transforms[i], &renderables[i]});
+                }
+            });
+        }, {animate});
+        int record = frameGraph.add([&]()
+        {
+            rasterizer.clear(glm::vec4(0.2f, 0.3f, 0.3f, 1.0f));
+            for (unsigned int worker = 0; worker < threads; worker++)
+            {
+                for (const VisibleDraw &draw : visible[worker])
+                {
+                    glm::mat4 mvp(draw.transform->mvp);
+                    for (unsigned int face = 0; face < draw.renderable->faceCount; face++)
+                        rasterizer.drawElements(draw.renderable->vertices, draw.renderable->indices, 6, face * 6, mvp, face_colors[face]);
+                }
+            }
+        }, {cull});
+        frameGraph.add([&]() { rasterizer.flush(); }, {record});
+
+        double total = 0.0;
+        std::size_t heap_allocations = 0;
+        std::size_t visible_cubes = 0;
+        std::size_t arena_bytes = 0;
+        unsigned int triangles = 0;
+        for (int frame = 0; frame <= frames; frame++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            std::size_t heap_before = heapAllocationCount();
+            angle = 0.01f * frame;
+            frameGraph.run(jobs);
+            triangles = rasterizer.stats().triangles;
+
+            visible_cubes = 0;
+            for (unsigned int worker = 0; worker < threads; worker++)
+            {
+                visible_cubes += visible[worker].size();
+                visible[worker].~DrawList();
+            }
+            arena_bytes = arenas.bytesUsed();
+            arenas.reset();
+
+            // frame 0 warms up the caches, the bins and the arenas
+            if (frame > 0)
+            {
+                total += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+                heap_allocations += heapAllocationCount() - heap_before;
+            }
+        }
+        double ms = total / frames;
+        std::cout << threads << " thread(s): " << ms << " ms/frame, " << triangles / (ms * 1000.0) << " Mtris/s, "
+                  << visible_cubes << "/" << world.entityCount() << " cubes visible, " << arena_bytes / 1024 << " KB frame arena, "
+                  << (double)heap_allocations / frames << " heap allocations/frame" << std::endl;
+        if (threads == 1)
+            rasterizer.writePpm("software_frame.ppm");
+    }
+    return 0;
+}
+
+
+unsigned int buildProgram(const char *vertex_source, const char *fragment_source)
+{
+    int success;
+    char infoLog[512];
+    unsigned int vertex = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vertex, 1, &vertex_source, NULL);
+    glCompileShader(vertex);
+    glGetShaderiv(vertex, GL_COMPILE_STATUS, &success);
+    if (!success)
+    {
+        glGetShaderInfoLog(vertex, 512, NULL, infoLog);
+        std::cout << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n" << infoLog << std::endl;
+    }
+    unsigned int fragment = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fragment, 1, &fragment_source, NULL);
+    glCompileShader(fragment);
+    glGetShaderiv(fragment, GL_COMPILE_STATUS, &success);
+    if (!success)
+    {
+        glGetShaderInfoLog(fragment, 512, NULL, infoLog);
+        std::cout << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n" << infoLog << std::endl;
+    }
+    unsigned int program = glCreateProgram();
+    glAttachShader(program, vertex);
+    glAttachShader(program, fragment);
+    glLinkProgram(program);
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if (!success)
+    {
+        glGetProgramInfoLog(program, 512, NULL, infoLog);
+        std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << infoLog << std::endl;
+    }
+    glDeleteShader(vertex);
+    glDeleteShader(fragment);
+    return program;
+}
+
+// voxel viewer: orbits an 8x8 chunk terrain that is meshed in the background; space carves a crater at a
+// random spot and only the chunks it touched are meshed and uploaded again
+// -------------------------------------------------------------------------------------------
+int runVoxelViewer(GLFWwindow *window)
+{
+    const int chunks = 8;
+    unsigned int program = buildProgram(voxelVertexShaderSource, voxelFragmentShaderSource);
+    int origin_location = glGetUniformLocation(program, "chunkOrigin");
+    int view_projection_location = glGetUniformLocation(program, "viewProjection");
+
+    // scoped so the chunk buffers are released while the context still exists
+    {
+        JobSystem jobs;
+        VoxelWorld world;
+        buildVoxelTerrain(world, jobs, chunks, chunks);
+        VoxelRenderer voxels(world, jobs);
+        std::mt19937 rng(7);
+        bool space_was_down = false;
+        double last_stats_time = 0.0;
+
+        glEnable(GL_DEPTH_TEST);
+        glEnable(GL_CULL_FACE);
+        while (!glfwWindowShouldClose(window))
+        {
+            processInput(window);
+
+            bool space_down = glfwGetKey(window, GLFW_KEY_SPACE) == GLFW_PRESS;
+            if (space_down && !space_was_down)
+            {
+                glm::ivec3 center((int)(rng() % (chunks * VOXEL_CHUNK_SIZE)), 20, (int)(rng() % (chunks * VOXEL_CHUNK_SIZE)));
+                carveVoxelSphere(world, center, 10);
+            }
+            space_was_down = space_down;
+            voxels.update();
+
+            glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+            double timeValue = glfwGetTime();
+            float half = chunks * VOXEL_CHUNK_SIZE * 0.5f;
+            glm::vec3 target(half, 20.0f, half);
+            glm::vec3 eye = target + glm::vec3(std::cos(timeValue * 0.2) * 300.0f, 180.0f, std::sin(timeValue * 0.2) * 300.0f);
+            glm::mat4 projection = glm::perspective(glm::radians(45.0f), (float)SCR_WIDTH / (float)SCR_HEIGHT, 1.0f, 1000.0f);
+            glm::mat4 view_projection = projection * glm::lookAt(eye, target, glm::vec3(0.0f, 1.0f, 0.0f));
+            glUseProgram(program);
+            glUniformMatrix4fv(view_projection_location, 1, GL_FALSE, glm::value_ptr(view_projection));
+            voxels.draw(origin_location);
+
+            if (timeValue - last_stats_time >= 1.0)
+            {
+                const VoxelRenderer::Stats &stats = voxels.stats();
+                char title[160];
+                snprintf(title, sizeof(title), "LearnOpenGL - %zu chunks, %zu triangles, %zu meshed at %.2f ms/chunk, %zu in flight",
+                         stats.chunks, stats.triangles, stats.meshed, stats.meshed ? stats.meshMilliseconds / stats.meshed : 0.0, stats.inFlight);
+                glfwSetWindowTitle(window, title);
+                last_stats_time = timeValue;
+            }
+
+            glfwSwapBuffers(window);
+            glfwPollEvents();
+        }
+    }
+
+    glDeleteProgram(program);
+    glfwTerminate();
+    return 0;
+}
+
+// skinning viewer: a 256K vertex tube on 64 joints that bends and twists back and forth, skinned on the job system
+// every frame and streamed into its VBO by SkinnedMeshRenderer; space switches between dual quaternion and linear
+// blend skinning
+// -------------------------------------------------------------------------------------------
+int runSkinningViewer(GLFWwindow *window)
+{
+    const int joint_count = 64;
+    const float length = 16.0f;
+    unsigned int program = buildProgram(skinnedVertexShaderSource, skinnedFragmentShaderSource);
+    int view_projection_location = glGetUniformLocation(program, "viewProjection");
+
+    // scoped so the mesh buffers are released while the context still exists
+    {
+        JobSystem jobs;
+        SkinnedMesh mesh;
+        std::vector<unsigned int> indices;
+        buildSkinnedTube(joint_count, 2048, 128, length, mesh, &indices);
+        SkinnedMeshRenderer renderer(mesh, indices);
+        SkinningPalette palette;
+        std::vector<glm::quat> rotations(joint_count);
+        std::vector<glm::vec3> translations(joint_count);
+        SkinningMode mode = SkinningMode::DualQuaternion;
+        bool space_was_down = false;
+        double skin_ms = 0.0;
+        int skinned_frames = 0;
+        double last_stats_time = 0.0;
+
+        glEnable(GL_DEPTH_TEST);
+        while (!glfwWindowShouldClose(window))
+        {
+            processInput(window);
+
+            bool space_down = glfwGetKey(window, GLFW_KEY_SPACE) == GLFW_PRESS;
+            if (space_down && !space_was_down)
+                mode = mode == SkinningMode::DualQuaternion ? SkinningMode::Linear : SkinningMode::DualQuaternion;
+            space_was_down = space_down;
+
+            double timeValue = glfwGetTime();
+            poseSkinnedTube(joint_count, length, 0.04f * (float)std::sin(timeValue * 0.7), 0.1f * (float)std::sin(timeValue),
+                            rotations.data(), translations.data());
+            palette.build(rotations.data(), translations.data(), joint_count);
+            auto start = std::chrono::steady_clock::now();
+            renderer.update(jobs, mode, palette);
+            skin_ms += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            skinned_frames++;
+
+            glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+            glm::vec3 target(length * 0.5f, 0.0f, 0.0f);
+            glm::vec3 eye = target + glm::vec3(std::cos(timeValue * 0.2) * 14.0f, 6.0f, std::sin(timeValue * 0.2) * 14.0f);
+            glm::mat4 projection = glm::perspective(glm::radians(45.0f), (float)SCR_WIDTH / (float)SCR_HEIGHT, 0.1f, 100.0f);
+            glm::mat4 view_projection = projection * glm::lookAt(eye, target, glm::vec3(0.0f, 1.0f, 0.0f));
+            glUseProgram(program);
+            glUniformMatrix4fv(view_projection_location, 1, GL_FALSE, glm::value_ptr(view_projection));
+            renderer.draw();
+
+            if (timeValue - last_stats_time >= 1.0)
+            {
+                char title[160];
+                snprintf(title, sizeof(title), "LearnOpenGL - %s skinning, %zu vertices at %.2f ms/frame on %u thread(s)",
+                         mode == SkinningMode::DualQuaternion ? "dual quaternion" : "linear blend", mesh.size(),
+                         skin_ms / skinned_frames, jobs.threadCount());
+                glfwSetWindowTitle(window, title);
+                last_stats_time = timeValue;
+                skin_ms = 0.0;
+                skinned_frames = 0;
+            }
+
+            glfwSwapBuffers(window);
+            glfwPollEvents();
+        }
+    }
+
+    glDeleteProgram(program);
+    glfwTerminate();
+    return 0;
+}
 
 
 /*
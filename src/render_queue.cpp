@@ -0,0 +1,49 @@
+#include "render_queue.h"
+
+#include <algorithm>
+
+std::uint64_t makeSortKey(unsigned int layer, unsigned int program, unsigned int material, unsigned int vao, float depth)
+{
+    std::uint64_t quantized = (std::uint64_t)(std::min(std::max(depth, 0.0f), 1.0f) * 0xfffff);
+    return (std::uint64_t)(layer & 0xf) << 60
+         | (std::uint64_t)(program & 0xfff) << 48
+         | (std::uint64_t)(material & 0xffff) << 32
+         | (std::uint64_t)(vao & 0xfff) << 20
+         | quantized;
+}
+
+void radixSort(std::vector<SortItem> &items, std::vector<SortItem> &scratch)
+{
+    std::size_t count = items.size();
+    if (count < 2)
+        return;
+    scratch.resize(count);
+
+    // all eight histograms in one read of the keys
+    std::uint32_t histograms[8][256] = {};
+    for (const SortItem &item : items)
+        for (int pass = 0; pass < 8; pass++)
+            histograms[pass][(item.key >> (pass * 8)) & 0xff]++;
+
+    SortItem *src = items.data();
+    SortItem *dst = scratch.data();
+    for (int pass = 0; pass < 8; pass++)
+    {
+        std::uint32_t *histogram = histograms[pass];
+        if (histogram[(src[0].key >> (pass * 8)) & 0xff] == count)
+            continue;
+
+        std::uint32_t offset = 0;
+        for (int bucket = 0; bucket < 256; bucket++)
+        {
+            std::uint32_t n = histogram[bucket];
+            histogram[bucket] = offset;
+            offset += n;
+        }
+        for (std::size_t i = 0; i < count; i++)
+            dst[histogram[(src[i].key >> (pass * 8)) & 0xff]++] = src[i];
+        std::swap(src, dst);
+    }
+    if (src != items.data())
+        items.swap(scratch);
+}
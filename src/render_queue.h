@@ -0,0 +1,42 @@
+#ifndef RENDER_QUEUE_H
+#define RENDER_QUEUE_H
+
+#include <cstdint>
+#include <vector>
+
+// draw ordering: every draw gets a 64-bit key, most significant field first
+//
+//   layer (4) | program (12) | material (16) | vao (12) | depth (20)
+//
+// so sorting groups draws by pass, then by the most expensive state to switch, and draws front to back
+// inside a group. depth is in [0, 1]; pass 1 - depth for layers that must be drawn back to front.
+// program and vao are GL names truncated to their field, a collision only costs an extra bind.
+std::uint64_t makeSortKey(unsigned int layer, unsigned int program, unsigned int material, unsigned int vao, float depth);
+
+struct SortItem
+{
+    std::uint64_t key;
+    std::uint32_t index;
+};
+
+// stable LSD radix sort by key, 8 bits per pass; passes over bytes that are equal in every key are skipped
+void radixSort(std::vector<SortItem> &items, std::vector<SortItem> &scratch);
+
+// binds needed to walk a draw list, counted in recording order and in key order
+struct StateChanges
+{
+    unsigned int programs = 0;
+    unsigned int vaos = 0;
+    unsigned int materials = 0;
+
+    unsigned int total() const { return programs + vaos + materials; }
+};
+
+struct RenderStats
+{
+    unsigned int draws = 0;
+    StateChanges unsorted;
+    StateChanges sorted;
+};
+
+#endif
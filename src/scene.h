@@ -0,0 +1,32 @@
+#ifndef SCENE_H
+#define SCENE_H
+
+#include <glm/glm.hpp>
+#include <glm/gtc/type_aligned.hpp>
+
+// scene components of the software renderer, stored and iterated by the ECS
+struct Transform
+{
+    glm::aligned_mat4 model;
+    glm::aligned_mat4 mvp;
+};
+
+struct Spin
+{
+    glm::aligned_vec4 position;     // w unused
+    glm::aligned_vec4 axisPhase;    // rotation axis in xyz, angle offset in w
+};
+
+struct Bounds
+{
+    glm::aligned_vec4 sphere;       // world space center in xyz, radius in w
+};
+
+struct Renderable
+{
+    const float *vertices;
+    const unsigned int *indices;
+    unsigned int faceCount;         // 6 indices per face, colored with face_colors
+};
+
+#endif
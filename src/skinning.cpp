@@ -0,0 +1,134 @@
+#include "skinning.h"
+
+#include <glm/gtc/constants.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+void SkinningPalette::build(const glm::quat *rotations, const glm::vec3 *translations, std::size_t count)
+{
+    dualQuats.resize(count);
+    matrices.resize(count);
+    for (std::size_t i = 0; i < count; i++)
+        dualQuats[i] = glm::dualquat(rotations[i], translations[i]);
+    glm::mat3x4_castArray(rotations, translations, matrices.data(), count);
+}
+
+void skinMesh(JobSystem &jobs, SkinningMode mode, const SkinningPalette &palette, const SkinnedMesh &mesh,
+              glm::vec3 *outPositions, glm::vec3 *outNormals)
+{
+    // chunks of a few hundred KB of vertex data, enough to hide the task overhead behind the kernels
+    jobs.parallelFor(mesh.size(), 4096, [&](std::size_t begin, std::size_t end)
+    {
+        if (mode == SkinningMode::DualQuaternion)
+            glm::skinDualQuatArray(palette.dualQuats.data(), &mesh.joints[begin], &mesh.weights[begin], &mesh.positions[begin],
+                                   &mesh.normals[begin], outPositions + begin, outNormals + begin, end - begin);
+        else
+            glm::skinLinearArray(palette.matrices.data(), &mesh.joints[begin], &mesh.weights[begin], &mesh.positions[begin],
+                                 &mesh.normals[begin], outPositions + begin, outNormals + begin, end - begin);
+    });
+}
+
+void buildSkinnedTube(int jointCount, int rings, int ringSize, float length, SkinnedMesh &mesh,
+                      std::vector<unsigned int> *indices)
+{
+    std::size_t count = std::size_t(rings) * ringSize;
+    mesh.positions.resize(count);
+    mesh.normals.resize(count);
+    mesh.joints.resize(count);
+    mesh.weights.resize(count);
+    for (int r = 0; r < rings; r++)
+    {
+        float x = length * r / (rings - 1);
+        // the joint the ring sits on, and how far along it, for weights that fade over two joints each way
+        float along = x / length * (jointCount - 1);
+        int joint = std::min(int(along), jointCount - 2);
+        float f = along - joint;
+        glm::vec4 weights(0.5f * (1.0f - f), 0.5f * f, 0.25f * (1.0f - f), 0.25f * f);
+        weights /= weights.x + weights.y + weights.z + weights.w;
+        glm::u16vec4 joints(joint, joint + 1, std::max(joint - 1, 0), std::min(joint + 2, jointCount - 1));
+        for (int k = 0; k < ringSize; k++)
+        {
+            float angle = glm::two_pi<float>() * k / ringSize;
+            std::size_t i = std::size_t(r) * ringSize + k;
+            mesh.normals[i] = glm::vec3(0.0f, std::cos(angle), std::sin(angle));
+            mesh.positions[i] = glm::vec3(x, 0.0f, 0.0f) + 0.5f * mesh.normals[i];
+            mesh.joints[i] = joints;
+            mesh.weights[i] = weights;
+        }
+    }
+    if (!indices)
+        return;
+
+    // two counter-clockwise triangles, seen from outside, between each pair of neighbors on two rings
+    indices->clear();
+    indices->reserve(std::size_t(rings - 1) * ringSize * 6);
+    for (int r = 0; r + 1 < rings; r++)
+        for (int k = 0; k < ringSize; k++)
+        {
+            unsigned int a = r * ringSize + k, b = r * ringSize + (k + 1) % ringSize;
+            unsigned int c = a + ringSize, d = b + ringSize;
+            indices->insert(indices->end(), {a, b, c, b, d, c});
+        }
+}
+
+void poseSkinnedTube(int jointCount, float length, float bend, float twist, glm::quat *rotations, glm::vec3 *translations)
+{
+    glm::quat world(1.0f, 0.0f, 0.0f, 0.0f);
+    glm::vec3 origin(0.0f);
+    for (int j = 0; j < jointCount; j++)
+    {
+        glm::vec3 bind(length * j / (jointCount - 1), 0.0f, 0.0f);
+        if (j > 0)
+            origin += world * glm::vec3(length / (jointCount - 1), 0.0f, 0.0f);
+        world = world * glm::angleAxis(bend, glm::vec3(0.0f, 0.0f, 1.0f)) * glm::angleAxis(twist, glm::vec3(1.0f, 0.0f, 0.0f));
+        rotations[j] = world;
+        translations[j] = origin - world * bind;
+    }
+}
+
+SkinnedMeshRenderer::SkinnedMeshRenderer(const SkinnedMesh &mesh, const std::vector<unsigned int> &indices)
+    : mesh(mesh), stream(3 * 2 * sizeof(glm::vec3) * mesh.size()), indexCount(static_cast<GLsizei>(indices.size()))
+{
+    GLsizeiptr size = static_cast<GLsizeiptr>(2 * sizeof(glm::vec3) * mesh.size());
+    glGenVertexArrays(1, &vao);
+    glGenBuffers(1, &vbo);
+    glGenBuffers(1, &ebo);
+    glBindVertexArray(vao);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(glm::vec3), (void *)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(glm::vec3), (void *)(sizeof(glm::vec3) * mesh.size()));
+    glEnableVertexAttribArray(1);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
+    glBindVertexArray(0);
+}
+
+SkinnedMeshRenderer::~SkinnedMeshRenderer()
+{
+    glDeleteVertexArrays(1, &vao);
+    glDeleteBuffers(1, &vbo);
+    glDeleteBuffers(1, &ebo);
+}
+
+void SkinnedMeshRenderer::update(JobSystem &jobs, SkinningMode mode, const SkinningPalette &palette)
+{
+    // the workers write their chunks straight into the mapped ring; only this thread touches GL
+    GLsizeiptr size = static_cast<GLsizeiptr>(2 * sizeof(glm::vec3) * mesh.size());
+    GLintptr offset;
+    glm::vec3 *positions = static_cast<glm::vec3 *>(stream.map(size, offset));
+    skinMesh(jobs, mode, palette, mesh, positions, positions + mesh.size());
+    stream.unmap();
+
+    glBindBuffer(GL_COPY_WRITE_BUFFER, vbo);
+    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, offset, 0, size);
+    stream.fence();
+}
+
+void SkinnedMeshRenderer::draw() const
+{
+    glBindVertexArray(vao);
+    glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, (void *)0);
+}
@@ -0,0 +1,90 @@
+#ifndef SKINNING_H
+#define SKINNING_H
+
+#include <glad/glad.h>
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#define GLM_ENABLE_EXPERIMENTAL
+#endif
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtx/skinning.hpp>
+
+#include <cstddef>
+#include <vector>
+
+#include "job_system.h"
+#include "stream_buffer.h"
+
+// CPU skinning: every vertex blends up to four joints of a palette by its weights and moves its bind position
+// and normal with the blend. the vertices are split into chunks over the job system, every chunk is one call of
+// the batched glm kernels (gtx/skinning).
+
+enum class SkinningMode
+{
+    DualQuaternion,   // blends rigid joint transforms as dual quaternions, keeps the volume where joints twist
+    Linear            // blends the joint matrices; cheaper, collapses around twisting joints
+};
+
+// bind pose; joints index the palette, the weights of a vertex sum to 1 and unused influences have weight 0
+struct SkinnedMesh
+{
+    std::vector<glm::vec3> positions;
+    std::vector<glm::vec3> normals;
+    std::vector<glm::u16vec4> joints;
+    std::vector<glm::vec4> weights;
+
+    std::size_t size() const { return positions.size(); }
+};
+
+// the joint transforms of one pose, from bind space to posed space, in the form of each mode
+struct SkinningPalette
+{
+    std::vector<glm::dualquat> dualQuats;
+    std::vector<glm::mat3x4> matrices;      // gtx/matrix_affine rows
+
+    // joint i rotates by rotations[i], then moves by translations[i]
+    void build(const glm::quat *rotations, const glm::vec3 *translations, std::size_t count);
+};
+
+// skins every vertex of the mesh into outPositions / outNormals, which hold mesh.size() entries
+void skinMesh(JobSystem &jobs, SkinningMode mode, const SkinningPalette &palette, const SkinnedMesh &mesh,
+              glm::vec3 *outPositions, glm::vec3 *outNormals);
+
+// demo content for --skinning-bench and --skinning: a tube of radius 0.5 along x from 0 to length, rings of ringSize
+// vertices, skinned to jointCount joints spaced evenly along it with every vertex weighted between the four joints
+// nearest along the tube. indices, if given, receives its wall as a triangle list
+void buildSkinnedTube(int jointCount, int rings, int ringSize, float length, SkinnedMesh &mesh,
+                      std::vector<unsigned int> *indices = nullptr);
+
+// a pose of that tube for SkinningPalette::build: every joint bends by bend radians about z and twists by twist
+// radians about x on top of the joint before it, about its own position on the tube
+void poseSkinnedTube(int jointCount, float length, float bend, float twist, glm::quat *rotations, glm::vec3 *translations);
+
+// keeps the skinned vertices of one mesh in a VBO. update() maps a StreamBuffer range, skins straight into it
+// on the job system and copies it into the VBO on the GPU, so the vertices never go through an extra CPU copy.
+// the VBO holds all positions followed by all normals, attributes 0 and 1.
+class SkinnedMeshRenderer
+{
+public:
+    // needs a current GL context; the mesh must outlive the renderer, indices are a triangle list
+    SkinnedMeshRenderer(const SkinnedMesh &mesh, const std::vector<unsigned int> &indices);
+    ~SkinnedMeshRenderer();
+
+    SkinnedMeshRenderer(const SkinnedMeshRenderer &) = delete;
+    SkinnedMeshRenderer &operator=(const SkinnedMeshRenderer &) = delete;
+
+    void update(JobSystem &jobs, SkinningMode mode, const SkinningPalette &palette);
+
+    // the program is bound by the caller
+    void draw() const;
+
+private:
+    const SkinnedMesh &mesh;
+    StreamBuffer stream;
+    GLuint vao = 0;
+    GLuint vbo = 0;
+    GLuint ebo = 0;
+    GLsizei indexCount;
+};
+
+#endif
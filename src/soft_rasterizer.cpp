@@ -0,0 +1,374 @@
+#include "soft_rasterizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <stdexcept>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SOFT_RASTERIZER_SSE2
+#endif
+
+namespace
+{
+    std::uint32_t packColor(const glm::vec4 &c)
+    {
+        glm::vec4 v = glm::clamp(c, 0.0f, 1.0f) * 255.0f + 0.5f;
+        return (std::uint32_t)v.r | ((std::uint32_t)v.g << 8) | ((std::uint32_t)v.b << 16) | ((std::uint32_t)v.a << 24);
+    }
+}
+
+SoftRasterizer::SoftRasterizer(int width, int height, JobSystem &jobs)
+    : jobs(jobs), imageWidth(width), imageHeight(height)
+{
+    if (width > MAX_SIZE || height > MAX_SIZE)
+        throw std::length_error("SoftRasterizer: image larger than MAX_SIZE");
+    tilesX = (width + TILE_SIZE - 1) / TILE_SIZE;
+    tilesY = (height + TILE_SIZE - 1) / TILE_SIZE;
+    stride = tilesX * TILE_SIZE;
+    paddedHeight = tilesY * TILE_SIZE;
+    color.resize(stride * paddedHeight);
+    depth.resize(stride * paddedHeight);
+
+    // GUARD_BAND pixels past the left, right, top and bottom edges, in clip space
+    float guardX = 1.0f + 2.0f * GUARD_BAND / width;
+    float guardY = 1.0f + 2.0f * GUARD_BAND / height;
+    clipPlanes[0] = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f);
+    clipPlanes[1] = glm::vec4(1.0f, 0.0f, 0.0f, guardX);
+    clipPlanes[2] = glm::vec4(-1.0f, 0.0f, 0.0f, guardX);
+    clipPlanes[3] = glm::vec4(0.0f, 1.0f, 0.0f, guardY);
+    clipPlanes[4] = glm::vec4(0.0f, -1.0f, 0.0f, guardY);
+}
+
+void SoftRasterizer::clear(const glm::vec4 &c)
+{
+    clearColor = packColor(c);
+    pendingClear = true;
+    frameStats = Stats();
+}
+
+void SoftRasterizer::drawElements(const float *vertices, const unsigned int *indices, unsigned int count, unsigned int first,
+                                  const glm::mat4 &mvp, const glm::vec4 &c)
+{
+    if (count < 3)
+        return;
+    draws.push_back({vertices, indices, first, recordedTriangles, mvp, packColor(c)});
+    recordedTriangles += count / 3;
+}
+
+void SoftRasterizer::binBatch(std::size_t index)
+{
+    Batch &batch = batches[index];
+
+    // the run of triangles may start inside a draw and end inside another one
+    std::size_t begin = index * BATCH_TRIANGLES;
+    std::size_t end = std::min(begin + BATCH_TRIANGLES, recordedTriangles);
+    std::size_t d = std::upper_bound(draws.begin(), draws.end(), begin,
+                                     [](std::size_t triangle, const Draw &draw) { return triangle < draw.firstTriangle; }) - draws.begin() - 1;
+    for (; d < draws.size() && draws[d].firstTriangle < end; d++)
+    {
+        const Draw &draw = draws[d];
+        std::size_t drawEnd = d + 1 < draws.size() ? draws[d + 1].firstTriangle : recordedTriangles;
+        std::size_t from = std::max(begin, draw.firstTriangle) - draw.firstTriangle;
+        std::size_t to = std::min(end, drawEnd) - draw.firstTriangle;
+        for (std::size_t t = from; t < to; t++)
+        {
+            glm::vec4 polygon[2][8];
+            glm::vec4 *in = polygon[0], *out = polygon[1];
+            int n = 3;
+            for (int k = 0; k < 3; k++)
+            {
+                const float *p = &draw.vertices[draw.indices[draw.first + t * 3 + k] * 3];
+                in[k] = draw.mvp * glm::vec4(p[0], p[1], p[2], 1.0f);
+            }
+
+            // clip against the near plane (z >= -w) and the guard band, which keeps the snapped positions small
+            // enough for the edge functions; the screen bounds do the rest of x, y and the depth test does far z
+            for (const glm::vec4 &plane : clipPlanes)
+            {
+                bool crossed = false;
+                for (int k = 0; k < n; k++)
+                    crossed = crossed || glm::dot(plane, in[k]) < 0.0f;
+                if (!crossed)
+                    continue;
+                int m = 0;
+                for (int k = 0; k < n; k++)
+                {
+                    const glm::vec4 &a = in[k];
+                    const glm::vec4 &b = in[(k + 1) % n];
+                    float da = glm::dot(plane, a);
+                    float db = glm::dot(plane, b);
+                    if (da >= 0.0f)
+                        out[m++] = a;
+                    // always from the inside end, so the triangle across a shared edge gets the same point
+                    if (da >= 0.0f && db < 0.0f)
+                        out[m++] = glm::mix(a, b, da / (da - db));
+                    else if (da < 0.0f && db >= 0.0f)
+                        out[m++] = glm::mix(b, a, db / (db - da));
+                }
+                std::swap(in, out);
+                n = m;
+            }
+            for (int k = 2; k < n; k++)
+                setupTriangle(batch, in[0], in[k - 1], in[k], draw.color);
+        }
+    }
+
+    // bins back to back in one array: count the triangles of each tile, then place them in submission order
+    std::size_t tileCount = tilesX * tilesY;
+    batch.binStart.assign(tileCount + 1, 0);
+    for (const Triangle &tri : batch.triangles)
+    {
+        for (int ty = tri.minY / TILE_SIZE; ty <= tri.maxY / TILE_SIZE; ty++)
+        {
+            for (int tx = tri.minX / TILE_SIZE; tx <= tri.maxX / TILE_SIZE; tx++)
+                batch.binStart[ty * tilesX + tx + 1]++;
+        }
+    }
+    for (std::size_t tile = 0; tile < tileCount; tile++)
+        batch.binStart[tile + 1] += batch.binStart[tile];
+    // with room to spare, a few more tiles touched in a later frame should not reallocate
+    if (batch.binned.capacity() < batch.binStart[tileCount])
+        batch.binned.reserve(batch.binStart[tileCount] * 2);
+    batch.binned.resize(batch.binStart[tileCount]);
+    batch.cursor.assign(batch.binStart.begin(), batch.binStart.end() - 1);
+    for (std::size_t i = 0; i < batch.triangles.size(); i++)
+    {
+        const Triangle &tri = batch.triangles[i];
+        for (int ty = tri.minY / TILE_SIZE; ty <= tri.maxY / TILE_SIZE; ty++)
+        {
+            for (int tx = tri.minX / TILE_SIZE; tx <= tri.maxX / TILE_SIZE; tx++)
+                batch.binned[batch.cursor[ty * tilesX + tx]++] = static_cast<unsigned int>(i);
+        }
+    }
+    batch.stats.binnedTiles = batch.binStart[tileCount];
+}
+
+void SoftRasterizer::setupTriangle(Batch &batch, const glm::vec4 &c0, const glm::vec4 &c1, const glm::vec4 &c2, std::uint32_t packedColor)
+{
+    // clip space -> window space, y pointing down so row 0 is the top of the image, x and y snapped to subpixels
+    glm::vec3 v[3];
+    std::int64_t x[3], y[3];
+    const glm::vec4 *clip[3] = {&c0, &c1, &c2};
+    for (int k = 0; k < 3; k++)
+    {
+        glm::vec3 ndc = glm::vec3(*clip[k]) / clip[k]->w;
+        x[k] = (std::int64_t)std::floor((ndc.x * 0.5f + 0.5f) * imageWidth * SUBPIXEL + 0.5f);
+        y[k] = (std::int64_t)std::floor((0.5f - ndc.y * 0.5f) * imageHeight * SUBPIXEL + 0.5f);
+        v[k] = glm::vec3((float)x[k] / SUBPIXEL, (float)y[k] / SUBPIXEL, ndc.z * 0.5f + 0.5f);
+    }
+
+    std::int64_t area = (x[1] - x[0]) * (y[2] - y[0]) - (y[1] - y[0]) * (x[2] - x[0]);
+    if (area == 0)
+        return;
+    if (area < 0)
+    {
+        // GL draws both windings here (no face culling), flip so the edge functions are positive inside
+        std::swap(v[1], v[2]);
+        std::swap(x[1], x[2]);
+        std::swap(y[1], y[2]);
+        area = -area;
+    }
+
+    Triangle tri;
+    tri.minX = std::max(0, (int)std::floor(std::min(v[0].x, std::min(v[1].x, v[2].x))));
+    tri.minY = std::max(0, (int)std::floor(std::min(v[0].y, std::min(v[1].y, v[2].y))));
+    tri.maxX = std::min(imageWidth - 1, (int)std::ceil(std::max(v[0].x, std::max(v[1].x, v[2].x))));
+    tri.maxY = std::min(imageHeight - 1, (int)std::ceil(std::max(v[0].y, std::max(v[1].y, v[2].y))));
+    if (tri.minX > tri.maxX || tri.minY > tri.maxY)
+        return;
+
+    // depth gradient from the differences to vertex 0: summing z * barycentric plane over the three vertices
+    // cancels terms in the thousands down to a depth near 1, and loses more than a small cube's depth range
+    float invArea = float(SUBPIXEL * SUBPIXEL) / (float)area;
+    float dx1 = v[1].x - v[0].x, dy1 = v[1].y - v[0].y, dz1 = v[1].z - v[0].z;
+    float dx2 = v[2].x - v[0].x, dy2 = v[2].y - v[0].y, dz2 = v[2].z - v[0].z;
+    tri.depthA = (dz1 * dy2 - dz2 * dy1) * invArea;
+    tri.depthB = (dz2 * dx1 - dz1 * dx2) * invArea;
+    tri.depthC = v[0].z - tri.depthA * v[0].x - tri.depthB * v[0].y;
+
+    for (int i = 0; i < 3; i++)
+    {
+        int a = (i + 1) % 3;
+        int b = (i + 2) % 3;
+        std::int64_t stepX = y[a] - y[b];
+        std::int64_t stepY = x[b] - x[a];
+        // top-left fill rule: a pixel centre right on the edge belongs to the triangle it is a left edge of
+        // (inside to its right) or a top edge of (horizontal, inside below), elsewhere the bias of -1 leaves it out
+        bool topLeft = stepX > 0 || (stepX == 0 && stepY > 0);
+        tri.edgeA[i] = (int)(stepX * SUBPIXEL);
+        tri.edgeB[i] = (int)(stepY * SUBPIXEL);
+        tri.edgeC[i] = (stepX + stepY) * (SUBPIXEL / 2) + x[a] * y[b] - y[a] * x[b] - (topLeft ? 0 : 1);
+    }
+    tri.color = packedColor;
+
+    batch.triangles.push_back(tri);
+    batch.stats.triangles++;
+}
+
+void SoftRasterizer::flush()
+{
+    // batches keep their arrays' capacity between frames, like the draw list
+    batchCount = (recordedTriangles + BATCH_TRIANGLES - 1) / BATCH_TRIANGLES;
+    if (batches.size() < batchCount)
+        batches.resize(batchCount);
+    jobs.parallelFor(batchCount, 1, [this](std::size_t begin, std::size_t end)
+    {
+        for (std::size_t batch = begin; batch < end; batch++)
+            binBatch(batch);
+    });
+    for (std::size_t i = 0; i < batchCount; i++)
+    {
+        frameStats.triangles += batches[i].stats.triangles;
+        frameStats.binnedTiles += batches[i].stats.binnedTiles;
+    }
+
+    jobs.parallelFor(tilesX * tilesY, 1, [this](std::size_t begin, std::size_t end)
+    {
+        for (std::size_t tile = begin; tile < end; tile++)
+            rasterizeTile(static_cast<unsigned int>(tile));
+    });
+
+    pendingClear = false;
+    for (std::size_t i = 0; i < batchCount; i++)
+    {
+        Batch &batch = batches[i];
+        batch.triangles.clear();
+        batch.stats = Stats();
+    }
+    batchCount = 0;
+    draws.clear();
+    recordedTriangles = 0;
+}
+
+void SoftRasterizer::rasterizeTile(unsigned int tile)
+{
+    int x0 = (tile % tilesX) * TILE_SIZE;
+    int y0 = (tile / tilesX) * TILE_SIZE;
+
+    if (pendingClear)
+    {
+        for (int y = y0; y < y0 + TILE_SIZE; y++)
+        {
+            std::fill_n(&color[y * stride + x0], TILE_SIZE, clearColor);
+            std::fill_n(&depth[y * stride + x0], TILE_SIZE, 1.0f);
+        }
+    }
+
+    for (std::size_t b = 0; b < batchCount; b++)
+    {
+        const Batch &batch = batches[b];
+        for (unsigned int i = batch.binStart[tile]; i < batch.binStart[tile + 1]; i++)
+        {
+            const Triangle &tri = batch.triangles[batch.binned[i]];
+            // 4 pixel groups start on a multiple of 4 so they never straddle the tile edge
+            int minX = std::max(tri.minX, x0) & ~3;
+            int maxX = std::min(tri.maxX, x0 + TILE_SIZE - 1);
+            int minY = std::max(tri.minY, y0);
+            int maxY = std::min(tri.maxY, y0 + TILE_SIZE - 1);
+
+            // edge values at the centre of (minX, minY). the steps across a tile add up to less than 2^28, so a
+            // value beyond 2^30 is clamped there and keeps its sign at every pixel of the tile
+            int e[3];
+            for (int i = 0; i < 3; i++)
+            {
+                std::int64_t value = tri.edgeC[i] + (std::int64_t)tri.edgeA[i] * minX + (std::int64_t)tri.edgeB[i] * minY;
+                e[i] = (int)std::max<std::int64_t>(-(1 << 30), std::min<std::int64_t>(1 << 30, value));
+            }
+
+#ifdef SOFT_RASTERIZER_SSE2
+            const __m128 lane = _mm_set_ps(3.5f, 2.5f, 1.5f, 0.5f);
+            const __m128 zero = _mm_setzero_ps();
+            const __m128i outsideValue = _mm_set1_epi32(-1);
+            const __m128i packed = _mm_set1_epi32((int)tri.color);
+            __m128i row0 = _mm_add_epi32(_mm_set1_epi32(e[0]), _mm_set_epi32(3 * tri.edgeA[0], 2 * tri.edgeA[0], tri.edgeA[0], 0));
+            __m128i row1 = _mm_add_epi32(_mm_set1_epi32(e[1]), _mm_set_epi32(3 * tri.edgeA[1], 2 * tri.edgeA[1], tri.edgeA[1], 0));
+            __m128i row2 = _mm_add_epi32(_mm_set1_epi32(e[2]), _mm_set_epi32(3 * tri.edgeA[2], 2 * tri.edgeA[2], tri.edgeA[2], 0));
+            __m128i dx0 = _mm_set1_epi32(4 * tri.edgeA[0]), dx1 = _mm_set1_epi32(4 * tri.edgeA[1]), dx2 = _mm_set1_epi32(4 * tri.edgeA[2]);
+            __m128i dy0 = _mm_set1_epi32(tri.edgeB[0]), dy1 = _mm_set1_epi32(tri.edgeB[1]), dy2 = _mm_set1_epi32(tri.edgeB[2]);
+            __m128 za = _mm_set1_ps(tri.depthA);
+            for (int y = minY; y <= maxY; y++)
+            {
+                float py = y + 0.5f;
+                __m128 rz = _mm_set1_ps(tri.depthB * py + tri.depthC);
+                __m128i w0 = row0, w1 = row1, w2 = row2;
+                for (int x = minX; x <= maxX; x += 4)
+                {
+                    // a lane is inside when none of its edge values is negative
+                    __m128i any = _mm_or_si128(w0, _mm_or_si128(w1, w2));
+                    if (_mm_movemask_ps(_mm_castsi128_ps(any)) != 0xf)
+                    {
+                        __m128 inside = _mm_castsi128_ps(_mm_cmpgt_epi32(any, outsideValue));
+                        __m128 px = _mm_add_ps(_mm_set1_ps((float)x), lane);
+                        float *d = &depth[y * stride + x];
+                        __m128 z = _mm_add_ps(_mm_mul_ps(za, px), rz);
+                        __m128 old = _mm_loadu_ps(d);
+                        __m128 pass = _mm_and_ps(inside, _mm_and_ps(_mm_cmplt_ps(z, old), _mm_cmpge_ps(z, zero)));
+                        if (_mm_movemask_ps(pass) != 0)
+                        {
+                            _mm_storeu_ps(d, _mm_or_ps(_mm_and_ps(pass, z), _mm_andnot_ps(pass, old)));
+                            __m128i *c = reinterpret_cast<__m128i *>(&color[y * stride + x]);
+                            __m128i mask = _mm_castps_si128(pass);
+                            __m128i prev = _mm_loadu_si128(c);
+                            _mm_storeu_si128(c, _mm_or_si128(_mm_and_si128(mask, packed), _mm_andnot_si128(mask, prev)));
+                        }
+                    }
+                    w0 = _mm_add_epi32(w0, dx0);
+                    w1 = _mm_add_epi32(w1, dx1);
+                    w2 = _mm_add_epi32(w2, dx2);
+                }
+                row0 = _mm_add_epi32(row0, dy0);
+                row1 = _mm_add_epi32(row1, dy1);
+                row2 = _mm_add_epi32(row2, dy2);
+            }
+#else
+            for (int y = minY; y <= maxY; y++)
+            {
+                float py = y + 0.5f;
+                int w0 = e[0], w1 = e[1], w2 = e[2];
+                for (int x = minX; x <= maxX; x++)
+                {
+                    if ((w0 | w1 | w2) >= 0)
+                    {
+                        float z = tri.depthA * (x + 0.5f) + tri.depthB * py + tri.depthC;
+                        float &d = depth[y * stride + x];
+                        if (z < d && z >= 0.0f)
+                        {
+                            d = z;
+                            color[y * stride + x] = tri.color;
+                        }
+                    }
+                    w0 += tri.edgeA[0];
+                    w1 += tri.edgeA[1];
+                    w2 += tri.edgeA[2];
+                }
+                e[0] += tri.edgeB[0];
+                e[1] += tri.edgeB[1];
+                e[2] += tri.edgeB[2];
+            }
+#endif
+        }
+    }
+}
+
+bool SoftRasterizer::writePpm(const char *path) const
+{
+    FILE *file = std::fopen(path, "wb");
+    if (!file)
+        return false;
+    std::fprintf(file, "P6\n%d %d\n255\n", imageWidth, imageHeight);
+    std::vector<unsigned char> row(imageWidth * 3);
+    for (int y = 0; y < imageHeight; y++)
+    {
+        for (int x = 0; x < imageWidth; x++)
+        {
+            std::uint32_t p = pixel(x, y);
+            row[x * 3 + 0] = p & 0xff;
+            row[x * 3 + 1] = (p >> 8) & 0xff;
+            row[x * 3 + 2] = (p >> 16) & 0xff;
+        }
+        std::fwrite(row.data(), 1, row.size(), file);
+    }
+    return std::fclose(file) == 0;
+}
@@ -0,0 +1,113 @@
+#ifndef SOFT_RASTERIZER_H
+#define SOFT_RASTERIZER_H
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include "job_system.h"
+
+// CPU fallback for the GL path: takes the same vertex/index buffers and matrices, renders flat colored
+// triangles (what the ourColor fragment shader does) with a depth test into an RGBA8 image.
+//
+// drawElements() only records the draw. flush() transforms, clips and bins the triangles into 64x64 screen
+// tiles in parallel batches, then rasterizes the tiles in parallel, both on the job system. triangles keep
+// their submission order inside a tile.
+//
+// positions are snapped to 1/16 pixel and the edge functions are exact integers with GL's top-left fill rule,
+// so triangles sharing an edge or a vertex draw each pixel of it once. images are at most MAX_SIZE pixels
+// wide and high (the constructor throws std::length_error beyond), which keeps a tile's edge values in 32 bits.
+class SoftRasterizer
+{
+public:
+    struct Stats
+    {
+        unsigned int triangles = 0;     // triangles that survived clipping and setup
+        unsigned int binnedTiles = 0;   // sum over triangles of the number of tiles they touch
+    };
+
+    static const int MAX_SIZE = 4096;
+
+    SoftRasterizer(int width, int height, JobSystem &jobs);
+
+    // start a new frame; color and depth are reset tile by tile by the next flush()
+    void clear(const glm::vec4 &color);
+
+    // same meaning as glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_INT, first * sizeof(unsigned int))
+    // with gl_Position = mvp * vec4(aPos, 1.0) and FragColor = color. vertices and indices are read by the
+    // next flush(), they have to stay valid until then
+    void drawElements(const float *vertices, const unsigned int *indices, unsigned int count, unsigned int first,
+                      const glm::mat4 &mvp, const glm::vec4 &color);
+
+    // bin, rasterize and retire everything submitted since the last flush()
+    void flush();
+
+    int width() const { return imageWidth; }
+    int height() const { return imageHeight; }
+    const Stats &stats() const { return frameStats; }
+
+    // pixel (x, y) with y = 0 at the top, packed as 0xAABBGGRR
+    std::uint32_t pixel(int x, int y) const { return color[y * stride + x]; }
+    bool writePpm(const char *path) const;
+
+private:
+    static const int TILE_SIZE = 64;
+    static const int SUBPIXEL = 16;                     // window positions are snapped to 1 / SUBPIXEL pixel
+    static const int GUARD_BAND = 1024;                 // pixels past each image edge that triangles are clipped at
+    static const std::size_t BATCH_TRIANGLES = 4096;   // submitted triangles binned by one flush() task
+
+    struct Draw
+    {
+        const float *vertices;
+        const unsigned int *indices;
+        unsigned int first;
+        std::size_t firstTriangle;      // triangles recorded by the draws before this one
+        glm::mat4 mvp;
+        std::uint32_t color;
+    };
+
+    struct Triangle
+    {
+        // e_i(x, y) = edgeA[i] * x + edgeB[i] * y + edgeC[i] at the centre of pixel (x, y), in 1 / SUBPIXEL^2
+        // pixels and with the fill rule bias in edgeC; the centre is inside when every e_i >= 0
+        int edgeA[3], edgeB[3];
+        std::int64_t edgeC[3];
+        float depthA, depthB, depthC;         // window depth plane
+        int minX, minY, maxX, maxY;
+        std::uint32_t color;
+    };
+
+    // the triangles of one run of BATCH_TRIANGLES submitted ones and the tiles they touch. a tile draws the
+    // batches in order, so binning them in parallel keeps the submission order
+    struct Batch
+    {
+        std::vector<Triangle> triangles;
+        std::vector<unsigned int> binStart;     // the triangles of tile t are binned[binStart[t]] up to binned[binStart[t + 1]]
+        std::vector<unsigned int> binned;
+        std::vector<unsigned int> cursor;       // next free slot of each tile while binning
+        Stats stats;
+    };
+
+    void binBatch(std::size_t batch);
+    void setupTriangle(Batch &batch, const glm::vec4 &c0, const glm::vec4 &c1, const glm::vec4 &c2, std::uint32_t packedColor);
+    void rasterizeTile(unsigned int tile);
+
+    JobSystem &jobs;
+    int imageWidth, imageHeight;
+    int stride, paddedHeight;
+    int tilesX, tilesY;
+    std::vector<std::uint32_t> color;
+    std::vector<float> depth;
+    glm::vec4 clipPlanes[5];            // near and guard band, dot(plane, position) >= 0 inside
+    std::uint32_t clearColor = 0;
+    bool pendingClear = true;
+
+    std::vector<Draw> draws;
+    std::size_t recordedTriangles = 0;
+    std::vector<Batch> batches;
+    std::size_t batchCount = 0;         // batches in use by the current flush()
+    Stats frameStats;
+};
+
+#endif
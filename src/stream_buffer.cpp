@@ -0,0 +1,89 @@
+#include "stream_buffer.h"
+
+#include <cstring>
+
+StreamBuffer::StreamBuffer(GLsizeiptr size)
+    : capacity(size)
+{
+    glGenBuffers(1, &name);
+    glBindBuffer(GL_COPY_READ_BUFFER, name);
+    glBufferData(GL_COPY_READ_BUFFER, capacity, nullptr, GL_STREAM_DRAW);
+}
+
+StreamBuffer::~StreamBuffer()
+{
+    for (const Fence &fence : fences)
+        glDeleteSync(fence.sync);
+    glDeleteBuffers(1, &name);
+}
+
+GLintptr StreamBuffer::upload(const void *data, GLsizeiptr size)
+{
+    GLintptr offset;
+    std::memcpy(map(size, offset), data, size);
+    unmap();
+    return offset;
+}
+
+void *StreamBuffer::map(GLsizeiptr size, GLintptr &offset)
+{
+    if (size > capacity)
+        grow(size);
+    if (head + size > capacity)
+    {
+        // wrap; what was written at the end so far gets its own fence
+        fence();
+        head = 0;
+        unfencedBegin = 0;
+    }
+    waitFor(head, head + size);
+
+    glBindBuffer(GL_COPY_READ_BUFFER, name);
+    void *target = glMapBufferRange(GL_COPY_READ_BUFFER, head, size,
+                                    GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+    offset = head;
+    head += size;
+    return target;
+}
+
+void StreamBuffer::unmap()
+{
+    glBindBuffer(GL_COPY_READ_BUFFER, name);
+    glUnmapBuffer(GL_COPY_READ_BUFFER);
+}
+
+void StreamBuffer::fence()
+{
+    if (head == unfencedBegin)
+        return;
+    Fence fence;
+    fence.sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    fence.begin = unfencedBegin;
+    fence.end = head;
+    fences.push_back(fence);
+    unfencedBegin = head;
+}
+
+void StreamBuffer::waitFor(GLintptr begin, GLintptr end)
+{
+    // the ring is written in order, so the ranges in our way are always the oldest ones
+    while (!fences.empty() && fences.front().begin < end && begin < fences.front().end)
+    {
+        glClientWaitSync(fences.front().sync, GL_SYNC_FLUSH_COMMANDS_BIT, ~GLuint64(0));
+        glDeleteSync(fences.front().sync);
+        fences.pop_front();
+    }
+}
+
+void StreamBuffer::grow(GLsizeiptr size)
+{
+    // a single upload bigger than the ring: wait for everything in flight and start over with a bigger buffer
+    fence();
+    waitFor(0, capacity);
+    while (capacity < size)
+        capacity *= 2;
+    glBindBuffer(GL_COPY_READ_BUFFER, name);
+    glBufferData(GL_COPY_READ_BUFFER, capacity, nullptr, GL_STREAM_DRAW);
+    head = 0;
+    unfencedBegin = 0;
+}
@@ -0,0 +1,55 @@
+#ifndef STREAM_BUFFER_H
+#define STREAM_BUFFER_H
+
+#include <glad/glad.h>
+
+#include <deque>
+
+// ring buffer for CPU -> GPU uploads. upload() writes into the next free range with an unsynchronized map,
+// fence() closes the ranges written so far; a range is only reused after the GPU has passed its fence, so
+// writes never stall on draws that are still reading older data.
+//
+// the data is meant to be copied out on the GPU (glCopyBufferSubData from GL_COPY_READ_BUFFER) into the
+// buffer that keeps it
+class StreamBuffer
+{
+public:
+    // needs a current GL context
+    explicit StreamBuffer(GLsizeiptr size);
+    ~StreamBuffer();
+
+    StreamBuffer(const StreamBuffer &) = delete;
+    StreamBuffer &operator=(const StreamBuffer &) = delete;
+
+    GLuint buffer() const { return name; }
+
+    // copies the bytes into the ring and returns their offset in buffer(), which is left bound to GL_COPY_READ_BUFFER
+    GLintptr upload(const void *data, GLsizeiptr size);
+
+    // reserves size bytes like upload() and returns them mapped, for data that is produced straight into the ring
+    // (by several threads if need be); offset receives their offset in buffer(). call unmap() once they are written
+    // and before any other GL call on the buffer; like upload() it leaves buffer() bound to GL_COPY_READ_BUFFER
+    void *map(GLsizeiptr size, GLintptr &offset);
+    void unmap();
+
+    // call once the commands reading this frame's uploads have been issued
+    void fence();
+
+private:
+    struct Fence
+    {
+        GLsync sync;
+        GLintptr begin, end;
+    };
+
+    void waitFor(GLintptr begin, GLintptr end);
+    void grow(GLsizeiptr size);
+
+    GLuint name = 0;
+    GLsizeiptr capacity;
+    GLintptr head = 0;
+    GLintptr unfencedBegin = 0;
+    std::deque<Fence> fences;   // oldest first, in ring order
+};
+
+#endif
@@ -0,0 +1,70 @@
+#include "terrain.h"
+
+#include <algorithm>
+#include <vector>
+
+void fillHeightmap(JobSystem &jobs, const glm::noise_fractal &noise, const glm::vec2 &origin, float spacing,
+                   int width, int depth, float *heights)
+{
+    jobs.parallelFor(depth, 4, [&](std::size_t begin, std::size_t end)
+    {
+        for (std::size_t z = begin; z < end; z++)
+            glm::fractalNoiseRow(noise, origin + glm::vec2(0.0f, z * spacing), glm::vec2(spacing, 0.0f), width, heights + z * width);
+    });
+}
+
+void fillDensity(JobSystem &jobs, const glm::noise_fractal &noise, const glm::vec3 &origin, float spacing,
+                 const glm::ivec3 &size, float *density)
+{
+    // one task item per row, so thin volumes still spread over every worker
+    jobs.parallelFor(std::size_t(size.y) * size.z, 16, [&](std::size_t begin, std::size_t end)
+    {
+        for (std::size_t row = begin; row < end; row++)
+        {
+            glm::vec3 start = origin + glm::vec3(0.0f, (row % size.y) * spacing, (row / size.y) * spacing);
+            glm::fractalNoiseRow(noise, start, glm::vec3(spacing, 0.0f, 0.0f), size.x, density + row * size.x);
+        }
+    });
+}
+
+void buildVoxelTerrain(VoxelWorld &world, JobSystem &jobs, int chunks_x, int chunks_z)
+{
+    const int width = chunks_x * VOXEL_CHUNK_SIZE;
+    const int depth = chunks_z * VOXEL_CHUNK_SIZE;
+    const int max_height = 48;
+
+    // tiles every 8 chunks, so the hills continue seamlessly across worlds of that size
+    glm::noise_fractal hills(5, 1.0f / 64.0f);
+    hills.period = 8.0f * VOXEL_CHUNK_SIZE;
+    std::vector<float> heights(std::size_t(width) * depth);
+    fillHeightmap(jobs, hills, glm::vec2(0.0f), 1.0f, width, depth, heights.data());
+
+    glm::noise_fractal caves(3, 1.0f / 24.0f);
+    caves.ridged = true;
+    glm::ivec3 size(width, max_height, depth);
+    std::vector<float> density(std::size_t(size.x) * size.y * size.z);
+    fillDensity(jobs, caves, glm::vec3(0.0f), 1.0f, size, density.data());
+
+    for (int z = 0; z < depth; z++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            int height = std::min((int)(24.0f + 20.0f * heights[std::size_t(z) * width + x]), max_height - 1);
+            for (int y = 0; y <= height; y++)
+            {
+                bool cave = y > 0 && y < height - 3 && density[(std::size_t(z) * size.y + y) * size.x + x] > 0.55f;
+                if (!cave)
+                    world.set(glm::ivec3(x, y, z), y == height ? VOXEL_GRASS : y > height - 4 ? VOXEL_DIRT : VOXEL_STONE);
+            }
+        }
+    }
+}
+
+void carveVoxelSphere(VoxelWorld &world, const glm::ivec3 &center, int radius)
+{
+    for (int z = -radius; z <= radius; z++)
+        for (int y = -radius; y <= radius; y++)
+            for (int x = -radius; x <= radius; x++)
+                if (x * x + y * y + z * z <= radius * radius)
+                    world.set(center + glm::ivec3(x, y, z), 0);
+}
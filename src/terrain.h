@@ -0,0 +1,38 @@
+#ifndef TERRAIN_H
+#define TERRAIN_H
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#define GLM_ENABLE_EXPERIMENTAL
+#endif
+#include <glm/glm.hpp>
+#include <glm/gtx/noise_batch.hpp>
+
+#include <cstdint>
+
+#include "job_system.h"
+#include "voxel_world.h"
+
+// procedural fields sampled on a regular grid with the batched glm noise; every row is one fractalNoiseRow
+// call and the rows are spread over the job system.
+
+// width * depth samples of fractal noise at origin + (x, z) * spacing, stored heights[z * width + x]
+void fillHeightmap(JobSystem &jobs, const glm::noise_fractal &noise, const glm::vec2 &origin, float spacing,
+                   int width, int depth, float *heights);
+
+// size.x * size.y * size.z samples of fractal noise at origin + (x, y, z) * spacing,
+// stored density[(z * size.y + y) * size.x + x]
+void fillDensity(JobSystem &jobs, const glm::noise_fractal &noise, const glm::vec3 &origin, float spacing,
+                 const glm::ivec3 &size, float *density);
+
+// voxel terrain: fractal noise hills of grass over dirt over stone with ridged noise caves underneath,
+// chunks_x by chunks_z chunks wide
+const std::uint32_t VOXEL_GRASS = 0xff33b24c;
+const std::uint32_t VOXEL_DIRT = 0xff264c73;
+const std::uint32_t VOXEL_STONE = 0xff808080;
+
+void buildVoxelTerrain(VoxelWorld &world, JobSystem &jobs, int chunks_x, int chunks_z);
+
+// empties every voxel within radius of center
+void carveVoxelSphere(VoxelWorld &world, const glm::ivec3 &center, int radius);
+
+#endif
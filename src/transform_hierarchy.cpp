@@ -0,0 +1,181 @@
+#include "transform_hierarchy.h"
+
+#include <algorithm>
+#include <atomic>
+#include <type_traits>
+
+TransformHierarchy::Node TransformHierarchy::add(Node parent, const glm::vec3 &position, const glm::quat &rotation, const glm::vec3 &scale)
+{
+    std::uint32_t parentSlot = parent == NO_PARENT ? NO_PARENT : slots[parent];
+    std::uint32_t depth = parent == NO_PARENT ? 0 : depths[parentSlot] + 1;
+    structureChanged = true;
+
+    Node node = static_cast<Node>(slots.size());
+    slots.push_back(static_cast<std::uint32_t>(parents.size()));
+    handles.push_back(node);
+    positions.push_back(position);
+    rotations.push_back(rotation);
+    scales.push_back(scale);
+    parents.push_back(parentSlot);
+    depths.push_back(depth);
+    dirty.push_back(1);
+    worlds.push_back(glm::mat4(1.0f));
+    dirtyCount++;
+    return node;
+}
+
+void TransformHierarchy::reserve(std::size_t count)
+{
+    positions.reserve(count);
+    rotations.reserve(count);
+    scales.reserve(count);
+    parents.reserve(count);
+    depths.reserve(count);
+    dirty.reserve(count);
+    worlds.reserve(count);
+    handles.reserve(count);
+    slots.reserve(count);
+}
+
+void TransformHierarchy::setPosition(Node node, const glm::vec3 &position)
+{
+    positions[slots[node]] = position;
+    markDirty(slots[node]);
+}
+
+void TransformHierarchy::setRotation(Node node, const glm::quat &rotation)
+{
+    rotations[slots[node]] = rotation;
+    markDirty(slots[node]);
+}
+
+void TransformHierarchy::setScale(Node node, const glm::vec3 &scale)
+{
+    scales[slots[node]] = scale;
+    markDirty(slots[node]);
+}
+
+void TransformHierarchy::markDirty(std::uint32_t slot)
+{
+    if (!dirty[slot])
+    {
+        dirty[slot] = 1;
+        dirtyCount++;
+    }
+}
+
+void TransformHierarchy::sortByDepth()
+{
+    // breadth-first order: depth order as update() needs it, and the children of one parent end up next to
+    // each other in the same order as their parents, so every level reads the previous one front to back
+    std::vector<std::uint32_t> childStarts(size() + 1, 0);
+    for (std::uint32_t parent : parents)
+        if (parent != NO_PARENT)
+            childStarts[parent + 1]++;
+    for (std::size_t i = 1; i < childStarts.size(); i++)
+        childStarts[i] += childStarts[i - 1];
+    std::vector<std::uint32_t> children(childStarts.back());
+    std::vector<std::uint32_t> fill(childStarts.begin(), childStarts.end() - 1);
+    for (std::size_t slot = 0; slot < size(); slot++)
+        if (parents[slot] != NO_PARENT)
+            children[fill[parents[slot]]++] = static_cast<std::uint32_t>(slot);
+
+    std::vector<std::uint32_t> order;
+    order.reserve(size());
+    for (std::size_t slot = 0; slot < size(); slot++)
+        if (parents[slot] == NO_PARENT)
+            order.push_back(static_cast<std::uint32_t>(slot));
+    for (std::size_t i = 0; i < order.size(); i++)
+        order.insert(order.end(), children.begin() + childStarts[order[i]], children.begin() + childStarts[order[i] + 1]);
+
+    std::vector<std::uint32_t> newSlot(size());
+    for (std::size_t i = 0; i < order.size(); i++)
+        newSlot[order[i]] = static_cast<std::uint32_t>(i);
+
+    auto permute = [&](auto &values)
+    {
+        typename std::decay<decltype(values)>::type sorted(values.size());
+        for (std::size_t slot = 0; slot < values.size(); slot++)
+            sorted[newSlot[slot]] = values[slot];
+        values.swap(sorted);
+    };
+    permute(positions);
+    permute(rotations);
+    permute(scales);
+    permute(parents);
+    permute(depths);
+    permute(dirty);
+    permute(worlds);
+    permute(handles);
+
+    for (std::uint32_t &parent : parents)
+        if (parent != NO_PARENT)
+            parent = newSlot[parent];
+    for (std::size_t slot = 0; slot < size(); slot++)
+        slots[handles[slot]] = static_cast<std::uint32_t>(slot);
+}
+
+void TransformHierarchy::buildLevels()
+{
+    levelStarts.clear();
+    for (std::size_t slot = 0; slot < size(); slot++)
+        if (slot == 0 || depths[slot] != depths[slot - 1])
+            levelStarts.push_back(slot);
+    levelStarts.push_back(size());
+}
+
+std::size_t TransformHierarchy::updateRange(std::size_t begin, std::size_t end)
+{
+    std::size_t count = 0;
+    for (std::size_t slot = begin; slot < end; slot++)
+    {
+        // the parent is on an earlier level, its flag is final by now
+        std::uint32_t parent = parents[slot];
+        if (parent != NO_PARENT && dirty[parent])
+            dirty[slot] = 1;
+        if (!dirty[slot])
+            continue;
+
+        glm::mat4 local = glm::mat4_cast(rotations[slot]);
+        local[0] *= scales[slot].x;
+        local[1] *= scales[slot].y;
+        local[2] *= scales[slot].z;
+        local[3] = glm::vec4(positions[slot], 1.0f);
+        worlds[slot] = parent == NO_PARENT ? local : worlds[parent] * local;
+        count++;
+    }
+    return count;
+}
+
+void TransformHierarchy::update(JobSystem *jobs)
+{
+    updated = 0;
+    if (dirtyCount == 0)
+        return;
+    if (structureChanged)
+    {
+        sortByDepth();
+        buildLevels();
+        structureChanged = false;
+    }
+
+    for (std::size_t level = 0; level + 1 < levelStarts.size(); level++)
+    {
+        std::size_t first = levelStarts[level];
+        std::size_t last = levelStarts[level + 1];
+        if (!jobs)
+        {
+            updated += updateRange(first, last);
+            continue;
+        }
+        std::atomic<std::size_t> count{0};
+        jobs->parallelFor(last - first, 16 * 1024, [&](std::size_t begin, std::size_t end)
+        {
+            count += updateRange(first + begin, first + end);
+        });
+        updated += count;
+    }
+
+    std::fill(dirty.begin(), dirty.end(), 0);
+    dirtyCount = 0;
+}
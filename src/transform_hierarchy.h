@@ -0,0 +1,73 @@
+#ifndef TRANSFORM_HIERARCHY_H
+#define TRANSFORM_HIERARCHY_H
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "job_system.h"
+
+// scene graph transforms: every node has a local translation/rotation/scale and an optional parent,
+// update() turns them into world matrices.
+//
+// the data is structure of arrays in breadth-first order, so every parent sits before its children and one
+// level never depends on another node of the same level. adding nodes re-sorts on the next update(). update() walks the levels front to back in one linear
+// pass per level, splitting each level across the job system, and only recomputes nodes whose local
+// transform changed or whose parent was recomputed.
+class TransformHierarchy
+{
+public:
+    // stable handle; nodes move around internally when the hierarchy is re-sorted
+    typedef std::uint32_t Node;
+    static const Node NO_PARENT = ~0u;
+
+    Node add(Node parent, const glm::vec3 &position = glm::vec3(0.0f),
+             const glm::quat &rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f), const glm::vec3 &scale = glm::vec3(1.0f));
+    void reserve(std::size_t count);
+    std::size_t size() const { return parents.size(); }
+
+    void setPosition(Node node, const glm::vec3 &position);
+    void setRotation(Node node, const glm::quat &rotation);
+    void setScale(Node node, const glm::vec3 &scale);
+
+    const glm::vec3 &position(Node node) const { return positions[slots[node]]; }
+    const glm::quat &rotation(Node node) const { return rotations[slots[node]]; }
+    const glm::vec3 &scale(Node node) const { return scales[slots[node]]; }
+
+    // as of the last update()
+    const glm::mat4 &world(Node node) const { return worlds[slots[node]]; }
+
+    // recompute the world matrix of every changed node and everything below it; without a job system
+    // the levels run on the calling thread
+    void update(JobSystem *jobs = nullptr);
+
+    // nodes recomputed by the last update()
+    std::size_t updatedCount() const { return updated; }
+
+private:
+    void markDirty(std::uint32_t slot);
+    void sortByDepth();
+    void buildLevels();
+    std::size_t updateRange(std::size_t begin, std::size_t end);
+
+    // indexed by slot, in depth order
+    std::vector<glm::vec3> positions;
+    std::vector<glm::quat> rotations;
+    std::vector<glm::vec3> scales;
+    std::vector<std::uint32_t> parents;     // slot of the parent, NO_PARENT for roots
+    std::vector<std::uint32_t> depths;
+    std::vector<std::uint8_t> dirty;        // local changed, or set during update() when the parent was recomputed
+    std::vector<glm::mat4> worlds;
+    std::vector<Node> handles;              // slot -> node
+
+    std::vector<std::uint32_t> slots;       // node -> slot
+    std::vector<std::size_t> levelStarts;   // first slot of every depth, plus size() at the end
+    std::size_t dirtyCount = 0;             // setter calls since the last update, 0 means nothing to do
+    std::size_t updated = 0;
+    bool structureChanged = false;          // nodes were added, re-sort before the next update
+};
+
+#endif
@@ -0,0 +1,149 @@
+#include "voxel_mesher.h"
+
+#include <cstddef>
+
+namespace
+{
+    const int N = VOXEL_CHUNK_SIZE;
+
+    // light factor of each face direction (+x, -x, +y, -y, +z, -z), kept in the vertex color's alpha
+    const std::uint32_t FACE_LIGHT[6] = {204, 178, 255, 127, 229, 153};
+
+    std::uint32_t shade(std::uint32_t color, int face)
+    {
+        return (color & 0x00ffffffu) | FACE_LIGHT[face] << 24;
+    }
+
+    // voxel (a, b) of slice i, with the slice perpendicular to axis and a, b running along the next two axes
+    std::uint32_t voxelAt(const ChunkSnapshot &chunk, int axis, int i, int a, int b)
+    {
+        int p[3];
+        p[axis] = i;
+        p[(axis + 1) % 3] = a;
+        p[(axis + 2) % 3] = b;
+        return chunk.at(p[0], p[1], p[2]);
+    }
+
+    // distance between neighbors along an axis in ChunkSnapshot::colors
+    std::ptrdiff_t stride(int axis)
+    {
+        return axis == 0 ? 1 : axis == 1 ? ChunkSnapshot::SIZE : ChunkSnapshot::SIZE * ChunkSnapshot::SIZE;
+    }
+
+    // index of voxel (0, 0) of slice i
+    std::ptrdiff_t sliceOrigin(int axis, int i)
+    {
+        int p[3] = {0, 0, 0};
+        p[axis] = i;
+        return ((p[2] + 1) * ChunkSnapshot::SIZE + p[1] + 1) * ChunkSnapshot::SIZE + p[0] + 1;
+    }
+
+    // the face of slice i towards +axis (positive) or -axis covering [a, a + width) x [b, b + height).
+    // u = axis + 1 and v = axis + 2 satisfy u x v = axis, so corners in u, v order wind counter-clockwise seen from +axis
+    void emitQuad(std::vector<VoxelVertex> &out, int axis, bool positive, int i, int a, int b, int width, int height, std::uint32_t color)
+    {
+        int u = (axis + 1) % 3;
+        int v = (axis + 2) % 3;
+        float corners[4][3];
+        for (int c = 0; c < 4; c++)
+        {
+            corners[c][axis] = (float)(i + (positive ? 1 : 0));
+            corners[c][u] = (float)(a + (c == 1 || c == 2 ? width : 0));
+            corners[c][v] = (float)(b + (c >= 2 ? height : 0));
+        }
+        static const int POSITIVE[6] = {0, 1, 2, 0, 2, 3};
+        static const int NEGATIVE[6] = {0, 2, 1, 0, 3, 2};
+        const int *order = positive ? POSITIVE : NEGATIVE;
+        for (int k = 0; k < 6; k++)
+        {
+            const float *corner = corners[order[k]];
+            out.push_back({corner[0], corner[1], corner[2], color});
+        }
+    }
+}
+
+void greedyMesh(const ChunkSnapshot &chunk, std::vector<VoxelVertex> &out)
+{
+    std::uint32_t mask[N * N];
+    for (int axis = 0; axis < 3; axis++)
+    {
+        for (int side = 0; side < 2; side++)
+        {
+            bool positive = side == 0;
+            int step = positive ? 1 : -1;
+            int face = axis * 2 + side;
+            for (int i = 0; i < N; i++)
+            {
+                // exposed faces of this slice, by color; walked with strides instead of voxelAt()
+                const std::uint32_t *slice = &chunk.colors[sliceOrigin(axis, i)];
+                std::ptrdiff_t across = stride(axis) * step;
+                std::ptrdiff_t strideA = stride((axis + 1) % 3);
+                std::ptrdiff_t strideB = stride((axis + 2) % 3);
+                for (int b = 0; b < N; b++)
+                {
+                    const std::uint32_t *voxel = slice + b * strideB;
+                    for (int a = 0; a < N; a++, voxel += strideA)
+                        mask[b * N + a] = *voxel != 0 && voxel[across] == 0 ? *voxel : 0;
+                }
+
+                // grow each unclaimed face along a, then along b while the whole run matches
+                for (int b = 0; b < N; b++)
+                {
+                    for (int a = 0; a < N;)
+                    {
+                        std::uint32_t color = mask[b * N + a];
+                        if (color == 0)
+                        {
+                            a++;
+                            continue;
+                        }
+                        int width = 1;
+                        while (a + width < N && mask[b * N + a + width] == color)
+                            width++;
+                        int height = 1;
+                        for (; b + height < N; height++)
+                        {
+                            const std::uint32_t *row = &mask[(b + height) * N + a];
+                            int k = 0;
+                            while (k < width && row[k] == color)
+                                k++;
+                            if (k < width)
+                                break;
+                        }
+                        emitQuad(out, axis, positive, i, a, b, width, height, shade(color, face));
+                        for (int y = 0; y < height; y++)
+                            for (int x = 0; x < width; x++)
+                                mask[(b + y) * N + a + x] = 0;
+                        a += width;
+                    }
+                }
+            }
+        }
+    }
+}
+
+void naiveMesh(const ChunkSnapshot &chunk, bool cullHidden, std::vector<VoxelVertex> &out)
+{
+    for (int axis = 0; axis < 3; axis++)
+    {
+        for (int side = 0; side < 2; side++)
+        {
+            bool positive = side == 0;
+            int step = positive ? 1 : -1;
+            int face = axis * 2 + side;
+            for (int i = 0; i < N; i++)
+            {
+                for (int b = 0; b < N; b++)
+                {
+                    for (int a = 0; a < N; a++)
+                    {
+                        std::uint32_t color = voxelAt(chunk, axis, i, a, b);
+                        if (color == 0 || (cullHidden && voxelAt(chunk, axis, i + step, a, b) != 0))
+                            continue;
+                        emitQuad(out, axis, positive, i, a, b, 1, 1, shade(color, face));
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,25 @@
+#ifndef VOXEL_MESHER_H
+#define VOXEL_MESHER_H
+
+#include <cstdint>
+#include <vector>
+
+#include "voxel_world.h"
+
+// 16 bytes: chunk local position in voxel units and the face color with its light factor in alpha
+struct VoxelVertex
+{
+    float x, y, z;
+    std::uint32_t color;
+};
+
+// greedy meshing: every exposed face becomes part of a slice mask, and runs of same colored faces in a slice
+// are merged into the largest rectangles that fit, two triangles each. appends GL_TRIANGLES vertices,
+// counter-clockwise seen from outside, with coordinates relative to the chunk origin.
+void greedyMesh(const ChunkSnapshot &chunk, std::vector<VoxelVertex> &out);
+
+// baseline for comparison: two triangles for every face of every solid voxel, or only for the faces that
+// border air when cullHidden is set
+void naiveMesh(const ChunkSnapshot &chunk, bool cullHidden, std::vector<VoxelVertex> &out);
+
+#endif
@@ -0,0 +1,147 @@
+#include "voxel_renderer.h"
+
+#include <algorithm>
+#include <chrono>
+
+VoxelRenderer::VoxelRenderer(VoxelWorld &world, JobSystem &jobs)
+    : world(world), jobs(jobs), stream(4 * 1024 * 1024)
+{
+}
+
+VoxelRenderer::~VoxelRenderer()
+{
+    for (std::unique_ptr<MeshJob> &job : running)
+        jobs.wait(job->task);
+    for (auto &entry : gpuChunks)
+    {
+        glDeleteVertexArrays(1, &entry.second.vao);
+        glDeleteBuffers(1, &entry.second.vbo);
+    }
+}
+
+void VoxelRenderer::update()
+{
+    // with a single thread nobody else runs the meshing tasks
+    jobs.tryRunOne();
+
+    bool uploaded = false;
+    for (std::size_t i = 0; i < running.size();)
+    {
+        MeshJob &job = *running[i];
+        if (!job.task.finished.load(std::memory_order_acquire))
+        {
+            i++;
+            continue;
+        }
+        upload(job);
+        uploaded = true;
+        frameStats.meshed++;
+        frameStats.meshMilliseconds += job.milliseconds;
+        idle.push_back(std::move(running[i]));
+        running[i] = std::move(running.back());
+        running.pop_back();
+    }
+    stream.fence();
+
+    // a chunk that is still being meshed waits for that job, so the meshes of one chunk land in order
+    world.takeDirty(dirty);
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < dirty.size(); i++)
+    {
+        const ChunkCoord &coord = dirty[i];
+        bool busy = std::any_of(running.begin(), running.end(),
+                                [&](const std::unique_ptr<MeshJob> &job) { return job->snapshot.coord == coord; });
+        if (!busy)
+            submit(coord);
+        else if (std::find(dirty.begin(), dirty.begin() + kept, coord) == dirty.begin() + kept)
+            dirty[kept++] = coord;
+    }
+    dirty.resize(kept);
+
+    if (uploaded)
+    {
+        frameStats.chunks = 0;
+        frameStats.triangles = 0;
+        for (const auto &entry : gpuChunks)
+        {
+            frameStats.chunks += entry.second.vertexCount > 0;
+            frameStats.triangles += entry.second.vertexCount / 3;
+        }
+    }
+    frameStats.inFlight = running.size();
+}
+
+void VoxelRenderer::submit(const ChunkCoord &coord)
+{
+    std::unique_ptr<MeshJob> job;
+    if (!idle.empty())
+    {
+        job = std::move(idle.back());
+        idle.pop_back();
+    }
+    else
+    {
+        job.reset(new MeshJob());
+    }
+
+    // the snapshot is taken here so the world can keep changing while the job runs
+    world.snapshot(coord, job->snapshot);
+    job->vertices.clear();
+    job->task.pendingDependencies = 1;
+    job->task.finished = false;
+    MeshJob *meshJob = job.get();
+    job->task.work = [meshJob]()
+    {
+        auto start = std::chrono::steady_clock::now();
+        greedyMesh(meshJob->snapshot, meshJob->vertices);
+        meshJob->milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+    running.push_back(std::move(job));
+    jobs.submit(meshJob->task);
+}
+
+void VoxelRenderer::upload(const MeshJob &job)
+{
+    GpuChunk &gpu = gpuChunks[job.snapshot.coord];
+    gpu.vertexCount = static_cast<GLsizei>(job.vertices.size());
+    if (job.vertices.empty())
+        return;
+
+    if (!gpu.vao)
+    {
+        glGenVertexArrays(1, &gpu.vao);
+        glGenBuffers(1, &gpu.vbo);
+        glBindVertexArray(gpu.vao);
+        glBindBuffer(GL_ARRAY_BUFFER, gpu.vbo);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(VoxelVertex), (void *)0);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(VoxelVertex), (void *)(3 * sizeof(float)));
+        glEnableVertexAttribArray(1);
+        glBindVertexArray(0);
+    }
+
+    GLsizeiptr size = static_cast<GLsizeiptr>(job.vertices.size() * sizeof(VoxelVertex));
+    GLintptr offset = stream.upload(job.vertices.data(), size);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, gpu.vbo);
+    if (gpu.capacity < size)
+    {
+        // grow with headroom so small edits do not reallocate every time
+        gpu.capacity = std::max(size, gpu.capacity * 2);
+        glBufferData(GL_COPY_WRITE_BUFFER, gpu.capacity, nullptr, GL_STATIC_DRAW);
+    }
+    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, offset, 0, size);
+}
+
+void VoxelRenderer::draw(GLint originLocation) const
+{
+    for (const auto &entry : gpuChunks)
+    {
+        const GpuChunk &gpu = entry.second;
+        if (gpu.vertexCount == 0)
+            continue;
+        const ChunkCoord &coord = entry.first;
+        glUniform3f(originLocation, (float)(coord.x * VOXEL_CHUNK_SIZE), (float)(coord.y * VOXEL_CHUNK_SIZE), (float)(coord.z * VOXEL_CHUNK_SIZE));
+        glBindVertexArray(gpu.vao);
+        glDrawArrays(GL_TRIANGLES, 0, gpu.vertexCount);
+    }
+}
@@ -0,0 +1,77 @@
+#ifndef VOXEL_RENDERER_H
+#define VOXEL_RENDERER_H
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "job_system.h"
+#include "stream_buffer.h"
+#include "voxel_mesher.h"
+#include "voxel_world.h"
+
+// keeps one VBO/VAO per voxel chunk in sync with a VoxelWorld. chunks the world reports as changed are
+// snapshotted on the render thread and greedy meshed on the job system in the background; finished meshes
+// go through a StreamBuffer into the chunk's VBO on a later update(). untouched chunks are never rebuilt.
+class VoxelRenderer
+{
+public:
+    struct Stats
+    {
+        std::size_t chunks = 0;          // chunks with a non-empty mesh on the GPU
+        std::size_t triangles = 0;       // total over those chunks
+        std::size_t meshed = 0;          // chunk meshes finished since construction
+        double meshMilliseconds = 0.0;   // summed meshing time of those, divide by meshed for ms per chunk
+        std::size_t inFlight = 0;
+    };
+
+    // needs a current GL context; attribute 0 is the chunk local position, attribute 1 the normalized color
+    VoxelRenderer(VoxelWorld &world, JobSystem &jobs);
+    ~VoxelRenderer();
+
+    VoxelRenderer(const VoxelRenderer &) = delete;
+    VoxelRenderer &operator=(const VoxelRenderer &) = delete;
+
+    // start meshing the chunks changed since the last call and upload the meshes that have finished
+    void update();
+
+    // one draw per chunk; the program is bound by the caller, originLocation receives the chunk origin in voxels
+    void draw(GLint originLocation) const;
+
+    const Stats &stats() const { return frameStats; }
+
+private:
+    struct MeshJob
+    {
+        ChunkSnapshot snapshot;
+        std::vector<VoxelVertex> vertices;
+        double milliseconds = 0.0;
+        JobSystem::Task task;
+    };
+
+    struct GpuChunk
+    {
+        GLuint vao = 0;
+        GLuint vbo = 0;
+        GLsizeiptr capacity = 0;
+        GLsizei vertexCount = 0;
+    };
+
+    void submit(const ChunkCoord &coord);
+    void upload(const MeshJob &job);
+
+    VoxelWorld &world;
+    JobSystem &jobs;
+    StreamBuffer stream;
+    std::unordered_map<ChunkCoord, GpuChunk, ChunkCoordHash> gpuChunks;
+    std::vector<std::unique_ptr<MeshJob>> running;
+    std::vector<std::unique_ptr<MeshJob>> idle;   // finished jobs kept for their buffers
+    std::vector<ChunkCoord> dirty;                // changed, waiting for a snapshot
+    Stats frameStats;
+};
+
+#endif
@@ -0,0 +1,170 @@
+#include "voxel_world.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+    int floorDiv(int value, int divisor)
+    {
+        return value >= 0 ? value / divisor : -((-value + divisor - 1) / divisor);
+    }
+}
+
+VoxelChunk::VoxelChunk()
+    : palette(1, 0)
+{
+    std::memset(voxels, 0, sizeof(voxels));
+}
+
+bool VoxelChunk::set(int x, int y, int z, std::uint32_t color)
+{
+    // looked up first: compacting the palette renumbers the voxels
+    std::uint8_t entry;
+    if (!paletteIndex(color, entry))
+        return false;
+    std::uint8_t &voxel = voxels[index(x, y, z)];
+    bool wasSolid = voxel != 0;
+    voxel = entry;
+    solid += (voxel != 0) - wasSolid;
+    return true;
+}
+
+bool VoxelChunk::paletteIndex(std::uint32_t color, std::uint8_t &entry)
+{
+    for (std::size_t i = 0; i < palette.size(); i++)
+        if (palette[i] == color)
+        {
+            entry = static_cast<std::uint8_t>(i);
+            return true;
+        }
+    if (palette.size() == 256)
+        compactPalette();
+    if (palette.size() == 256)
+        return false;
+    palette.push_back(color);
+    entry = static_cast<std::uint8_t>(palette.size() - 1);
+    return true;
+}
+
+void VoxelChunk::compactPalette()
+{
+    // drop colors no voxel uses any more and renumber the rest
+    bool used[256] = {};
+    for (std::uint8_t voxel : voxels)
+        used[voxel] = true;
+    std::uint8_t remap[256];
+    std::vector<std::uint32_t> compacted(1, 0);
+    for (std::size_t i = 1; i < palette.size(); i++)
+    {
+        if (!used[i])
+            continue;
+        remap[i] = static_cast<std::uint8_t>(compacted.size());
+        compacted.push_back(palette[i]);
+    }
+    remap[0] = 0;
+    for (std::uint8_t &voxel : voxels)
+        voxel = remap[voxel];
+    palette.swap(compacted);
+}
+
+std::uint32_t VoxelWorld::get(const glm::ivec3 &voxel) const
+{
+    ChunkCoord coord = {floorDiv(voxel.x, VOXEL_CHUNK_SIZE), floorDiv(voxel.y, VOXEL_CHUNK_SIZE), floorDiv(voxel.z, VOXEL_CHUNK_SIZE)};
+    const VoxelChunk *chunk = find(coord);
+    if (!chunk)
+        return 0;
+    return chunk->get(voxel.x - coord.x * VOXEL_CHUNK_SIZE, voxel.y - coord.y * VOXEL_CHUNK_SIZE, voxel.z - coord.z * VOXEL_CHUNK_SIZE);
+}
+
+bool VoxelWorld::set(const glm::ivec3 &voxel, std::uint32_t color)
+{
+    ChunkCoord coord = {floorDiv(voxel.x, VOXEL_CHUNK_SIZE), floorDiv(voxel.y, VOXEL_CHUNK_SIZE), floorDiv(voxel.z, VOXEL_CHUNK_SIZE)};
+    glm::ivec3 local = voxel - glm::ivec3(coord.x, coord.y, coord.z) * VOXEL_CHUNK_SIZE;
+
+    std::unique_ptr<VoxelChunk> &chunk = chunks[coord];
+    if (!chunk)
+    {
+        if (color == 0)
+        {
+            chunks.erase(coord);
+            return true;
+        }
+        chunk.reset(new VoxelChunk());
+    }
+    if (chunk->get(local.x, local.y, local.z) == color)
+        return true;
+    if (!chunk->set(local.x, local.y, local.z, color))
+        return false;
+
+    markDirty(coord);
+    for (int axis = 0; axis < 3; axis++)
+    {
+        ChunkCoord neighbor = coord;
+        int *component[3] = {&neighbor.x, &neighbor.y, &neighbor.z};
+        if (local[axis] == 0)
+            (*component[axis])--;
+        else if (local[axis] == VOXEL_CHUNK_SIZE - 1)
+            (*component[axis])++;
+        else
+            continue;
+        if (find(neighbor))
+            markDirty(neighbor);
+    }
+    return true;
+}
+
+void VoxelWorld::markDirty(const ChunkCoord &coord)
+{
+    if (dirtySet.insert(coord).second)
+        dirtyChunks.push_back(coord);
+}
+
+void VoxelWorld::takeDirty(std::vector<ChunkCoord> &dirty)
+{
+    dirty.insert(dirty.end(), dirtyChunks.begin(), dirtyChunks.end());
+    dirtyChunks.clear();
+    dirtySet.clear();
+}
+
+const VoxelChunk *VoxelWorld::find(const ChunkCoord &coord) const
+{
+    auto found = chunks.find(coord);
+    return found == chunks.end() ? nullptr : found->second.get();
+}
+
+void VoxelWorld::snapshot(const ChunkCoord &coord, ChunkSnapshot &out) const
+{
+    // the 27 chunks the padded block overlaps, looked up once
+    const VoxelChunk *around[27];
+    for (int z = -1; z <= 1; z++)
+        for (int y = -1; y <= 1; y++)
+            for (int x = -1; x <= 1; x++)
+                around[((z + 1) * 3 + y + 1) * 3 + x + 1] = find({coord.x + x, coord.y + y, coord.z + z});
+
+    out.coord = coord;
+    const int n = VOXEL_CHUNK_SIZE;
+    for (int z = -1; z <= n; z++)
+    {
+        int cz = z < 0 ? 0 : z < n ? 1 : 2;
+        int lz = z - (cz - 1) * n;
+        for (int y = -1; y <= n; y++)
+        {
+            int cy = y < 0 ? 0 : y < n ? 1 : 2;
+            int ly = y - (cy - 1) * n;
+            std::uint32_t *row = &out.colors[((z + 1) * ChunkSnapshot::SIZE + y + 1) * ChunkSnapshot::SIZE];
+            for (int x = -1; x <= n; x++)
+            {
+                int cx = x < 0 ? 0 : x < n ? 1 : 2;
+                const VoxelChunk *chunk = around[(cz * 3 + cy) * 3 + cx];
+                row[x + 1] = chunk ? chunk->get(x - (cx - 1) * n, ly, lz) : 0;
+            }
+        }
+    }
+}
+
+void VoxelWorld::chunkCoords(std::vector<ChunkCoord> &out) const
+{
+    for (const auto &entry : chunks)
+        out.push_back(entry.first);
+}
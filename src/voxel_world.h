@@ -0,0 +1,97 @@
+#ifndef VOXEL_WORLD_H
+#define VOXEL_WORLD_H
+
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// edge length of a chunk in voxels
+const int VOXEL_CHUNK_SIZE = 32;
+
+// chunk position in chunk units, voxel (x, y, z) lives in chunk (floor(x / 32), ...)
+struct ChunkCoord
+{
+    int x, y, z;
+
+    bool operator==(const ChunkCoord &other) const { return x == other.x && y == other.y && z == other.z; }
+};
+
+struct ChunkCoordHash
+{
+    std::size_t operator()(const ChunkCoord &c) const
+    {
+        // multiplied as unsigned, the products overflow for coordinates past a few dozen chunks
+        return (std::size_t)((std::uint32_t)c.x * 73856093u) ^ (std::size_t)((std::uint32_t)c.y * 19349663u) ^
+               (std::size_t)((std::uint32_t)c.z * 83492791u);
+    }
+};
+
+// 32^3 voxels stored as one byte each, indexing a per-chunk palette of up to 256 colors.
+// colors are packed 0xAABBGGRR like the software rasterizer's; 0 is air and always palette entry 0
+class VoxelChunk
+{
+public:
+    VoxelChunk();
+
+    std::uint32_t get(int x, int y, int z) const { return palette[voxels[index(x, y, z)]]; }
+    // false, with the voxel unchanged, if color is new to the chunk and all 256 palette entries are still in use
+    bool set(int x, int y, int z, std::uint32_t color);
+
+    unsigned int solidCount() const { return solid; }
+    std::size_t paletteSize() const { return palette.size(); }
+
+private:
+    static int index(int x, int y, int z) { return (z * VOXEL_CHUNK_SIZE + y) * VOXEL_CHUNK_SIZE + x; }
+    bool paletteIndex(std::uint32_t color, std::uint8_t &entry);
+    void compactPalette();
+
+    std::vector<std::uint32_t> palette;
+    std::uint8_t voxels[VOXEL_CHUNK_SIZE * VOXEL_CHUNK_SIZE * VOXEL_CHUNK_SIZE];
+    unsigned int solid = 0;
+};
+
+// a chunk's colors plus a one voxel border taken from its neighbors, so it can be meshed on another thread
+// while the world keeps changing
+struct ChunkSnapshot
+{
+    static const int SIZE = VOXEL_CHUNK_SIZE + 2;
+
+    ChunkCoord coord;
+    std::uint32_t colors[SIZE * SIZE * SIZE];
+
+    // x, y, z in [-1, VOXEL_CHUNK_SIZE]
+    std::uint32_t at(int x, int y, int z) const { return colors[((z + 1) * SIZE + y + 1) * SIZE + x + 1]; }
+};
+
+class VoxelWorld
+{
+public:
+    std::uint32_t get(const glm::ivec3 &voxel) const;
+
+    // marks the voxel's chunk dirty, and the neighbor across any border the voxel touches since its faces change too.
+    // false, with nothing changed, if the chunk's palette has no room for color (see VoxelChunk::set)
+    bool set(const glm::ivec3 &voxel, std::uint32_t color);
+
+    // move the chunks changed since the last call into dirty
+    void takeDirty(std::vector<ChunkCoord> &dirty);
+
+    void snapshot(const ChunkCoord &coord, ChunkSnapshot &out) const;
+
+    void chunkCoords(std::vector<ChunkCoord> &out) const;
+    std::size_t chunkCount() const { return chunks.size(); }
+
+private:
+    const VoxelChunk *find(const ChunkCoord &coord) const;
+    void markDirty(const ChunkCoord &coord);
+
+    std::unordered_map<ChunkCoord, std::unique_ptr<VoxelChunk>, ChunkCoordHash> chunks;
+    std::vector<ChunkCoord> dirtyChunks;
+    std::unordered_set<ChunkCoord, ChunkCoordHash> dirtySet;
+};
+
+#endif